@@ -147,6 +147,9 @@ public:
   virtual TObjArray*     GetEMCALClusters()                const ;
   virtual TObjArray*     GetPHOSClusters()                 const ;
   
+  virtual AliCaloTrackSpatialIndex* GetCTSSpatialIndex()   const { return fReader->GetCTSSpatialIndex()   ; }
+  virtual AliCaloTrackSpatialIndex* GetEMCALSpatialIndex() const { return fReader->GetEMCALSpatialIndex() ; }
+  
   // Jets
   
   virtual TClonesArray*  GetNonStandardJets()              const { return fReader->GetNonStandardJets() ;}
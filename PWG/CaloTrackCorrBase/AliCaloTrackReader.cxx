@@ -17,6 +17,7 @@
 #include <TFile.h>
 #include <TGeoManager.h>
 #include <TStreamerInfo.h>
+#include <TVector3.h>
 
 // ---- ANALYSIS system ----
 #include "AliMCEvent.h"
@@ -47,6 +48,7 @@
 // ---- CaloTrackCorr ---
 #include "AliCalorimeterUtils.h"
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackSpatialIndex.h"
 
 // ---- Jets ----
 #include "AliAODJet.h"
@@ -78,6 +80,7 @@ fUseTrackDCACut(0),
 fAODBranchList(0x0),
 fCTSTracks(0x0),             fEMCALClusters(0x0),
 fDCALClusters(0x0),          fPHOSClusters(0x0),
+fCTSSpatialIndex(0x0),       fEMCALSpatialIndex(0x0),         fFillSpatialIndex(kFALSE),
 fEMCALCells(0x0),            fPHOSCells(0x0),
 fInputEvent(0x0),            fOutputEvent(0x0),fMC(0x0),
 fFillCTS(0),                 fFillEMCAL(0),
@@ -194,6 +197,9 @@ void AliCaloTrackReader::DeletePointers()
     delete fPHOSClusters ;
   }
   
+  delete fCTSSpatialIndex ;
+  delete fEMCALSpatialIndex ;
+  
   if(fVertex)
   {
     for (Int_t i = 0; i < fNMixedEvent; i++)
@@ -1493,6 +1499,9 @@ Bool_t AliCaloTrackReader::FillInputEvent(Int_t iEntry, const char * /*curFileNa
   if(fFillPHOS)
     FillInputPHOS();
   
+  if(fFillSpatialIndex)
+    FillSpatialIndex();
+  
   FillInputVZERO();
   
   //one specified jet branch
@@ -2417,6 +2426,65 @@ void AliCaloTrackReader::FillInputVZERO()
   }
 }
 
+//_________________________________________________________
+/// Fill the eta-phi index of the CTS tracks and EMCal
+/// clusters arrays of the current event, with the pT, eta
+/// and phi of each entry calculated as in the analysis
+/// modules, so that they can share them and restrict
+/// cone or band loops to the relevant region.
+/// Called in FillInputEvent() after filling the arrays.
+//_________________________________________________________
+void AliCaloTrackReader::FillSpatialIndex()
+{
+  if(!fCTSSpatialIndex)   fCTSSpatialIndex   = new AliCaloTrackSpatialIndex();
+  if(!fEMCALSpatialIndex) fEMCALSpatialIndex = new AliCaloTrackSpatialIndex();
+  
+  TVector3 trackVector;
+  
+  Int_t ntracks = fCTSTracks->GetEntriesFast();
+  fCTSSpatialIndex->Reset(ntracks);
+  for(Int_t i = 0; i < ntracks; i++)
+  {
+    AliVTrack * track = dynamic_cast<AliVTrack*>(fCTSTracks->At(i));
+    if(track)
+    {
+      trackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+      fCTSSpatialIndex->SetEntry(i, trackVector.Pt(), trackVector.Eta(), trackVector.Phi());
+      continue;
+    }
+    
+    // Mixed event stored in AliAODPWG4Particles
+    AliVParticle * trackmix = dynamic_cast<AliVParticle*>(fCTSTracks->At(i));
+    if(trackmix) fCTSSpatialIndex->SetEntry(i, trackmix->Pt(), trackmix->Eta(), trackmix->Phi());
+    else         fCTSSpatialIndex->SetEntry(i, -1, 0, 0);
+  }
+  fCTSSpatialIndex->Build();
+  
+  Int_t nclusters = fEMCALClusters->GetEntriesFast();
+  fEMCALSpatialIndex->Reset(nclusters);
+  for(Int_t i = 0; i < nclusters; i++)
+  {
+    AliVCluster * calo = dynamic_cast<AliVCluster*>(fEMCALClusters->At(i));
+    if(calo)
+    {
+      Int_t evtIndex = 0 ;
+      if (fMixedEvent)
+        evtIndex = fMixedEvent->EventIndexForCaloCluster(calo->GetID()) ;
+      
+      calo->GetMomentum(fMomentum, fVertex[evtIndex]) ;
+      fEMCALSpatialIndex->SetEntry(i, fMomentum.Pt(), fMomentum.Eta(), fMomentum.Phi());
+      continue;
+    }
+    
+    AliVParticle * calomix = dynamic_cast<AliVParticle*>(fEMCALClusters->At(i));
+    if(calomix) fEMCALSpatialIndex->SetEntry(i, calomix->Pt(), calomix->Eta(), calomix->Phi());
+    else        fEMCALSpatialIndex->SetEntry(i, -1, 0, 0);
+  }
+  fEMCALSpatialIndex->Build();
+  
+  AliDebug(1,Form("Spatial index filled with %d tracks and %d clusters",ntracks,nclusters));
+}
+
 //_________________________________________________
 /// Fill array with non standard jets
 ///
@@ -3008,6 +3076,7 @@ void AliCaloTrackReader::Print(const Option_t * opt) const
   printf("Use PHOS        =     %d\n",     fFillPHOS) ;
   printf("Use EMCAL Cells =     %d\n",     fFillEMCALCells) ;
   printf("Use PHOS  Cells =     %d\n",     fFillPHOSCells) ;
+  printf("Use eta-phi index =   %d\n",     fFillSpatialIndex) ;
   printf("Track status    =     %d\n", (Int_t) fTrackStatus) ;
 
   printf("Track Mult Eta Cut =  %2.2f\n",  fTrackMultEtaCut) ;
@@ -3112,6 +3181,9 @@ void AliCaloTrackReader::ResetLists()
   if(fEMCALClusters)   fEMCALClusters -> Clear("C");
   if(fPHOSClusters)    fPHOSClusters  -> Clear("C");
   
+  if(fCTSSpatialIndex)   fCTSSpatialIndex   -> Reset(0);
+  if(fEMCALSpatialIndex) fEMCALSpatialIndex -> Reset(0);
+  
   fV0ADC[0] = 0;   fV0ADC[1] = 0;
   fV0Mul[0] = 0;   fV0Mul[1] = 0;
   
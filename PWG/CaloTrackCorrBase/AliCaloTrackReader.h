@@ -51,6 +51,7 @@ class AliVCluster;
 #include "AliFiducialCut.h"
 class AliCalorimeterUtils;
 #include "AliAnaWeights.h"
+class AliCaloTrackSpatialIndex;
 
 // Jets
 class AliAODJetEventBackground;
@@ -284,6 +285,7 @@ public:
   virtual void     FillInputEMCALCells() ;
   virtual void     FillInputPHOSCells() ;
   virtual void     FillInputVZERO() ;  
+  virtual void     FillSpatialIndex() ;
   
   Int_t            GetV0Signal(Int_t i)              const { return fV0ADC[i]               ; }
   Int_t            GetV0Multiplicity(Int_t i)        const { return fV0Mul[i]               ; }
@@ -300,6 +302,15 @@ public:
   virtual AliVCaloCells* GetEMCALCells()             const { return fEMCALCells             ; }
   virtual AliVCaloCells* GetPHOSCells()              const { return fPHOSCells              ; }
   
+  // Eta-phi index of the tracks/clusters arrays, with their pt, eta and phi
+  
+  virtual AliCaloTrackSpatialIndex* GetCTSSpatialIndex()   const { return fCTSSpatialIndex   ; }
+  virtual AliCaloTrackSpatialIndex* GetEMCALSpatialIndex() const { return fEMCALSpatialIndex ; }
+  
+  Bool_t           IsSpatialIndexSwitchedOn()        const { return fFillSpatialIndex      ; }
+  void             SwitchOnSpatialIndex()                  { fFillSpatialIndex = kTRUE     ; }
+  void             SwitchOffSpatialIndex()                 { fFillSpatialIndex = kFALSE    ; }
+  
   //-------------------------------------
   // Event/track selection methods
   //-------------------------------------
@@ -779,6 +790,10 @@ public:
   /// Temporal array with PHOS  CaloClusters.
   TObjArray      * fPHOSClusters ;                 //-> 
   
+  AliCaloTrackSpatialIndex * fCTSSpatialIndex ;    //!<! Eta-phi index of fCTSTracks, filled per event.
+  AliCaloTrackSpatialIndex * fEMCALSpatialIndex ;  //!<! Eta-phi index of fEMCALClusters, filled per event.
+  Bool_t           fFillSpatialIndex;              ///<  Fill the eta-phi index of tracks and EMCal clusters.
+  
   AliVCaloCells  * fEMCALCells ;                   //!<! Temporal array with EMCAL AliVCaloCells.
   AliVCaloCells  * fPHOSCells ;                    //!<! Temporal array with PHOS  AliVCaloCells.
 
@@ -960,7 +975,7 @@ public:
   AliCaloTrackReader & operator = (const AliCaloTrackReader & r) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCaloTrackReader,76) ;
+  ClassDef(AliCaloTrackReader,77) ;
   /// \endcond
 
 } ;
@@ -0,0 +1,343 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- ROOT system ---
+#include <TMath.h>
+
+// --- Standard library ---
+#include <algorithm>
+
+// --- CaloTrackCorrelations ---
+#include "AliCaloTrackSpatialIndex.h"
+
+/// \cond CLASSIMP
+ClassImp(AliCaloTrackSpatialIndex) ;
+/// \endcond
+
+//____________________________________________________
+/// Default constructor. Cells of 0.1x0.1 in eta-phi.
+//____________________________________________________
+AliCaloTrackSpatialIndex::AliCaloTrackSpatialIndex() :
+TObject(),
+fCellSizeEta(0.1),      fCellSizePhi(0.1),
+fNEntries(0),           fBuilt(kFALSE),
+fEtaMin(0.),            fEtaCellWidth(0.1),
+fNEtaCells(0),          fNPhiCells(0),          fPhiCellWidth(0.),
+fPt(),                  fEta(),                 fPhi(),
+fEntryCell(),           fCellOffset(),          fCellEntries()
+{
+}
+
+//______________________________________________________________
+/// Start a new event, with nEntries to be set with SetEntry().
+/// The arrays are only reallocated when they need to grow.
+//______________________________________________________________
+void AliCaloTrackSpatialIndex::Reset(Int_t nEntries)
+{
+  fBuilt    = kFALSE;
+  fNEntries = nEntries > 0 ? nEntries : 0;
+
+  if ( fPt.GetSize() < fNEntries )
+  {
+    fPt         .Set(fNEntries);
+    fEta        .Set(fNEntries);
+    fPhi        .Set(fNEntries);
+    fEntryCell  .Set(fNEntries);
+    fCellEntries.Set(fNEntries);
+  }
+}
+
+//______________________________________________________________________________
+/// Set the kinematics of entry i, same position as in the reader TObjArray.
+/// Phi is moved to [0,2pi[ as in the analysis modules.
+//______________________________________________________________________________
+void AliCaloTrackSpatialIndex::SetEntry(Int_t i, Float_t pt, Float_t eta, Float_t phi)
+{
+  if ( phi < 0 ) phi += TMath::TwoPi();
+
+  fPt [i] = pt ;
+  fEta[i] = eta;
+  fPhi[i] = phi;
+}
+
+//______________________________________________________________
+/// Arrange the entries in the eta-phi cells, once all were set.
+/// Counting sort, keeps the input order inside each cell.
+//______________________________________________________________
+void AliCaloTrackSpatialIndex::Build()
+{
+  fNPhiCells    = TMath::Max(1, TMath::Nint(TMath::TwoPi()/fCellSizePhi));
+  fPhiCellWidth = TMath::TwoPi()/fNPhiCells;
+
+  Float_t etaMin = 0, etaMax = 0;
+  for(Int_t i = 0; i < fNEntries; i++)
+  {
+    if ( i == 0 || fEta[i] < etaMin ) etaMin = fEta[i];
+    if ( i == 0 || fEta[i] > etaMax ) etaMax = fEta[i];
+  }
+
+  // Avoid too many cells in case of very wide acceptance, MC generator level
+  const Int_t kMaxEtaCells = 500;
+  fEtaMin       = etaMin;
+  fEtaCellWidth = fCellSizeEta;
+  if ( (etaMax-etaMin)/fEtaCellWidth >= kMaxEtaCells )
+    fEtaCellWidth = (etaMax-etaMin)/(kMaxEtaCells-1);
+  fNEtaCells    = Int_t((etaMax-etaMin)/fEtaCellWidth) + 1;
+
+  Int_t nCells = fNEtaCells*fNPhiCells;
+  if ( fCellOffset.GetSize() < nCells+1 ) fCellOffset.Set(nCells+1);
+  fCellOffset.Reset();
+
+  for(Int_t i = 0; i < fNEntries; i++)
+  {
+    fEntryCell[i] = GetEtaCell(fEta[i])*fNPhiCells + GetPhiCell(fPhi[i]);
+    fCellOffset[fEntryCell[i]+1]++;
+  }
+
+  for(Int_t icell = 0; icell < nCells; icell++)
+    fCellOffset[icell+1] += fCellOffset[icell];
+
+  // Use the end of each cell as filling position, then shift back
+  for(Int_t i = 0; i < fNEntries; i++)
+    fCellEntries[fCellOffset[fEntryCell[i]]++] = i;
+
+  for(Int_t icell = nCells; icell > 0; icell--)
+    fCellOffset[icell] = fCellOffset[icell-1];
+  fCellOffset[0] = 0;
+
+  fBuilt = kTRUE;
+}
+
+//________________________________________________________________
+/// \return Eta cell of the grid, values out of the grid are
+/// attributed to the first or last cell.
+//________________________________________________________________
+Int_t AliCaloTrackSpatialIndex::GetEtaCell(Float_t eta) const
+{
+  Int_t cell = TMath::FloorNint((eta-fEtaMin)/fEtaCellWidth);
+
+  if ( cell <  0          ) return 0;
+  if ( cell >= fNEtaCells ) return fNEtaCells-1;
+
+  return cell;
+}
+
+//________________________________________________________________
+/// \return Phi cell of the grid, phi must be in [0,2pi[.
+//________________________________________________________________
+Int_t AliCaloTrackSpatialIndex::GetPhiCell(Float_t phi) const
+{
+  Int_t cell = TMath::FloorNint(phi/fPhiCellWidth);
+
+  if ( cell <  0          ) return 0;
+  if ( cell >= fNPhiCells ) return fNPhiCells-1;
+
+  return cell;
+}
+
+//____________________________________________________________________________________________
+/// Append to list, from position n, the entries of the cells in the given range.
+/// Phi cell range can go out of [0,fNPhiCells[, it is wrapped around.
+/// \return New number of entries in the list.
+//____________________________________________________________________________________________
+Int_t AliCaloTrackSpatialIndex::CollectCells(Int_t etaCellMin, Int_t etaCellMax,
+                                             Int_t phiCellMin, Int_t phiCellMax,
+                                             TArrayI & list, Int_t n) const
+{
+  if ( phiCellMax - phiCellMin + 1 >= fNPhiCells )
+  {
+    phiCellMin = 0;
+    phiCellMax = fNPhiCells-1;
+  }
+
+  for(Int_t ieta = etaCellMin; ieta <= etaCellMax; ieta++)
+  {
+    for(Int_t iphi = phiCellMin; iphi <= phiCellMax; iphi++)
+    {
+      Int_t jphi = iphi;
+      if      ( jphi <  0          ) jphi += fNPhiCells;
+      else if ( jphi >= fNPhiCells ) jphi -= fNPhiCells;
+
+      Int_t icell = ieta*fNPhiCells + jphi;
+      for(Int_t j = fCellOffset[icell]; j < fCellOffset[icell+1]; j++)
+        list[n++] = fCellEntries[j];
+    }
+  }
+
+  return n;
+}
+
+//____________________________________________________________________________________
+/// Order the first n entries of the list as in the input array, remove duplicates.
+/// \return Number of remaining entries.
+//____________________________________________________________________________________
+Int_t AliCaloTrackSpatialIndex::SortAndUnique(TArrayI & list, Int_t n) const
+{
+  Int_t * first = list.GetArray();
+
+  std::sort(first, first+n);
+
+  return std::unique(first, first+n) - first;
+}
+
+//_________________________________________________________________________________________
+/// Select the entries at a distance smaller than r from (etaC,phiC),
+/// distance calculated as in AliIsolationCut::Radius().
+/// \return Number of selected entries, stored in the first positions of list.
+//_________________________________________________________________________________________
+Int_t AliCaloTrackSpatialIndex::GetEntriesInCone(Float_t etaC, Float_t phiC, Float_t r,
+                                                 TArrayI & list) const
+{
+  if ( !fBuilt || fNEntries == 0 ) return 0;
+
+  if ( list.GetSize() < fNEntries ) list.Set(fNEntries);
+
+  if ( phiC < 0 ) phiC += TMath::TwoPi();
+
+  Int_t n = CollectCells(GetEtaCell(etaC-r), GetEtaCell(etaC+r),
+                         TMath::FloorNint((phiC-r)/fPhiCellWidth),
+                         TMath::FloorNint((phiC+r)/fPhiCellWidth), list, 0);
+
+  Int_t nsel = 0;
+  for(Int_t j = 0; j < n; j++)
+  {
+    Int_t i = list[j];
+
+    Float_t dEta = etaC-fEta[i];
+    Float_t dPhi = phiC-fPhi[i];
+    if ( TMath::Abs(dPhi) >= TMath::Pi() ) dPhi = TMath::TwoPi()-TMath::Abs(dPhi);
+
+    if ( TMath::Sqrt(dEta*dEta + dPhi*dPhi) < r ) list[nsel++] = i;
+  }
+
+  return SortAndUnique(list, nsel);
+}
+
+//___________________________________________________________________________________________
+/// Select the entries with etaMin < eta < etaMax, any phi.
+/// \return Number of selected entries, stored in the first positions of list.
+//___________________________________________________________________________________________
+Int_t AliCaloTrackSpatialIndex::GetEntriesInEtaBand(Float_t etaMin, Float_t etaMax,
+                                                    TArrayI & list) const
+{
+  return GetEntriesInRectangle(etaMin, etaMax, 0, TMath::TwoPi(), list, kFALSE);
+}
+
+//___________________________________________________________________________________________
+/// Select the entries with phiMin < phi < phiMax, any eta.
+/// \return Number of selected entries, stored in the first positions of list.
+//___________________________________________________________________________________________
+Int_t AliCaloTrackSpatialIndex::GetEntriesInPhiBand(Float_t phiMin, Float_t phiMax,
+                                                    TArrayI & list, Bool_t wrapPhi) const
+{
+  if ( !fBuilt || fNEntries == 0 ) return 0;
+
+  return GetEntriesInRectangle(fEtaMin-1, fEtaMin+fNEtaCells*fEtaCellWidth+1,
+                               phiMin, phiMax, list, wrapPhi);
+}
+
+//___________________________________________________________________________________________________
+/// Select the entries with etaMin < eta < etaMax and phiMin < phi < phiMax.
+/// \param wrapPhi: if true, the phi range limits are taken modulo 2pi, as for a
+/// distance in azimuth; if false, the stored phi in [0,2pi[ is compared directly
+/// to the limits, as done for the eta band in AliIsolationCut::MakeIsolationCut().
+/// \return Number of selected entries, stored in the first positions of list.
+//___________________________________________________________________________________________________
+Int_t AliCaloTrackSpatialIndex::GetEntriesInRectangle(Float_t etaMin, Float_t etaMax,
+                                                      Float_t phiMin, Float_t phiMax,
+                                                      TArrayI & list, Bool_t wrapPhi) const
+{
+  if ( !fBuilt || fNEntries == 0 ) return 0;
+
+  if ( list.GetSize() < fNEntries ) list.Set(fNEntries);
+
+  Int_t phiCellMin = 0;
+  Int_t phiCellMax = fNPhiCells-1;
+  if ( wrapPhi )
+  {
+    phiCellMin = TMath::FloorNint(phiMin/fPhiCellWidth);
+    phiCellMax = TMath::FloorNint(phiMax/fPhiCellWidth);
+  }
+  else
+  {
+    if ( phiMin > 0              ) phiCellMin = GetPhiCell(phiMin);
+    if ( phiMax < TMath::TwoPi() ) phiCellMax = GetPhiCell(phiMax);
+  }
+
+  Int_t n = CollectCells(GetEtaCell(etaMin), GetEtaCell(etaMax),
+                         phiCellMin, phiCellMax, list, 0);
+
+  Int_t nsel = 0;
+  for(Int_t j = 0; j < n; j++)
+  {
+    Int_t i = list[j];
+
+    if ( fEta[i] <= etaMin || fEta[i] >= etaMax ) continue;
+
+    Float_t phi = fPhi[i];
+    if ( wrapPhi )
+    {
+      // Bring phi next to phiMin to compare
+      while ( phi <  phiMin                  ) phi += TMath::TwoPi();
+      while ( phi >= phiMin+TMath::TwoPi()   ) phi -= TMath::TwoPi();
+    }
+
+    if ( phi <= phiMin || phi >= phiMax ) continue;
+
+    list[nsel++] = i;
+  }
+
+  return SortAndUnique(list, nsel);
+}
+
+//___________________________________________________________________________________________________
+/// Select the candidates needed for an isolation cone of size r around (etaC,phiC)
+/// and for its UE bands: all the entries of the cells overlapping with the eta
+/// strip |eta-etaC| < r (cone and phi band), or with the strip |phi-phiC| < r
+/// without wrapping (eta band). No exact selection is done, it is left to the caller.
+/// \return Number of selected entries, stored in the first positions of list.
+//___________________________________________________________________________________________________
+Int_t AliCaloTrackSpatialIndex::GetEntriesInConeBands(Float_t etaC, Float_t phiC, Float_t r,
+                                                      TArrayI & list) const
+{
+  if ( !fBuilt || fNEntries == 0 ) return 0;
+
+  // Cells of both strips overlap, entries can appear twice before unique
+  if ( list.GetSize() < 2*fNEntries ) list.Set(2*fNEntries);
+
+  if ( phiC < 0 ) phiC += TMath::TwoPi();
+
+  Int_t n = CollectCells(GetEtaCell(etaC-r), GetEtaCell(etaC+r), 0, fNPhiCells-1, list, 0);
+
+  if ( phiC+r > 0 && phiC-r < TMath::TwoPi() )
+    n = CollectCells(0, fNEtaCells-1, GetPhiCell(phiC-r), GetPhiCell(phiC+r), list, n);
+
+  return SortAndUnique(list, n);
+}
+
+//_____________________________________________________
+/// Print some relevant parameters set for the index.
+//_____________________________________________________
+void AliCaloTrackSpatialIndex::Print(const Option_t * opt) const
+{
+  if(! opt)
+    return;
+
+  printf("**** Print %s %s **** \n", GetName(), GetTitle() ) ;
+
+  printf("Cell size: eta %1.3f, phi %1.3f\n", fCellSizeEta, fCellSizePhi) ;
+  printf("Entries %d, built %d, cells eta %d x phi %d\n", fNEntries, fBuilt, fNEtaCells, fNPhiCells) ;
+  printf("    \n") ;
+}
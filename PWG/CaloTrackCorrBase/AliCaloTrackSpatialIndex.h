@@ -0,0 +1,133 @@
+#ifndef ALICALOTRACKSPATIALINDEX_H
+#define ALICALOTRACKSPATIALINDEX_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliCaloTrackSpatialIndex
+/// \brief Per event eta-phi grid of the tracks or clusters selected by the reader.
+///
+/// Filled once per event by AliCaloTrackReader after FillInputCTS() and FillInputEMCAL()
+/// with the pT, eta and phi (in [0,2pi[) of each entry of the corresponding TObjArray,
+/// so that the analysis modules do not have to recalculate them, and arranged in
+/// eta-phi cells so that cone, band and rectangle queries only visit the cells
+/// overlapping with the requested region instead of the full list.
+///
+/// The queries return the positions in the reader TObjArray of the selected entries,
+/// ordered as in the array, so the result of a loop over the selected entries does
+/// not depend on whether the index is used or not.
+///
+/// \author Gustavo Conesa Balbastre <Gustavo.Conesa.Balbastre@cern.ch>, LPSC-IN2P3-CNRS
+//_________________________________________________________________________
+
+// --- ROOT system ---
+#include <TObject.h>
+#include <TArrayF.h>
+#include <TArrayI.h>
+
+class AliCaloTrackSpatialIndex : public TObject {
+
+ public:
+
+  AliCaloTrackSpatialIndex() ;  // default ctor
+
+  /// Virtual destructor.
+  virtual ~AliCaloTrackSpatialIndex() { ; }
+
+  // Filling
+
+  void       Reset(Int_t nEntries) ;
+
+  void       SetEntry(Int_t i, Float_t pt, Float_t eta, Float_t phi) ;
+
+  void       Build() ;
+
+  // Queries
+
+  Int_t      GetEntriesInCone     (Float_t etaC, Float_t phiC, Float_t r, TArrayI & list) const ;
+
+  Int_t      GetEntriesInEtaBand  (Float_t etaMin, Float_t etaMax, TArrayI & list) const ;
+
+  Int_t      GetEntriesInPhiBand  (Float_t phiMin, Float_t phiMax, TArrayI & list, Bool_t wrapPhi = kTRUE) const ;
+
+  Int_t      GetEntriesInRectangle(Float_t etaMin, Float_t etaMax,
+                                   Float_t phiMin, Float_t phiMax, TArrayI & list, Bool_t wrapPhi = kTRUE) const ;
+
+  Int_t      GetEntriesInConeBands(Float_t etaC, Float_t phiC, Float_t r, TArrayI & list) const ;
+
+  // Cached kinematics
+
+  Int_t      GetNEntries()                const { return fNEntries        ; }
+  Bool_t     IsBuilt()                    const { return fBuilt           ; }
+
+  Float_t    GetPt (Int_t i)              const { return fPt .GetArray()[i] ; }
+  Float_t    GetEta(Int_t i)              const { return fEta.GetArray()[i] ; }
+  Float_t    GetPhi(Int_t i)              const { return fPhi.GetArray()[i] ; }
+
+  const Float_t * GetPtArray()            const { return fPt .GetArray()  ; }
+  const Float_t * GetEtaArray()           const { return fEta.GetArray()  ; }
+  const Float_t * GetPhiArray()           const { return fPhi.GetArray()  ; }
+
+  // Grid parameters
+
+  Float_t    GetCellSizeEta()             const { return fCellSizeEta     ; }
+  Float_t    GetCellSizePhi()             const { return fCellSizePhi     ; }
+
+  void       SetCellSizeEta(Float_t s)          { fCellSizeEta = s        ; }
+  void       SetCellSizePhi(Float_t s)          { fCellSizePhi = s        ; }
+
+  void       Print(const Option_t * opt) const ;
+
+ private:
+
+  Int_t      GetEtaCell(Float_t eta)      const ;
+  Int_t      GetPhiCell(Float_t phi)      const ;
+
+  Int_t      CollectCells(Int_t etaCellMin, Int_t etaCellMax,
+                          Int_t phiCellMin, Int_t phiCellMax, TArrayI & list, Int_t n) const ;
+
+  Int_t      SortAndUnique(TArrayI & list, Int_t n) const ;
+
+  Float_t    fCellSizeEta ;      ///< Size of the grid cells in eta.
+
+  Float_t    fCellSizePhi ;      ///< Size of the grid cells in phi, rounded to have an integer number of cells in 2pi.
+
+  Int_t      fNEntries ;         //!<! Number of entries in the current event.
+
+  Bool_t     fBuilt ;            //!<! Grid filled for the current event.
+
+  Float_t    fEtaMin ;           //!<! Lower eta edge of the grid.
+
+  Float_t    fEtaCellWidth ;     //!<! Actual eta width of the cells, enlarged if the eta range is too wide.
+
+  Int_t      fNEtaCells ;        //!<! Number of grid cells in eta.
+
+  Int_t      fNPhiCells ;        //!<! Number of grid cells in phi.
+
+  Float_t    fPhiCellWidth ;     //!<! Actual phi width of the cells, 2pi/fNPhiCells.
+
+  TArrayF    fPt  ;              //!<! pT of each entry.
+
+  TArrayF    fEta ;              //!<! Pseudorapidity of each entry.
+
+  TArrayF    fPhi ;              //!<! Azimuthal angle of each entry, in [0,2pi[.
+
+  TArrayI    fEntryCell ;        //!<! Grid cell of each entry.
+
+  TArrayI    fCellOffset ;       //!<! First position in fCellEntries of each cell, fNEtaCells*fNPhiCells+1 entries.
+
+  TArrayI    fCellEntries ;      //!<! Entries ordered by cell, and by position in the input array inside each cell.
+
+  /// Copy constructor not implemented.
+  AliCaloTrackSpatialIndex(              const AliCaloTrackSpatialIndex & idx) ;
+
+  /// Assignment operator not implemented.
+  AliCaloTrackSpatialIndex & operator = (const AliCaloTrackSpatialIndex & idx) ;
+
+  /// \cond CLASSIMP
+  ClassDef(AliCaloTrackSpatialIndex,1) ;
+  /// \endcond
+
+} ;
+
+#endif //ALICALOTRACKSPATIALINDEX_H
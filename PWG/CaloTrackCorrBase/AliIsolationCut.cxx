@@ -27,6 +27,7 @@
 
 // --- CaloTrackCorrelations --- 
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackSpatialIndex.h"
 #include "AliCalorimeterUtils.h"
 #include "AliCaloPID.h"
 #include "AliFiducialCut.h"
@@ -54,7 +55,8 @@ fFracIsThresh(1),
 fIsTMClusterInConeRejected(1),
 fDistMinToTrigger(-1.),
 fMomentum(),
-fTrackVector()
+fTrackVector(),
+fIndexList()
 {
   InitParameters();
 }
@@ -460,8 +462,18 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   if(plCTS &&
      (fPartInCone==kOnlyCharged || fPartInCone==kNeutralAndCharged))
   {
-    for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+    // If the reader filled the eta-phi index of this array, only loop on the
+    // tracks in the eta and phi strips around the candidate, with their kinematics
+    AliCaloTrackSpatialIndex * index = reader->GetCTSSpatialIndex();
+    if( !index || !index->IsBuilt() || plCTS != reader->GetCTSTracks() ) index = 0x0;
+    
+    Int_t nLoop = plCTS->GetEntries();
+    if( index ) nLoop = index->GetEntriesInConeBands(etaC, phiC, fConeSize, fIndexList);
+    
+    for(Int_t iloop = 0; iloop < nLoop ; iloop ++ )
     {
+      Int_t ipr = index ? fIndexList[iloop] : iloop ;
+      
       AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
       
       if(track)
@@ -482,10 +494,19 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
           if ( contained ) continue ;
         }
         
-        fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
-        pt  = fTrackVector.Pt();
-        eta = fTrackVector.Eta();
-        phi = fTrackVector.Phi() ;
+        if( index )
+        {
+          pt  = index->GetPt (ipr);
+          eta = index->GetEta(ipr);
+          phi = index->GetPhi(ipr);
+        }
+        else
+        {
+          fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+          pt  = fTrackVector.Pt();
+          eta = fTrackVector.Eta();
+          phi = fTrackVector.Phi() ;
+        }
       }
       else
       {// Mixed event stored in AliAODPWG4Particles
@@ -606,8 +627,17 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
      (fPartInCone==kOnlyNeutral || fPartInCone==kNeutralAndCharged))
   {
     
-    for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+    // Same as for tracks, use the reader eta-phi index if filled for this array
+    AliCaloTrackSpatialIndex * index = reader->GetEMCALSpatialIndex();
+    if( !index || !index->IsBuilt() || plNe != reader->GetEMCALClusters() ) index = 0x0;
+    
+    Int_t nLoop = plNe->GetEntries();
+    if( index ) nLoop = index->GetEntriesInConeBands(etaC, phiC, fConeSize, fIndexList);
+    
+    for(Int_t iloop = 0; iloop < nLoop ; iloop ++ )
     {
+      Int_t ipr = index ? fIndexList[iloop] : iloop ;
+      
       AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
       
       if(calo)
@@ -629,12 +659,21 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
              pid->IsTrackMatched(calo,reader->GetCaloUtils(),reader->GetInputEvent()) ) continue ;
         }
         
-        // Assume that come from vertex in straight line
-        calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
-        
-        pt  = fMomentum.Pt()  ;
-        eta = fMomentum.Eta() ;
-        phi = fMomentum.Phi() ;
+        if( index )
+        {
+          pt  = index->GetPt (ipr);
+          eta = index->GetEta(ipr);
+          phi = index->GetPhi(ipr);
+        }
+        else
+        {
+          // Assume that come from vertex in straight line
+          calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+          
+          pt  = fMomentum.Pt()  ;
+          eta = fMomentum.Eta() ;
+          phi = fMomentum.Phi() ;
+        }
       }
       else
       {// Mixed event stored in AliAODPWG4Particles
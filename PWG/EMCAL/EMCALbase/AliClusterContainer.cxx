@@ -255,6 +255,9 @@ Bool_t AliClusterContainer::GetMomentum(TLorentzVector &mom, const AliVCluster*
  */
 Bool_t AliClusterContainer::GetMomentum(TLorentzVector &mom, Int_t i) const
 {
+  Bool_t result = kFALSE;
+  if (GetMomentumFromCache(mom, i, result)) return result;
+
   AliVCluster *vc = GetCluster(i);
   return GetMomentum(mom, vc);
 }
@@ -503,6 +506,22 @@ TString AliClusterContainer::GetDefaultArrayName(const AliVEvent * const ev) con
   else return "";
 }
 
+/**
+ * Build the key of the shared per-event cache, adding the cluster
+ * cuts and the default cluster energy to the cuts of the base class.
+ * @return Key of the shared per-event cache
+ */
+TString AliClusterContainer::BuildEventCacheKey() const
+{
+  TString key = AliEmcalContainer::BuildEventCacheKey();
+  key += TString::Format("/%.17g/%.17g/%d/%d/%d/%d/%.17g", fClusTimeCutLow, fClusTimeCutUp, fExoticCut,
+                         fDefaultClusterEnergy, fIncludePHOS, fPhosMinNcells, fPhosMinM02);
+  for (Int_t i = 0; i <= AliVCluster::kLastUserDefEnergy; i++) {
+    key += TString::Format("/%.17g", fUserDefEnergyCut[i]);
+  }
+  return key;
+}
+
 
 /******************************************
  * Unit tests                             *
@@ -103,6 +103,7 @@ class AliClusterContainer : public AliEmcalContainer {
    * @return Appropriate default array name
    */
   virtual TString             GetDefaultArrayName(const AliVEvent * const ev) const;
+  virtual TString             BuildEventCacheKey() const;
 
   
 #if !(defined(__CINT__) || defined(__MAKECINT__))
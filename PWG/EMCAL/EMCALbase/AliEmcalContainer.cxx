@@ -55,6 +55,12 @@ AliEmcalContainer::AliEmcalContainer():
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fUseEventCache(kFALSE),
+  fEventCacheStatus(kCacheEmpty),
+  fShareEventCache(kTRUE),
+  fOwnEventCache(),
+  fEventCache(&fOwnEventCache),
+  fEventCacheKey(),
   fClassName()
 {
   fVertex[0] = 0;
@@ -92,6 +98,12 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fUseEventCache(kFALSE),
+  fEventCacheStatus(kCacheEmpty),
+  fShareEventCache(kTRUE),
+  fOwnEventCache(),
+  fEventCache(&fOwnEventCache),
+  fEventCacheKey(),
   fClassName()
 {
   fVertex[0] = 0;
@@ -137,6 +149,9 @@ void AliEmcalContainer::SetArray(const AliVEvent *event)
     fClArrayName = GetDefaultArrayName(event);
   }
 
+  fEventCacheKey = BuildEventCacheKey();
+  ResetEventCache();
+
   if (fIsEmbedding) {
     // this is an embedding container
     // will ignore the provided event and use the event
@@ -182,6 +197,8 @@ void AliEmcalContainer::SetArray(const AliVEvent *event)
  * @return Number of accepted events in the container
  */
 Int_t AliEmcalContainer::GetNAcceptEntries() const{
+  if (IsEventCacheAvailable()) return fEventCache->fAcceptIndices.GetSize();
+
   Int_t result = 0;
   for(int index = 0; index < GetNEntries(); index++){
     UInt_t rejectionReason = 0;
@@ -190,6 +207,135 @@ Int_t AliEmcalContainer::GetNAcceptEntries() const{
   return result;
 }
 
+/**
+ * Check whether the per-event cache can be used, filling it
+ * the first time it is requested in the event.
+ * @return True if the cache is switched on and filled for the current event
+ */
+Bool_t AliEmcalContainer::IsEventCacheAvailable() const
+{
+  if (!fUseEventCache) return kFALSE;
+  if (fEventCacheStatus == kCacheEmpty) FillEventCache();
+  return fEventCacheStatus == kCacheValid;
+}
+
+/**
+ * Fill the per-event cache: momentum, selection result and rejection
+ * reason of all the entries of the container, and list of the accepted
+ * entries. While the cache is being filled GetMomentum() and AcceptObject()
+ * are evaluated directly. If the cache is shared and was already filled in
+ * the current event by another container with the same input array and
+ * configuration, it is used as it is.
+ */
+void AliEmcalContainer::FillEventCache() const
+{
+  fEventCacheStatus = kCacheFilling;
+  fEventCache = &fOwnEventCache;
+
+  const Int_t n = GetNEntries();
+  Long64_t entry = -1;
+  const AliVEvent *event = 0;
+  Bool_t shared = fShareEventCache && fClArray && !fEventCacheKey.IsNull() && AliEmcalContainerEventCache::GetCurrentEvent(entry, event);
+  if (shared) {
+    fEventCache = AliEmcalContainerEventCache::GetSharedCache(fClArray, fEventCacheKey);
+    if (fEventCache->IsFilled(entry, event, n)) {
+      fEventCacheStatus = kCacheValid;
+      return;
+    }
+  }
+
+  AliEmcalContainerEventCache &cache = *fEventCache;
+  cache.Resize(n);
+
+  AliTLorentzVector mom;
+  Int_t nAccepted = 0;
+  for (Int_t i = 0; i < n; i++) {
+    Char_t flags = 0;
+    if (GetMomentum(mom, i)) flags |= AliEmcalContainerEventCache::kMomentum;
+    cache.fPx[i] = mom.Px();
+    cache.fPy[i] = mom.Py();
+    cache.fPz[i] = mom.Pz();
+    cache.fE[i] = mom.E();
+    cache.fPt[i] = mom.Pt();
+    cache.fEta[i] = mom.Pt() > 0 ? mom.Eta() : 0;
+    cache.fPhi[i] = mom.Phi_0_2pi();
+
+    UInt_t rejectionReason = 0;
+    if (AcceptObject(i, rejectionReason)) {
+      flags |= AliEmcalContainerEventCache::kAccepted;
+      cache.fAcceptIndices[nAccepted++] = i;
+    }
+    cache.fFlags[i] = flags;
+    cache.fRejection[i] = rejectionReason;
+  }
+  cache.fAcceptIndices.Set(nAccepted);
+
+  if (shared) cache.SetFilled(entry, event);
+  fEventCacheStatus = kCacheValid;
+}
+
+/**
+ * Build the key identifying the containers that can share the per-event cache:
+ * class of the container and cuts applied by AcceptObject() and GetMomentum().
+ * Derived classes with additional cuts append them to the key of the base class.
+ * @return Key of the shared per-event cache
+ */
+TString AliEmcalContainer::BuildEventCacheKey() const
+{
+  return TString::Format("%s/%d/%u/%.17g/%.17g/%.17g/%.17g/%.17g/%.17g/%.17g/%.17g/%d/%d/%.17g",
+                         IsA()->GetName(), fIsParticleLevel, fBitMap, fMinPt, fMaxPt, fMinE, fMaxE,
+                         fMinEta, fMaxEta, fMinPhi, fMaxPhi, fMinMCLabel, fMaxMCLabel, fMassHypothesis);
+}
+
+/**
+ * Retrieve the momentum of the \f$ i^{th} \f$ entry from the per-event cache.
+ * Used by the implementations of GetMomentum() in the derived classes.
+ * @param[out] mom Momentum vector to be filled
+ * @param[in] i Index of the entry
+ * @param[out] result Value to be returned by GetMomentum()
+ * @return True if the cache was used, false if the momentum has to be calculated
+ */
+Bool_t AliEmcalContainer::GetMomentumFromCache(TLorentzVector &mom, Int_t i, Bool_t &result) const
+{
+  if (fEventCacheStatus != kCacheValid || !fUseEventCache) return kFALSE;
+  if (i < 0 || i >= fEventCache->fFlags.GetSize()) return kFALSE;
+
+  const AliEmcalContainerEventCache &cache = *fEventCache;
+  mom.SetPxPyPzE(cache.fPx[i], cache.fPy[i], cache.fPz[i], cache.fE[i]);
+  result = (cache.fFlags[i] & AliEmcalContainerEventCache::kMomentum) != 0;
+  return kTRUE;
+}
+
+/**
+ * Get the momentum of the \f$ i^{th} \f$ entry, from the per-event cache
+ * if available, otherwise using GetMomentum().
+ * @param[out] mom Momentum vector to be filled
+ * @param[in] i Index of the entry
+ * @return True if the request was successfull, false otherwise
+ */
+Bool_t AliEmcalContainer::GetMomentumCached(TLorentzVector &mom, Int_t i) const
+{
+  Bool_t result = kFALSE;
+  if (IsEventCacheAvailable() && GetMomentumFromCache(mom, i, result)) return result;
+  return GetMomentum(mom, i);
+}
+
+/**
+ * Selection of the \f$ i^{th} \f$ entry, from the per-event cache
+ * if available, otherwise using AcceptObject().
+ * @param[in] i Index of the entry
+ * @param[out] rejectionReason Bitmap with the reason why the entry was rejected
+ * @return True if the entry is accepted, false otherwise
+ */
+Bool_t AliEmcalContainer::AcceptObjectCached(Int_t i, UInt_t &rejectionReason) const
+{
+  if (IsEventCacheAvailable() && i >= 0 && i < fEventCache->fFlags.GetSize()) {
+    rejectionReason |= fEventCache->fRejection[i];
+    return (fEventCache->fFlags[i] & AliEmcalContainerEventCache::kAccepted) != 0;
+  }
+  return AcceptObject(i, rejectionReason);
+}
+
 /**
  * Get the index in the container from a given label
  * @param lab Label to check
@@ -13,6 +13,7 @@ class AliVParticle;
 
 #include <TNamed.h>
 #include <TClonesArray.h>
+#include "AliEmcalContainerEventCache.h"
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
 typedef EMCALIterableContainer::AliEmcalIterableContainerT<TObject, EMCALIterableContainer::operator_star_object<TObject> > AliEmcalIterableContainer;
@@ -71,6 +72,20 @@ typedef EMCALIterableContainer::AliEmcalIterableContainerT<TObject, EMCALIterabl
  * ~~~
  *
  * The usage of EMCAL containers is described under \subpage EMCALcontainers
+ *
+ * Optionally (see SetUseEventCache()) the momentum and the selection result of all the
+ * entries are calculated once per event, the first time they are needed, and kept in
+ * flat arrays until the next call to NextEvent(). Iterators, GetNAcceptEntries() and
+ * GetMomentum() then read the cached values instead of rebuilding the momentum vector
+ * and re-applying the cuts at each access. The cache must only be switched on if the
+ * cuts of the container are not changed during the event.
+ *
+ * By default the cache is shared (see AliEmcalContainerEventCache) by all the containers
+ * of the same class reading the same input array with the same cuts (see BuildEventCacheKey()),
+ * so that tasks of a train with identical cuts fill it only once per event. The key is built
+ * in SetArray(), therefore the cuts must be configured before the container is connected to
+ * the input event. Sharing also requires that the entries of the input array are not modified
+ * by the tasks running in between; otherwise it has to be switched off with SetShareEventCache(kFALSE).
  */
 class AliEmcalContainer : public TObject {
  public:
@@ -156,7 +171,24 @@ class AliEmcalContainer : public TObject {
   void                        SortArray()                           { fClArray->Sort()                  ; }
 
   TClass*                     GetLoadedClass()                      { return fLoadedClass               ; }
-  virtual void                NextEvent() {;}
+  virtual void                NextEvent()                           { ResetEventCache()                 ; }
+
+  void                        SetUseEventCache(Bool_t b)            { fUseEventCache = b; ResetEventCache(); }
+  Bool_t                      GetUseEventCache()              const { return fUseEventCache             ; }
+  void                        SetShareEventCache(Bool_t b)          { fShareEventCache = b; ResetEventCache(); }
+  Bool_t                      GetShareEventCache()            const { return fShareEventCache           ; }
+  void                        ResetEventCache()                     { fEventCacheStatus = kCacheEmpty   ; }
+  Bool_t                      IsEventCacheAvailable()         const;
+  Bool_t                      AcceptObjectCached(Int_t i, UInt_t &rejectionReason) const;
+  Bool_t                      GetMomentumCached(TLorentzVector &mom, Int_t i) const;
+  const TArrayI              *GetCachedAcceptedIndices()      const { return IsEventCacheAvailable() ? &fEventCache->fAcceptIndices : 0; }
+  const Double_t             *GetCachedPx()                   const { return IsEventCacheAvailable() ? fEventCache->fPx.GetArray()  : 0; }
+  const Double_t             *GetCachedPy()                   const { return IsEventCacheAvailable() ? fEventCache->fPy.GetArray()  : 0; }
+  const Double_t             *GetCachedPz()                   const { return IsEventCacheAvailable() ? fEventCache->fPz.GetArray()  : 0; }
+  const Double_t             *GetCachedE()                    const { return IsEventCacheAvailable() ? fEventCache->fE.GetArray()   : 0; }
+  const Double_t             *GetCachedPt()                   const { return IsEventCacheAvailable() ? fEventCache->fPt.GetArray()  : 0; }
+  const Double_t             *GetCachedEta()                  const { return IsEventCacheAvailable() ? fEventCache->fEta.GetArray() : 0; }
+  const Double_t             *GetCachedPhi()                  const { return IsEventCacheAvailable() ? fEventCache->fPhi.GetArray() : 0; }
   void                        SetMinMCLabel(Int_t s)                            { fMinMCLabel      = s   ; }
   void                        SetMaxMCLabel(Int_t s)                            { fMaxMCLabel      = s   ; }
   void                        SetMCLabelRange(Int_t min, Int_t max)             { SetMinMCLabel(min)     ; SetMaxMCLabel(max)    ; }
@@ -199,6 +231,20 @@ class AliEmcalContainer : public TObject {
    */
   virtual TString             GetDefaultArrayName(const AliVEvent * const ev) const { return ""; }
 
+  /**
+   * @enum EEventCacheStatus_t
+   * @brief Status of the per-event cache of momenta and selection results
+   */
+  enum EEventCacheStatus_t {
+    kCacheEmpty = 0,                     ///< Not yet filled in this event
+    kCacheFilling = 1,                   ///< Being filled (the cached values must not be used)
+    kCacheValid = 2                      ///< Filled for the current event
+  };
+
+  void                        FillEventCache() const;
+  virtual TString             BuildEventCacheKey() const;
+  Bool_t                      GetMomentumFromCache(TLorentzVector &mom, Int_t i, Bool_t &result) const;
+
   TString                     fName;                    ///< object name
   TString                     fClArrayName;             ///< name of branch
   TString                     fBaseClassName;           ///< name of the base class that this container can handle
@@ -221,6 +267,12 @@ class AliEmcalContainer : public TObject {
   AliNamedArrayI             *fLabelMap;                //!<! Label-Index map
   Double_t                    fVertex[3];               //!<! event vertex array
   TClass                     *fLoadedClass;             //!<! Class of the objects contained in the TClonesArray
+  Bool_t                      fUseEventCache;           ///< Cache momenta and selection results of all entries once per event
+  mutable Int_t               fEventCacheStatus;        //!<! Status of the per-event cache (see EEventCacheStatus_t)
+  Bool_t                      fShareEventCache;         ///< Share the per-event cache with the containers with the same input array and configuration
+  mutable AliEmcalContainerEventCache fOwnEventCache;   //!<! Per-event cache used when it is not shared
+  mutable AliEmcalContainerEventCache *fEventCache;     //!<! Per-event cache in use (own or shared)
+  TString                     fEventCacheKey;           //!<! Key of the shared per-event cache, built from the cuts in SetArray()
 
  private:
   TString                     fClassName;               ///< name of the class in the TClonesArray
@@ -229,7 +281,7 @@ class AliEmcalContainer : public TObject {
   AliEmcalContainer& operator=(const AliEmcalContainer& other); // assignment
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalContainer,9);
+  ClassDef(AliEmcalContainer,11);
   /// \endcond
 };
 #endif
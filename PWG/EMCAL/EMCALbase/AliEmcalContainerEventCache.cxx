@@ -0,0 +1,117 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <TClonesArray.h>
+
+#include "AliAnalysisManager.h"
+#include "AliVEventHandler.h"
+#include "AliVEvent.h"
+
+#include "AliEmcalContainerEventCache.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalContainerEventCache);
+/// \endcond
+
+/**
+ * Default constructor.
+ */
+AliEmcalContainerEventCache::AliEmcalContainerEventCache():
+  TObject(),
+  fEntry(-1),
+  fEvent(0),
+  fPx(),
+  fPy(),
+  fPz(),
+  fE(),
+  fPt(),
+  fEta(),
+  fPhi(),
+  fFlags(),
+  fRejection(),
+  fAcceptIndices()
+{
+}
+
+/**
+ * Get the cache shared by all the containers reading the same input array with
+ * the same configuration. The cache is created the first time it is requested
+ * and lives until the end of the process.
+ * @param array Input array of the containers
+ * @param configuration Key built from the cuts of the containers (see AliEmcalContainer::BuildEventCacheKey())
+ * @return Shared cache
+ */
+AliEmcalContainerEventCache* AliEmcalContainerEventCache::GetSharedCache(const TClonesArray* array, const TString& configuration)
+{
+  typedef std::pair<const TClonesArray*, std::string> key_t;
+  static std::map<key_t, std::unique_ptr<AliEmcalContainerEventCache> > caches;
+  std::unique_ptr<AliEmcalContainerEventCache>& cache = caches[key_t(array, std::string(configuration.Data(), configuration.Length()))];
+  if (!cache) cache.reset(new AliEmcalContainerEventCache());
+  return cache.get();
+}
+
+/**
+ * Get the entry and the input event currently processed by the analysis manager.
+ * @param[out] entry Current entry
+ * @param[out] event Current input event
+ * @return kFALSE if there is no analysis manager, kTRUE otherwise
+ */
+Bool_t AliEmcalContainerEventCache::GetCurrentEvent(Long64_t& entry, const AliVEvent*& event)
+{
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr) return kFALSE;
+  entry = mgr->GetCurrentEntry();
+  AliVEventHandler* handler = mgr->GetInputEventHandler();
+  event = handler ? handler->GetEvent() : 0;
+  return kTRUE;
+}
+
+/**
+ * Resize the cache to a given number of entries and mark it as not filled.
+ * The memory of the arrays is reused if large enough.
+ * @param n Number of entries
+ */
+void AliEmcalContainerEventCache::Resize(Int_t n)
+{
+  fEntry = -1;
+  fEvent = 0;
+  fPx.Set(n);
+  fPy.Set(n);
+  fPz.Set(n);
+  fE.Set(n);
+  fPt.Set(n);
+  fEta.Set(n);
+  fPhi.Set(n);
+  fFlags.Set(n);
+  fRejection.Set(n);
+  fAcceptIndices.Set(n);
+}
+
+/**
+ * Check whether the cache was filled in a given event.
+ * @param entry Entry of the analysis manager
+ * @param event Input event
+ * @param n Number of entries of the input array
+ * @return kTRUE if the cache was filled in the same entry and event with the same number of entries
+ */
+Bool_t AliEmcalContainerEventCache::IsFilled(Long64_t entry, const AliVEvent* event, Int_t n) const
+{
+  return fEntry >= 0 && fEntry == entry && fEvent == event && fFlags.GetSize() == n;
+}
@@ -0,0 +1,74 @@
+#ifndef ALIEMCALCONTAINEREVENTCACHE_H
+#define ALIEMCALCONTAINEREVENTCACHE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+class TClonesArray;
+class AliVEvent;
+
+#include <TObject.h>
+#include <TString.h>
+#include <TArrayC.h>
+#include <TArrayD.h>
+#include <TArrayI.h>
+
+/**
+ * @class AliEmcalContainerEventCache
+ * @brief Momenta and selection results of the entries of a container in the current event
+ * @ingroup EMCALCOREFW
+ *
+ * The cache is filled by AliEmcalContainer (see AliEmcalContainer::SetUseEventCache()).
+ * It is either private to a container or shared by all the containers that read the same
+ * input array with the same configuration (see GetSharedCache()), e.g. the containers of
+ * different tasks of a train with identical cuts. A shared cache is filled once per event
+ * by the first container that needs it. The event is identified by the entry and the
+ * input event of the analysis manager (see GetCurrentEvent()).
+ */
+class AliEmcalContainerEventCache : public TObject {
+ public:
+  /**
+   * @enum EEntryFlags_t
+   * @brief Bits stored for each entry
+   */
+  enum EEntryFlags_t {
+    kMomentum = 1<<0,                    ///< GetMomentum() succeeded
+    kAccepted = 1<<1                     ///< AcceptObject() succeeded
+  };
+
+  AliEmcalContainerEventCache();
+  virtual ~AliEmcalContainerEventCache() {}
+
+  static AliEmcalContainerEventCache *GetSharedCache(const TClonesArray *array, const TString &configuration);
+  static Bool_t               GetCurrentEvent(Long64_t &entry, const AliVEvent *&event);
+
+  void                        Resize(Int_t n);
+  void                        SetFilled(Long64_t entry, const AliVEvent *event)    { fEntry = entry; fEvent = event ; }
+  Bool_t                      IsFilled(Long64_t entry, const AliVEvent *event, Int_t n) const;
+  Int_t                       GetNEntries()                   const { return fFlags.GetSize()           ; }
+
+ protected:
+  friend class AliEmcalContainer;
+
+  Long64_t                    fEntry;                   //!<! Entry of the analysis manager the cache was filled in (-1 if unknown)
+  const AliVEvent            *fEvent;                   //!<! Input event the cache was filled in
+  TArrayD                     fPx;                      //!<! \f$ p_{x} \f$ of each entry
+  TArrayD                     fPy;                      //!<! \f$ p_{y} \f$ of each entry
+  TArrayD                     fPz;                      //!<! \f$ p_{z} \f$ of each entry
+  TArrayD                     fE;                       //!<! Energy of each entry
+  TArrayD                     fPt;                      //!<! \f$ p_{t} \f$ of each entry
+  TArrayD                     fEta;                     //!<! \f$ \eta \f$ of each entry
+  TArrayD                     fPhi;                     //!<! \f$ \phi \f$ of each entry
+  TArrayC                     fFlags;                   //!<! Status bits of each entry (see EEntryFlags_t)
+  TArrayI                     fRejection;               //!<! Rejection reason of each entry
+  TArrayI                     fAcceptIndices;           //!<! Indices of the accepted entries
+
+ private:
+  AliEmcalContainerEventCache(const AliEmcalContainerEventCache&);            // not implemented
+  AliEmcalContainerEventCache& operator=(const AliEmcalContainerEventCache&); // not implemented
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalContainerEventCache, 1);
+  /// \endcond
+};
+
+#endif
@@ -84,7 +84,7 @@ AliAODMCParticle* AliMCParticleContainer::GetAcceptMCParticle(Int_t i) const
 
   UInt_t rejectionReason = 0;
   if (i == -1) i = fCurrentID;
-  if (AcceptMCParticle(i, rejectionReason)) {
+  if (AcceptObjectCached(i, rejectionReason)) {
       return GetMCParticle(i);
   }
   else {
@@ -194,6 +194,18 @@ Bool_t AliMCParticleContainer::ApplyMCParticleCuts(const AliAODMCParticle* vp, U
   return ApplyParticleCuts(vp, rejectionReason);
 }
 
+/**
+ * Build the key of the shared per-event cache, adding the MC flag
+ * selection to the cuts of the base class.
+ * @return Key of the shared per-event cache
+ */
+TString AliMCParticleContainer::BuildEventCacheKey() const
+{
+  TString key = AliParticleContainer::BuildEventCacheKey();
+  key += TString::Format("/%u", fMCFlag);
+  return key;
+}
+
 /**
  * Create an iterable container interface over all objects in the
  * EMCAL container.
@@ -62,6 +62,7 @@ class AliMCParticleContainer : public AliParticleContainer {
 
  protected:
   virtual TString             GetDefaultArrayName(const AliVEvent * const ev) const { return "mcparticles"; }
+  virtual TString             BuildEventCacheKey() const;
 
   UInt_t                      fMCFlag;                        ///< select MC particles with flags
 
@@ -114,7 +114,7 @@ AliVParticle* AliParticleContainer::GetAcceptParticle(Int_t i) const
 {
   UInt_t rejectionReason = 0;
   if (i == -1) i = fCurrentID;
-  if (AcceptParticle(i, rejectionReason)) {
+  if (AcceptObjectCached(i, rejectionReason)) {
       return GetParticle(i);
   }
   else {
@@ -207,6 +207,8 @@ Bool_t AliParticleContainer::GetMomentumFromParticle(TLorentzVector &mom, const
 Bool_t AliParticleContainer::GetMomentum(TLorentzVector &mom, Int_t i) const
 {
   if (i == -1) i = fCurrentID;
+  Bool_t result = kFALSE;
+  if (GetMomentumFromCache(mom, i, result)) return result;
   AliVParticle *vp = GetParticle(i);
   return GetMomentumFromParticle(mom, vp);
 }
@@ -382,6 +384,18 @@ Bool_t AliParticleContainer::ApplyParticleCuts(const AliVParticle* vp, UInt_t &r
   return kTRUE;
 }
 
+/**
+ * Build the key of the shared per-event cache, adding the particle
+ * cuts to the cuts of the base class.
+ * @return Key of the shared per-event cache
+ */
+TString AliParticleContainer::BuildEventCacheKey() const
+{
+  TString key = AliEmcalContainer::BuildEventCacheKey();
+  key += TString::Format("/%.17g/%d/%d", fMinDistanceTPCSectorEdge, fChargeCut, fGeneratorIndex);
+  return key;
+}
+
 /**
  * Apply kinematical cuts to the momentum vector provided. In addition
  * to the standard kinematical cuts in \f$ p_{t} \f$, \f$ \eta \f$ and
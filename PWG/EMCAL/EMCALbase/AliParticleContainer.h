@@ -91,6 +91,7 @@ class AliParticleContainer : public AliEmcalContainer {
 #endif
 
  protected:
+  virtual TString             BuildEventCacheKey() const;
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
   static AliEmcalContainerIndexMap <TClonesArray, AliVParticle> fgEmcalContainerIndexMap; //!<! Mapping from containers to indices
@@ -151,6 +151,8 @@ void AliTrackContainer::SetArray(const AliVEvent *event)
  */
 void AliTrackContainer::NextEvent()
 {
+  AliParticleContainer::NextEvent();
+
   fTrackTypes.Reset(kUndefined);
   if (fEmcalTrackSelection) {
     fFilteredTracks = fEmcalTrackSelection->GetAcceptedTracks(fClArray);
@@ -209,7 +211,7 @@ AliVTrack* AliTrackContainer::GetAcceptTrack(Int_t i) const
 {
   UInt_t rejectionReason;
   if (i == -1) i = fCurrentID;
-  if (AcceptTrack(i, rejectionReason)) {
+  if (AcceptObjectCached(i, rejectionReason)) {
       return GetTrack(i);
   }
   else {
@@ -334,6 +336,9 @@ Bool_t AliTrackContainer::GetMomentum(TLorentzVector &mom, Int_t i) const
   Double_t mass = fMassHypothesis;
 
   if (i == -1) i = fCurrentID;
+  Bool_t result = kFALSE;
+  if (GetMomentumFromCache(mom, i, result)) return result;
+
   AliVTrack *vp = GetTrack(i);
   if (vp) {
     if (mass < 0) mass = vp->M();
@@ -616,3 +621,22 @@ TString AliTrackContainer::GetDefaultArrayName(const AliVEvent *const ev) const
   else if(ev->IsA() == AliESDEvent::Class()) return "Tracks";
   else return "";
 }
+
+/**
+ * Build the key of the shared per-event cache, adding the track
+ * selection to the cuts of the base class. Custom track cuts are
+ * identified by their address, so only containers using the same
+ * cut objects share the cache.
+ * @return Key of the shared per-event cache
+ */
+TString AliTrackContainer::BuildEventCacheKey() const
+{
+  TString key = AliParticleContainer::BuildEventCacheKey();
+  key += TString::Format("/%d/%d/%u/%s", fTrackFilterType, fSelectionModeAny, fAODFilterBits, fTrackCutsPeriod.Data());
+  if (fTrackFilterType == AliEmcalTrackSelection::kCustomTrackFilter && fListOfCuts) {
+    for (Int_t i = 0; i < fListOfCuts->GetEntriesFast(); i++) {
+      key += TString::Format("/%p", static_cast<const void*>(fListOfCuts->At(i)));
+    }
+  }
+  return key;
+}
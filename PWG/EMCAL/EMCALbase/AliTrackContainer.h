@@ -116,6 +116,7 @@ class AliTrackContainer : public AliParticleContainer {
    * @return Appropriate default array name
    */
   virtual TString             GetDefaultArrayName(const AliVEvent * const ev) const;
+  virtual TString             BuildEventCacheKey() const;
 
   static TString              fgDefTrackCutsPeriod;           //!<! default period string used to generate track cuts
 
@@ -9,6 +9,7 @@
 #pragma link C++ class AliAnalysisTaskEmcalEmbeddingHelper+;
 #pragma link C++ class AliClusterContainer+;
 #pragma link C++ class AliEmcalContainer+;
+#pragma link C++ class AliEmcalContainerEventCache+;
 #pragma link C++ class AliEmcalContainerUtils+;
 #pragma link C++ class AliEmcalDownscaleFactorsOCDB+;
 #pragma link C++ class AliEmcalAODFilterBitCuts+;
@@ -82,6 +82,12 @@ AliFlowEventSimple::AliFlowEventSimple():
   fRun(-1),
   fZNCM(0.),
   fZNAM(0.),
+  fArrayPhi(),
+  fArrayEta(),
+  fArrayPt(),
+  fArrayWeight(),
+  fArrayPOIbits(),
+  fTrackArraysDirty(kTRUE),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(NULL)
 {
@@ -136,6 +142,12 @@ AliFlowEventSimple::AliFlowEventSimple( Int_t n,
   fRun(-1),
   fZNCM(0.),
   fZNAM(0.),
+  fArrayPhi(),
+  fArrayEta(),
+  fArrayPt(),
+  fArrayWeight(),
+  fArrayPOIbits(),
+  fTrackArraysDirty(kTRUE),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -194,6 +206,12 @@ AliFlowEventSimple::AliFlowEventSimple(const AliFlowEventSimple& anEvent):
   fZNAQ(anEvent.fZNAQ),
   fZNCM(anEvent.fZNCM),
   fZNAM(anEvent.fZNAM),
+  fArrayPhi(),
+  fArrayEta(),
+  fArrayPt(),
+  fArrayWeight(),
+  fArrayPOIbits(),
+  fTrackArraysDirty(kTRUE),
   fNumberOfPOItypes(anEvent.fNumberOfPOItypes),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -286,6 +304,7 @@ AliFlowEventSimple& AliFlowEventSimple::operator=(const AliFlowEventSimple& anEv
     fV0A[i] = anEvent.fV0A[i];
   }
   delete [] fShuffledIndexes;
+  fTrackArraysDirty = kTRUE;
   return *this;
 }
 
@@ -391,6 +410,7 @@ void AliFlowEventSimple::Generate(Int_t nParticles,
     fMCReactionPlaneAngleIsSet=kTRUE;
   }
   SetUserModified();
+  fTrackArraysDirty=kTRUE;
 }
 
 //-----------------------------------------------------------------------
@@ -428,10 +448,11 @@ void AliFlowEventSimple::ShuffleTracks()
 void AliFlowEventSimple::AddTrack( AliFlowTrackSimple* track )
 {
   //add a track, delete the old one if necessary
+  //(the track may also be the one at this position, taken from ReuseTrack)
   if (fNumberOfTracks < fTrackCollection->GetEntriesFast())
   {
     TObject* o = fTrackCollection->At(fNumberOfTracks);
-    delete o;
+    if (o!=track) delete o;
   }
   fTrackCollection->AddAtAndExpand(track,fNumberOfTracks);
   if (track->GetNDaughters()>0)
@@ -447,6 +468,7 @@ void AliFlowEventSimple::TrackAdded()
 {
   //book keeping after a new track has been added
   fNumberOfTracks++;
+  fTrackArraysDirty=kTRUE;
   if (fShuffledIndexes)
   {
     delete [] fShuffledIndexes;
@@ -465,6 +487,75 @@ AliFlowTrackSimple* AliFlowEventSimple::MakeNewTrack()
    return t;
 }
 
+//-----------------------------------------------------------------------
+AliFlowTrackSimple* AliFlowEventSimple::ReuseTrack(Int_t i)
+{
+  //try to reuse an existing track (left by ClearFast), if empty, make new one
+  //the track is added to the event with AddTrack(track) once it is filled
+  AliFlowTrackSimple* pTrack = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
+  if (pTrack)
+  {
+    pTrack->Clear();
+  }
+  else
+  {
+    pTrack = new AliFlowTrackSimple();
+    fTrackCollection->AddAtAndExpand(pTrack,i);
+  }
+  return pTrack;
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEventSimple::PreallocateTracks(Int_t n)
+{
+  //allocate the tracks up to n, so that the first n tracks of the events
+  //filled after a ClearFast are taken from ReuseTrack without allocation
+  fTrackCollection->Expand(TMath::Max(n,fTrackCollection->GetSize()));
+  for (Int_t i=0; i<n; i++)
+  {
+    if (!fTrackCollection->At(i)) ReuseTrack(i);
+  }
+}
+
+//-----------------------------------------------------------------------
+Int_t AliFlowEventSimple::FillTrackArrays()
+{
+  //copy phi, eta, pt, weight and POI types of the tracks to contiguous arrays,
+  //in the order of the track collection (not shuffled), to loop on them without
+  //going through the tracks; the arrays are valid until the tracks are changed:
+  //adding tracks, ClearFast and the methods of the event that change the tracks
+  //mark them dirty, a track changed through GetTrack() needs SetTrackArraysDirty()
+  fArrayPhi.resize(fNumberOfTracks);
+  fArrayEta.resize(fNumberOfTracks);
+  fArrayPt.resize(fNumberOfTracks);
+  fArrayWeight.resize(fNumberOfTracks);
+  fArrayPOIbits.resize(fNumberOfTracks);
+  Int_t nTypes = TMath::Max(1,TMath::Min(fNumberOfPOItypes,32)); //at least the RP bit
+  for (Int_t i=0; i<fNumberOfTracks; i++)
+  {
+    AliFlowTrackSimple* pTrack = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
+    if (!pTrack)
+    {
+      cerr << "no particle!!!"<<endl;
+      fArrayPhi[i] = fArrayEta[i] = fArrayPt[i] = fArrayWeight[i] = 0.;
+      fArrayPOIbits[i] = 0;
+      continue;
+    }
+    fArrayPhi[i] = pTrack->Phi();
+    fArrayEta[i] = pTrack->Eta();
+    fArrayPt[i] = pTrack->Pt();
+    fArrayWeight[i] = pTrack->Weight();
+    UInt_t bits = 0;
+    for (Int_t j=0; j<nTypes; j++)
+    {
+      if (pTrack->CheckTag(j)) bits |= (1u<<j);
+    }
+    fArrayPOIbits[i] = bits;
+  }
+  fTrackArraysDirty=kFALSE;
+  return fNumberOfTracks;
+}
+
 //-----------------------------------------------------------------------
 AliFlowVector AliFlowEventSimple::GetQ( Int_t n, 
                                         TList *weightsList, 
@@ -485,8 +576,6 @@ AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
   Double_t dEta = 0.;
   Double_t dWeight = 1.;
 
-  AliFlowTrackSimple* pTrack = NULL;
-
   Int_t nBinsPhi = 0;
   Double_t dBinWidthPt = 0.;
   Double_t dPtMin = 0.;
@@ -528,48 +617,46 @@ AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
     }
   } // end of if(weightsList)
 
-  // loop over tracks
+  // loop over the contiguous copy of the tracks, refilled only if the tracks changed
+  if (fTrackArraysDirty || GetNTrackArrays()!=fNumberOfTracks) FillTrackArrays();
+  const Double_t* arrayPhi = GetPhiArray();
+  const Double_t* arrayPt = GetPtArray();
+  const Double_t* arrayEta = GetEtaArray();
+  const Double_t* arrayWeight = GetWeightArray();
+  const UInt_t* arrayPOIbits = GetPOIbitsArray();
   for(Int_t i=0; i<fNumberOfTracks; i++)
   {
-    pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
-    if(pTrack)
+    if(arrayPOIbits[i] & (1u<<AliFlowTrackSimple::kRP))
     {
-      if(pTrack->InRPSelection())
-      {
-        dPhi = pTrack->Phi();
-        dPt  = pTrack->Pt();
-        dEta = pTrack->Eta();
-	      dWeight = pTrack->Weight();
+      dPhi = arrayPhi[i];
+      dPt  = arrayPt[i];
+      dEta = arrayEta[i];
+      dWeight = arrayWeight[i];
 
-        // determine Phi weight: (to be improved, I should here only access it + the treatment of gaps in the if statement)
-        if(phiWeights && nBinsPhi)
-        {
-          wPhi = phiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*nBinsPhi/TMath::TwoPi())));
-        }
-        // determine v'(pt) weight:
-        if(ptWeights && dBinWidthPt)
-        {
-          wPt=ptWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-dPtMin)/dBinWidthPt)));
-        }
-        // determine v'(eta) weight:
-        if(etaWeights && dBinWidthEta)
-        {
-          wEta=etaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-dEtaMin)/dBinWidthEta)));
-        }
+      // determine Phi weight: (to be improved, I should here only access it + the treatment of gaps in the if statement)
+      if(phiWeights && nBinsPhi)
+      {
+        wPhi = phiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*nBinsPhi/TMath::TwoPi())));
+      }
+      // determine v'(pt) weight:
+      if(ptWeights && dBinWidthPt)
+      {
+        wPt=ptWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-dPtMin)/dBinWidthPt)));
+      }
+      // determine v'(eta) weight:
+      if(etaWeights && dBinWidthEta)
+      {
+        wEta=etaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-dEtaMin)/dBinWidthEta)));
+      }
 
-        // building up the weighted Q-vector:
-        dQX += dWeight*wPhi*wPt*wEta*TMath::Cos(iOrder*dPhi);
-        dQY += dWeight*wPhi*wPt*wEta*TMath::Sin(iOrder*dPhi);
+      // building up the weighted Q-vector:
+      dQX += dWeight*wPhi*wPt*wEta*TMath::Cos(iOrder*dPhi);
+      dQY += dWeight*wPhi*wPt*wEta*TMath::Sin(iOrder*dPhi);
 
-        // weighted multiplicity:
-        sumOfWeights += dWeight*wPhi*wPt*wEta;
+      // weighted multiplicity:
+      sumOfWeights += dWeight*wPhi*wPt*wEta;
 
-      } // end of if (pTrack->InRPSelection())
-    } // end of if (pTrack)
-    else
-    {
-      cerr << "no particle!!!"<<endl;
-    }
+    } // end of if RP
   } // loop over particles
 
   vQ.Set(dQX,dQY);
@@ -868,6 +955,12 @@ AliFlowEventSimple::AliFlowEventSimple( TTree* inputTree,
   fRun(-1),
   fZNCM(0.),
   fZNAM(0.),
+  fArrayPhi(),
+  fArrayEta(),
+  fArrayPt(),
+  fArrayWeight(),
+  fArrayPOIbits(),
+  fTrackArraysDirty(kTRUE),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -943,6 +1036,7 @@ void AliFlowEventSimple::CloneTracks(Int_t n)
     }
   }
   SetUserModified();
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -955,6 +1049,7 @@ void AliFlowEventSimple::ResolutionPt(Double_t res)
     if (track) track->ResolutionPt(res);
   }
   SetUserModified();
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1005,6 +1100,7 @@ void AliFlowEventSimple::AddV1( Double_t v1 )
     }
   }
   SetUserModified();
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1022,6 +1118,7 @@ void AliFlowEventSimple::AddV2( Double_t v2 )
     }
   }
   SetUserModified();
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1039,6 +1136,7 @@ void AliFlowEventSimple::AddV3( Double_t v3 )
     }
   }
   SetUserModified();
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1056,6 +1154,7 @@ void AliFlowEventSimple::AddV4( Double_t v4 )
     }
   }
   SetUserModified();
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1073,6 +1172,7 @@ void AliFlowEventSimple::AddV5( Double_t v5 )
     }  
   }
   SetUserModified();
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1086,6 +1186,7 @@ void AliFlowEventSimple::AddFlow( Double_t v1, Double_t v2, Double_t v3, Double_
     if (track) track->AddFlow(v1,v2,v3,v4,v5,rp1,rp2,rp3,rp4,rp5,fAfterBurnerPrecision);
   }
   SetUserModified();
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1098,6 +1199,7 @@ void AliFlowEventSimple::AddFlow( Double_t v1, Double_t v2, Double_t v3, Double_
     if (track) track->AddFlow(v1,v2,v3,v4,v5,fMCReactionPlaneAngle, fAfterBurnerPrecision);
   }
   SetUserModified();
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1112,6 +1214,7 @@ void AliFlowEventSimple::AddV2( TF1* ptDepV2 )
     track->AddV2(v2, fMCReactionPlaneAngle, fAfterBurnerPrecision);
   }
   SetUserModified();
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1126,6 +1229,7 @@ void AliFlowEventSimple::AddV2( TF2* ptEtaDepV2 )
     track->AddV2(v2, fMCReactionPlaneAngle, fAfterBurnerPrecision);
   }
   SetUserModified();
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1148,6 +1252,7 @@ void AliFlowEventSimple::TagRP( const AliFlowTrackSimpleCuts* cuts )
     }
     track->SetForRPSelection(pass);
   }
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1170,6 +1275,7 @@ void AliFlowEventSimple::TagPOI( const AliFlowTrackSimpleCuts* cuts, Int_t poiTy
     }
     track->Tag(poiType,pass);
   }
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1202,6 +1308,7 @@ void AliFlowEventSimple::DefineDeadZone( Double_t etaMin,
       track->ResetPOItype();
     }
   }
+  fTrackArraysDirty=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -1219,6 +1326,7 @@ Int_t AliFlowEventSimple::CleanUpDeadTracks()
   fTrackCollection->Compress(); //clean up empty slots
   fNumberOfTracks-=ncleaned; //update number of tracks
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  fTrackArraysDirty=kTRUE;
   return ncleaned;
 }
 
@@ -1258,4 +1366,6 @@ void AliFlowEventSimple::ClearFast()
   fAfterBurnerPrecision = 0.001;
   fUserModified = kFALSE;
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  if (fMothersCollection) fMothersCollection->Clear(); //the mothers are tracks of the event
+  fTrackArraysDirty=kTRUE;
 }
@@ -16,6 +16,7 @@
 #ifndef ALIFLOWEVENTSIMPLE_H
 #define ALIFLOWEVENTSIMPLE_H
 
+#include <vector>
 #include "TObject.h"
 #include "TParameter.h"
 #include "TMath.h"
@@ -116,6 +117,18 @@ class AliFlowEventSimple: public TObject {
   void AddTrack( AliFlowTrackSimple* track ); 
   void TrackAdded();
   AliFlowTrackSimple* MakeNewTrack();
+  virtual AliFlowTrackSimple* ReuseTrack( Int_t i );
+  void PreallocateTracks( Int_t n );
+
+  //contiguous copy of the tracks (phi, eta, pt, weight, bit i set if tagged as POI type i, i.e. bit 0 = RP)
+  Int_t FillTrackArrays();
+  void  SetTrackArraysDirty()                       { fTrackArraysDirty=kTRUE; }
+  Int_t GetNTrackArrays() const                     { return fArrayPhi.size(); }
+  const Double_t* GetPhiArray() const               { return fArrayPhi.empty() ? NULL : &fArrayPhi[0]; }
+  const Double_t* GetEtaArray() const               { return fArrayEta.empty() ? NULL : &fArrayEta[0]; }
+  const Double_t* GetPtArray() const                { return fArrayPt.empty() ? NULL : &fArrayPt[0]; }
+  const Double_t* GetWeightArray() const            { return fArrayWeight.empty() ? NULL : &fArrayWeight[0]; }
+  const UInt_t*   GetPOIbitsArray() const           { return fArrayPOIbits.empty() ? NULL : &fArrayPOIbits[0]; }
  
   virtual AliFlowVector GetQ(Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
   virtual void Get2Qsub(AliFlowVector* Qarray, Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
@@ -189,12 +202,18 @@ class AliFlowEventSimple: public TObject {
   Double_t                fZNCM;                      // total energy from ZNC-C
   Double_t                fZNAM;                      // total energy from ZNC-A
   Double_t                fVtxPos[3];                 // Primary vertex position (x,y,z)
+  std::vector<Double_t>   fArrayPhi;                  //! phi of the tracks (FillTrackArrays)
+  std::vector<Double_t>   fArrayEta;                  //! eta of the tracks
+  std::vector<Double_t>   fArrayPt;                   //! pt of the tracks
+  std::vector<Double_t>   fArrayWeight;               //! weight of the tracks
+  std::vector<UInt_t>     fArrayPOIbits;              //! POI types of the tracks
+  Bool_t                  fTrackArraysDirty;          //! tracks added or changed since the last FillTrackArrays
  
  private:
   Int_t                   fNumberOfPOItypes;    // how many different flow particle types do we have? (RP,POI,POI_2,...)
   Int_t*                  fNumberOfPOIs;          //[fNumberOfPOItypes] number of tracks that have passed the POI selection
 
-  ClassDef(AliFlowEventSimple,6)
+  ClassDef(AliFlowEventSimple,7)
 };
 
 #endif
@@ -202,7 +202,8 @@ AliFlowEventSimple* AliFlowOnTheFlyEventGenerator::ConvertTClonesToFlowEvent(TCl
         pParticle = (TParticle*)event->At(i);           // get the particle 
         if (!pParticle) continue;                       // skip if empty slot (no particle)
         if (pParticle->GetNDaughters()!=0) continue;    // see if the particle has daughters (if so, reject it)      
-        AliFlowTrackSimple* pTrack = new AliFlowTrackSimple(pParticle);         // allocate space for the new flow track
+        AliFlowTrackSimple* pTrack = fFlowEvent->ReuseTrack(fFlowEvent->NumberOfTracks()); // reuse a track of the previous event if possible
+        pTrack->Set(pParticle);
         pTrack->SetWeight(pParticle->Pz());                                     // ugly hack: store pz here ...
         pTrack->SetID(pParticle->GetPdgCode());                                 // set pid code as id
         pTrack->SetForRPSelection(kTRUE);                                       // tag ALL particles as RP's, 
@@ -10,6 +10,7 @@
 #pragma link C++ class AliFlowVector+;
 #pragma link C++ class AliFlowTrackSimple+;
 #pragma link C++ class AliFlowEventSimple+;
+#pragma read sourceClass="AliFlowEventSimple" targetClass="AliFlowEventSimple" source="" version="[1-]" target="fTrackArraysDirty" code="{ fTrackArraysDirty = kTRUE; }"
 
 #pragma link C++ class AliStarTrack+;
 #pragma link C++ class AliStarEvent+;
@@ -97,6 +97,7 @@ AliAnalysisTaskFlowEvent::AliAnalysisTaskFlowEvent() :
   fQAList(NULL),
   fMinMult(0),
   fMaxMult(10000000),
+  fNumberOfPreallocatedTracks(1000),
   fMinA(-1.0),
   fMaxA(-0.01),
   fMinB(0.01),
@@ -158,6 +159,7 @@ AliAnalysisTaskFlowEvent::AliAnalysisTaskFlowEvent(const char *name, TString RPt
   fQAList(NULL),
   fMinMult(0),
   fMaxMult(10000000),
+  fNumberOfPreallocatedTracks(1000),
   fMinA(-1.0),
   fMaxA(-0.01),
   fMinB(0.01),
@@ -289,6 +291,8 @@ void AliAnalysisTaskFlowEvent::UserCreateOutputObjects()
   cc->SetHistWeightvsPhiMin(fHistWeightvsPhiMin);
 
   fFlowEvent = new AliFlowEvent(10000);
+  //the event is refilled for every input event, reusing its tracks
+  fFlowEvent->PreallocateTracks(fNumberOfPreallocatedTracks);
 
   if (fQAon)
   {
@@ -337,7 +341,7 @@ void AliAnalysisTaskFlowEvent::UserExec(Option_t *)
 
     //then make the event
     fFlowEvent->Fill( fCutsRP, fCutsPOI );
-    //fFlowEvent = new AliFlowEvent( fCutsRP, fCutsPOI );
+    //fFlowEvent->Fill( fCutsRP, fCutsPOI );
 
     //    if (myESD)
     fFlowEvent->SetReferenceMultiplicity(fCutsEvent->GetReferenceMultiplicity(InputEvent(),mcEvent));
@@ -371,8 +375,8 @@ void AliAnalysisTaskFlowEvent::UserExec(Option_t *)
     {
       AliWarning("Event does not pass multiplicity cuts"); return;
     }
-    //make event
-    fFlowEvent = new AliFlowEvent(mcEvent,fCFManager1,fCFManager2);
+    //refill the event
+    fFlowEvent->Fill(mcEvent,fCFManager1,fCFManager2);
   }
 
   // Make the FlowEvent for ESD input
@@ -398,18 +402,18 @@ void AliAnalysisTaskFlowEvent::UserExec(Option_t *)
       AliWarning("Event does not pass multiplicity cuts"); return;
     }
 
-    //make event
+    //refill the event
     if (fRPType == "Global") {
-      fFlowEvent = new AliFlowEvent(myESD,fCFManager1,fCFManager2);
+      fFlowEvent->Fill(myESD,fCFManager1,fCFManager2);
     }
     else if (fRPType == "TPCOnly") {
-      fFlowEvent = new AliFlowEvent(myESD,fCFManager2,kFALSE);
+      fFlowEvent->Fill(myESD,fCFManager2,kFALSE);
     }
     else if (fRPType == "TPCHybrid") {
-      fFlowEvent = new AliFlowEvent(myESD,fCFManager2,kTRUE);
+      fFlowEvent->Fill(myESD,fCFManager2,kTRUE);
     }
     else if (fRPType == "Tracklet"){
-      fFlowEvent = new AliFlowEvent(myESD,myTracklets,fCFManager2);
+      fFlowEvent->Fill(myESD,myTracklets,fCFManager2);
     }
     else if (fRPType == "FMD"){
       TList* dataFMD = dynamic_cast<TList*>(GetInputData(availableINslot++));
@@ -422,10 +426,10 @@ void AliAnalysisTaskFlowEvent::UserExec(Option_t *)
         cout<< "No histFMD"<<endl;
         return;
       }
-      fFlowEvent = new AliFlowEvent(myESD,histFMD,fCFManager2);
+      fFlowEvent->Fill(myESD,histFMD,fCFManager2);
     }
     else if (fRPType == "PMD"){
-      fFlowEvent = new AliFlowEvent(myESD,pmdtracks,fCFManager2);
+      fFlowEvent->Fill(myESD,pmdtracks,fCFManager2);
     }
     else return;
     
@@ -465,14 +469,14 @@ void AliAnalysisTaskFlowEvent::UserExec(Option_t *)
       AliWarning("Event does not pass multiplicity cuts"); return;
     }
 
-    //make event
+    //refill the event
     if (fAnalysisType == "ESDMCkineESD")
     {
-      fFlowEvent = new AliFlowEvent(myESD, mcEvent, AliFlowEvent::kESDkine, fCFManager1, fCFManager2 );
+      fFlowEvent->Fill(myESD, mcEvent, AliFlowEvent::kESDkine, fCFManager1, fCFManager2 );
     }
     else if (fAnalysisType == "ESDMCkineMC")
     {
-      fFlowEvent = new AliFlowEvent(myESD, mcEvent, AliFlowEvent::kMCkine, fCFManager1, fCFManager2 );
+      fFlowEvent->Fill(myESD, mcEvent, AliFlowEvent::kMCkine, fCFManager1, fCFManager2 );
     }
     if (!fFlowEvent) return;
     // if monte carlo event get reaction plane from monte carlo (depends on generator)
@@ -489,7 +493,7 @@ void AliAnalysisTaskFlowEvent::UserExec(Option_t *)
       return;
     }
     AliInfo(Form("AOD has %d tracks", myAOD->GetNumberOfTracks()));
-    fFlowEvent = new AliFlowEvent(myAOD);
+    fFlowEvent->Fill(myAOD);
   }
 
   //inject candidates
@@ -47,6 +47,9 @@ class AliAnalysisTaskFlowEvent : public AliAnalysisTaskSE {
   void    SetMaxMult(Int_t multmax)    {this->fMaxMult = multmax; }
   Int_t   GetMaxMult() const           {return this->fMaxMult; }
 
+  void    SetNumberOfPreallocatedTracks(Int_t n) {this->fNumberOfPreallocatedTracks = n; }
+  Int_t   GetNumberOfPreallocatedTracks() const  {return this->fNumberOfPreallocatedTracks; }
+
   void SetSubeventEtaRange(Double_t minA, Double_t maxA, Double_t minB, Double_t maxB)
     {this->fMinA = minA; this->fMaxA = maxA; this->fMinB = minB; this->fMaxB = maxB; }
   Double_t GetMinA() const {return this->fMinA;}
@@ -127,6 +130,7 @@ class AliAnalysisTaskFlowEvent : public AliAnalysisTaskSE {
   TList*        fQAList;             // QA histogram list
   Int_t         fMinMult;           // Minimum multiplicity from tracks selected using CORRFW
   Int_t         fMaxMult;           // Maximum multiplicity from tracks selected using CORRFW 
+  Int_t         fNumberOfPreallocatedTracks; // tracks allocated in the flow event before the first event
   Double_t      fMinA;              // Minimum of eta range for subevent A
   Double_t      fMaxA;              // Maximum of eta range for subevent A
   Double_t      fMinB;              // Minimum of eta range for subevent B
@@ -184,7 +188,7 @@ class AliAnalysisTaskFlowEvent : public AliAnalysisTaskSE {
   TRandom3* fMyTRandom3;     // TRandom3 generator
   // end afterburner
   
-  ClassDef(AliAnalysisTaskFlowEvent, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFlowEvent, 2); // example of analysis
 };
 
 #endif
@@ -251,7 +251,16 @@ AliFlowEvent::AliFlowEvent( const AliMCEvent* anInput,
      fQxcvsV0[i] = 0x0;
      fQycvsV0[i] = 0x0;
   }
+  Fill(anInput, rpCFManager, poiCFManager);
+}
 
+//-----------------------------------------------------------------------
+void AliFlowEvent::Fill( const AliMCEvent* anInput,
+                         const AliCFManager* rpCFManager,
+                         const AliCFManager* poiCFManager)
+{
+  //refill the event, reusing the tracks of the previous one (see ClearFast)
+  ClearFast();
   //Fills the event from the MC kinematic information
   Int_t iNumberOfInputTracks = anInput->GetNumberOfTracks() ;
 
@@ -272,7 +281,8 @@ AliFlowEvent::AliFlowEvent( const AliMCEvent* anInput,
     }
     if (!(rpOK||poiOK)) continue;
 
-    AliFlowTrack* pTrack = new AliFlowTrack(pParticle);
+    AliFlowTrack* pTrack = ReuseTrack(fNumberOfTracks);
+    pTrack->Set(pParticle);
     pTrack->SetSource(AliFlowTrack::kFromMC);
 
     if (rpOK && rpCFManager)
@@ -314,6 +324,16 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
      fQxcvsV0[i] = 0x0;
      fQycvsV0[i] = 0x0;
   }
+  Fill(anInput, rpCFManager, poiCFManager);
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEvent::Fill( const AliESDEvent* anInput,
+                         const AliCFManager* rpCFManager,
+                         const AliCFManager* poiCFManager )
+{
+  //refill the event, reusing the tracks of the previous one (see ClearFast)
+  ClearFast();
   //set run number
   if(anInput->GetRunNumber()) fRun = anInput->GetRunNumber();
  
@@ -338,8 +358,9 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
     }
     if (!(rpOK || poiOK)) continue;
 
-    //make new AliFLowTrack
-    AliFlowTrack* pTrack = new AliFlowTrack(pParticle);
+    //take a track of the event
+    AliFlowTrack* pTrack = ReuseTrack(fNumberOfTracks);
+    pTrack->Set(pParticle);
     pTrack->SetSource(AliFlowTrack::kFromESD);
 
     //marking the particles used for int. flow:
@@ -382,7 +403,16 @@ AliFlowEvent::AliFlowEvent( const AliAODEvent* anInput,
      fQxcvsV0[i] = 0x0;
      fQycvsV0[i] = 0x0;
   }
+  Fill(anInput, rpCFManager, poiCFManager);
+}
 
+//-----------------------------------------------------------------------
+void AliFlowEvent::Fill( const AliAODEvent* anInput,
+                         const AliCFManager* rpCFManager,
+                         const AliCFManager* poiCFManager)
+{
+  //refill the event, reusing the tracks of the previous one (see ClearFast)
+  ClearFast();
   //set run number
   if(anInput->GetRunNumber()) fRun = anInput->GetRunNumber();
  
@@ -407,8 +437,9 @@ AliFlowEvent::AliFlowEvent( const AliAODEvent* anInput,
     }
     if (!(rpOK || poiOK)) continue;
 
-    //make new AliFlowTrack
-    AliFlowTrack* pTrack = new AliFlowTrack(pParticle);
+    //take a track of the event
+    AliFlowTrack* pTrack = ReuseTrack(fNumberOfTracks);
+    pTrack->Set(pParticle);
     pTrack->SetSource(AliFlowTrack::kFromAOD);
 
     if (rpOK /* && rpCFManager */ ) // to be fixed - with CF managers uncommented only empty events (NULL in header files)
@@ -448,7 +479,6 @@ AliFlowEvent::AliFlowEvent( const AliAODEvent* anInput,
   //  cout<<"Event does not pass multiplicity cuts"<<endl;
   //  return 0;
   //}
-
 }
 
 //-----------------------------------------------------------------------
@@ -476,6 +506,18 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
      fQxcvsV0[i] = 0x0;
      fQycvsV0[i] = 0x0;
   }
+  Fill(anInput, anInputMc, anOption, rpCFManager, poiCFManager);
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEvent::Fill( const AliESDEvent* anInput,
+                         const AliMCEvent* anInputMc,
+                         KineSource anOption,
+                         const AliCFManager* rpCFManager,
+                         const AliCFManager* poiCFManager )
+{
+  //refill the event, reusing the tracks of the previous one (see ClearFast)
+  ClearFast();
   //fills the event with tracks from the ESD and kinematics from the MC info via the track label
   if (anOption==kNoKine)
   {
@@ -530,15 +572,17 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
 
     if (!(rpOK || poiOK)) continue;
 
-    //make new AliFlowTrack
+    //take a track of the event
     AliFlowTrack* pTrack = NULL;
     if(anOption == kESDkine)   //take the PID from the MC & the kinematics from the ESD
     {
-      pTrack = new AliFlowTrack(pParticle);
+      pTrack = ReuseTrack(fNumberOfTracks);
+      pTrack->Set(pParticle);
     }
     else if (anOption == kMCkine)   //take the PID and kinematics from the MC
     {
-      pTrack = new AliFlowTrack(pMcParticle);
+      pTrack = ReuseTrack(fNumberOfTracks);
+      pTrack->Set(pMcParticle);
     }
 
     if (rpOK && rpCFManager)
@@ -580,7 +624,16 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
      fQxcvsV0[i] = 0x0;
      fQycvsV0[i] = 0x0;
   }
+  Fill(anInput, anInputTracklets, poiCFManager);
+}
 
+//-----------------------------------------------------------------------
+void AliFlowEvent::Fill( const AliESDEvent* anInput,
+                         const AliMultiplicity* anInputTracklets,
+                         const AliCFManager* poiCFManager )
+{
+  //refill the event, reusing the tracks of the previous one (see ClearFast)
+  ClearFast();
   //Select the particles of interest from the ESD
   Int_t iNumberOfInputTracks = anInput->GetNumberOfTracks() ;
 
@@ -598,8 +651,9 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
 	}
       if (!poiOK) continue;
       
-      //make new AliFLowTrack
-      AliFlowTrack* pTrack = new AliFlowTrack(pParticle);
+      //take a track of the event
+      AliFlowTrack* pTrack = ReuseTrack(fNumberOfTracks);
+      pTrack->Set(pParticle);
           
       //marking the particles used for the particle of interest (POI) selection:
       if(poiOK && poiCFManager)
@@ -623,8 +677,8 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
     // calculate eta
     Float_t etaTr = -TMath::Log(TMath::Tan(thetaTr/2.));
     
-    //make new AliFLowTrackSimple
-    AliFlowTrack* pTrack = new AliFlowTrack();
+    //take a track of the event
+    AliFlowTrack* pTrack = ReuseTrack(fNumberOfTracks);
     pTrack->SetPt(0.0);
     pTrack->SetEta(etaTr);
     pTrack->SetPhi(phiTr);
@@ -636,7 +690,6 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
     //Add the track to the flowevent
     AddTrack(pTrack);
   }
-
 }
 
 //-----------------------------------------------------------------------
@@ -662,6 +715,16 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* esd,
      fQxcvsV0[i] = 0x0;
      fQycvsV0[i] = 0x0;
   }
+  Fill(esd, poiCFManager, hybrid);
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEvent::Fill( const AliESDEvent* esd,
+                         const AliCFManager* poiCFManager,
+                         Bool_t hybrid)
+{
+  //refill the event, reusing the tracks of the previous one (see ClearFast)
+  ClearFast();
   //Select the particles of interest from the ESD
   Int_t iNumberOfInputTracks = esd->GetNumberOfTracks() ;
 
@@ -715,8 +778,9 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* esd,
 
       }
 
-      //make new AliFLowTrack
-      AliFlowTrack* pTrack = new AliFlowTrack(pParticle);
+      //take a track of the event
+      AliFlowTrack* pTrack = ReuseTrack(fNumberOfTracks);
+      pTrack->Set(pParticle);
 
       pTrack->SetSource(AliFlowTrack::kFromESD);
 
@@ -736,7 +800,6 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* esd,
       AddTrack(pTrack);
 
     }//end of while (itrkN < iNumberOfInputTracks)
-
 }
 
 //-----------------------------------------------------------------------
@@ -762,7 +825,16 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
        fQxcvsV0[i] = 0x0;
        fQycvsV0[i] = 0x0;
     }
+  Fill(anInput, anInputFMDhist, poiCFManager);
+}
 
+//-----------------------------------------------------------------------
+void AliFlowEvent::Fill( const AliESDEvent* anInput,
+                         const TH2F* anInputFMDhist,
+                         const AliCFManager* poiCFManager )
+{
+  //refill the event, reusing the tracks of the previous one (see ClearFast)
+  ClearFast();
   //Select the particles of interest from the ESD
   Int_t iNumberOfInputTracks = anInput->GetNumberOfTracks() ;
 
@@ -780,8 +852,9 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
 	}
       if (!poiOK) continue;
  
-      //make new AliFLowTrack
-      AliFlowTrack* pTrack = new AliFlowTrack(pParticle);
+      //take a track of the event
+      AliFlowTrack* pTrack = ReuseTrack(fNumberOfTracks);
+      pTrack->Set(pParticle);
           
       //marking the particles used for the particle of interest (POI) selection:
       if(poiOK && poiCFManager)
@@ -806,8 +879,8 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
       Double_t weightFMD = anInputFMDhist->GetBinContent(iEta,iPhi);
     
       if (weightFMD > 0.0) { //do not add empty bins
-	//make new AliFLowTrackSimple
-	AliFlowTrack* pTrack = new AliFlowTrack();
+	//take a track of the event
+	AliFlowTrack* pTrack = ReuseTrack(fNumberOfTracks);
 	pTrack->SetPt(0.0);
 	pTrack->SetEta(etaFMD);
 	pTrack->SetPhi(phiFMD);
@@ -823,7 +896,6 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
       }
     }
   }
-
 }
 
 //-----------------------------------------------------------------------
@@ -852,6 +924,7 @@ void AliFlowEvent::FindDaughters(Bool_t keepDaughtersInRPselection)
       }
     }
   }
+  SetTrackArraysDirty();
 }
 
 //-----------------------------------------------------------------------
@@ -1018,6 +1091,7 @@ void AliFlowEvent::InsertTrack(AliFlowTrack *track) {
   // adds a flow track at the end of the container
   AliFlowTrack *pTrack = ReuseTrack( fNumberOfTracks++ );
   *pTrack = *track;
+  SetTrackArraysDirty();
   if (track->GetNDaughters()>0)
   {
     fMothersCollection->Add(pTrack);
@@ -1096,7 +1170,16 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
      fQxcvsV0[i] = 0x0;
      fQycvsV0[i] = 0x0;
   }
-  
+  Fill(anInput, pmdtracks, poiCFManager);
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEvent::Fill( const AliESDEvent* anInput,
+                         const AliESDPmdTrack *pmdtracks,
+                         const AliCFManager* poiCFManager )
+{
+  //refill the event, reusing the tracks of the previous one (see ClearFast)
+  ClearFast();
   Float_t GetPmdEta(Float_t xPos, Float_t yPos, Float_t zPos);
   Float_t GetPmdPhi(Float_t xPos, Float_t yPos);
   //Select the particles of interest from the ESD
@@ -1115,8 +1198,9 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
 	}
       if (!poiOK) continue;
       
-      //make new AliFLowTrack
-      AliFlowTrack* pTrack = new AliFlowTrack(pParticle);
+      //take a track of the event
+      AliFlowTrack* pTrack = ReuseTrack(fNumberOfTracks);
+      pTrack->Set(pParticle);
       
       //marking the particles used for the particle of interest (POI) selection:
       if(poiOK && poiCFManager)
@@ -1146,8 +1230,8 @@ AliFlowEvent::AliFlowEvent( const AliESDEvent* anInput,
     //Float_t pid   = pmdtracks->GetClusterPID();
     Float_t etacls = GetPmdEta(clsX,clsY,clsZ);
     Float_t phicls = GetPmdPhi(clsX,clsY);
-    //make new AliFLowTrackSimple
-    AliFlowTrack* pTrack = new AliFlowTrack();
+    //take a track of the event
+    AliFlowTrack* pTrack = ReuseTrack(fNumberOfTracks);
     //if(det == 0){ //selecting preshower plane only
     if(det == 0 && adc > 270 && ncell > 1){ //selecting preshower plane only
       //pTrack->SetPt(adc);//cluster adc
@@ -13,7 +13,6 @@
 #define ALIFLOWEVENT_H
 
 class AliFlowTrackCuts;
-class AliFlowTrack;
 class AliCFManager;
 class AliVEvent;
 class AliMCEvent;
@@ -28,6 +27,7 @@ class TH2F;
 class TArrayD;
 
 #include "AliFlowEventSimple.h"
+#include "AliFlowTrack.h"
 
 class AliFlowEvent: public AliFlowEventSimple {
 public:
@@ -69,6 +69,33 @@ public:
                 const AliESDPmdTrack *pmdtracks,
                 const AliCFManager* poiCFManager );
   //pmd
+  //refill the event from the inputs of the constructors above, reusing the tracks
+  void Fill( const AliMCEvent* anInput,
+             const AliCFManager* rpCFManager=NULL,
+             const AliCFManager* poiCFManager=NULL );
+  void Fill( const AliESDEvent* anInput,
+             const AliCFManager* rpCFManager=NULL,
+             const AliCFManager* poiCFManager=NULL );
+  void Fill( const AliAODEvent* anInput,
+             const AliCFManager* rpCFManager=NULL,
+             const AliCFManager* poiCFManager=NULL );
+  void Fill( const AliESDEvent* anInput,
+             const AliCFManager* poiCFManager,
+             Bool_t hybrid );
+  void Fill( const AliESDEvent* anInput,
+             const AliMCEvent* anInputMc,
+             KineSource anOption=kNoKine,
+             const AliCFManager* rpCFManager=NULL,
+             const AliCFManager* poiCFManager=NULL );
+  void Fill( const AliESDEvent* anInput,
+             const AliMultiplicity* anInputTracklets,
+             const AliCFManager* poiCFManager );
+  void Fill( const AliESDEvent* anInput,
+             const TH2F* anInputFMDhist,
+             const AliCFManager* poiCFManager );
+  void Fill( const AliESDEvent* anInput,
+             const AliESDPmdTrack *pmdtracks,
+             const AliCFManager* poiCFManager );
   //end of deprecated
 
   AliFlowEvent( AliFlowTrackCuts* rpCuts,
@@ -85,6 +112,7 @@ public:
   AliFlowTrack* GetTrack( Int_t i );
 
   void InsertTrack(AliFlowTrack*);
+  virtual AliFlowTrack* ReuseTrack( Int_t i);
 
   virtual AliFlowVector GetQ(Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
   virtual void Get2Qsub(AliFlowVector* Qarray, Int_t n = 2, TList *weightsList = 0x0, Bool_t usePhiWeights = 0x0, Bool_t usePtWeights = 0x0, Bool_t useEtaWeights = 0x0);
@@ -97,9 +125,6 @@ public:
   virtual void ClearFast();
   virtual void ClearCachedRun();
 
-protected:
-  AliFlowTrack* ReuseTrack( Int_t i);
-
 private:
   Int_t         fApplyRecentering;      // apply recentering of q-vectors? 2010 is 10h style, 2011 is 11h style
   Bool_t        fDivSigma;              // divide by st.dev. after recentering?
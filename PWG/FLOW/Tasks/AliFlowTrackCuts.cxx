@@ -2132,12 +2132,9 @@ AliFlowTrack* AliFlowTrackCuts::FillFlowTrackGeneric(TObjArray* trackCollection,
   }
   
   if (FillFlowTrackGeneric(flowtrack)) return flowtrack;
-  else 
-  {
-    trackCollection->RemoveAt(trackIndex);
-    delete flowtrack;
-    return NULL;
-  }
+  //if not, the track is left in the collection (after the last track of the event)
+  //and is reused for the next particle
+  return NULL;
 }
 
 //-----------------------------------------------------------------------
@@ -2209,12 +2206,9 @@ AliFlowTrack* AliFlowTrackCuts::FillFlowTrackVParticle(TObjArray* trackCollectio
   }
 
   if (FillFlowTrackVParticle(flowtrack)) return flowtrack;
-  else
-  {
-    trackCollection->RemoveAt(trackIndex);
-    delete flowtrack;
-    return NULL;
-  }
+  //if not, the track is left in the collection (after the last track of the event)
+  //and is reused for the next particle
+  return NULL;
 }
 
 //-----------------------------------------------------------------------
@@ -8,6 +8,7 @@
 #include "AliStack.h"
 #include "AliGenPythiaEventHeader.h"
 
+#include "AliEventShapeTools.h"
 #include "AliEventClassifierSpherocity.h"
 #include "AliIsPi0PhysicalPrimary.h"
 
@@ -17,7 +18,8 @@ ClassImp(AliEventClassifierSpherocity)
 
 AliEventClassifierSpherocity::AliEventClassifierSpherocity(const char* name, const char* title,
 					     TList *taskOutputList)
-  : AliEventClassifierBase(name, title, taskOutputList)
+  : AliEventClassifierBase(name, title, taskOutputList),
+    fUseExactSpherocity(kFALSE)
 {
   fExpectedMinValue = 0;
   fExpectedMaxValue = 1;
@@ -42,50 +44,30 @@ Bool_t AliEventClassifierSpherocity::TrackPassesSelection(AliMCParticle* track,
 }
 
 void AliEventClassifierSpherocity::CalculateClassifierValue(AliMCEvent *event, AliStack *stack) {
-  // This implementation is adapted from PWGLF/SPECTRA/Spherocity/AliTransverseEventShape.cxx
+  // This implementation is adapted from PWG/Tools/AliEventShapeTools.cxx
+  // The selected tracks are read once; the trial axes (or the exact minimisation)
+  // then run on their px, py arrays
   fClassifierValue = 0.0;
 
-  Float_t sumRatioSquare = 0;
-  Float_t minimalSumRatioSquare = 2;
-  
-  // Step size in phi unit vector used to find m spherocity
-  Float_t phiStepSize = 0.1;
-
-  // Computing total pt
-  Float_t sumapt = 0;
+  std::vector<Double_t> px;
+  std::vector<Double_t> py;
   Int_t ntracks = event->GetNumberOfTracks();
+  px.reserve(ntracks);
+  py.reserve(ntracks);
   for (Int_t iTrack = 0; iTrack < ntracks; iTrack++) {
     AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
     if (!TrackPassesSelection(track, stack, iTrack)) continue;
-    sumapt += track->Pt();
-  }
-  
-  // Getting thrust
-  for(Int_t i = 0; i < 360/(phiStepSize); ++i){
-    Float_t numerator = 0;
-    Float_t phiparam  = 0;
-    Float_t nx = 0;
-    Float_t ny = 0;
-    phiparam=((TMath::Pi()) * i * phiStepSize) / 180; // parametrization of the angle
-    nx = TMath::Cos(phiparam);            // x component of an unitary vector n
-    ny = TMath::Sin(phiparam);            // y component of an unitary vector n
-    for(Int_t iTrack = 0; iTrack < ntracks; ++iTrack){
-      AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
-      if (!TrackPassesSelection(track, stack, iTrack)) continue;
-      
-      Float_t pxA = track->Pt() * TMath::Cos(track->Phi());
-      Float_t pyA = track->Pt() * TMath::Sin(track->Phi());
-      //product between p projection in XY plane and the unitary vector
-      numerator += TMath::Abs( ny * pxA - nx * pyA );
-    }
-    
-    sumRatioSquare = TMath::Power((numerator / sumapt), 2);
-    if(sumRatioSquare < minimalSumRatioSquare)  //minimization of pFull
-      {
-	minimalSumRatioSquare = sumRatioSquare;
-      }
+    px.push_back(track->Pt() * TMath::Cos(track->Phi()));
+    py.push_back(track->Pt() * TMath::Sin(track->Phi()));
   }
+  if (px.empty()) return;
+
+  // Step size in phi unit vector used to find m spherocity
+  Float_t phiStepSize = 0.1;
 
   // Compute the final spherocity:
-  fClassifierValue = (minimalSumRatioSquare * TMath::Pi() * TMath::Pi()) / 4.0;
+  if (fUseExactSpherocity)
+    fClassifierValue = AliEventShapeTools::Spherocity(px.size(), px.data(), py.data());
+  else
+    fClassifierValue = AliEventShapeTools::SpherocityGridScan(px.size(), px.data(), py.data(), phiStepSize);
 }
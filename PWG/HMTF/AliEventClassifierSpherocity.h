@@ -6,16 +6,21 @@
 class AliEventClassifierSpherocity : public AliEventClassifierBase {
  public:
   AliEventClassifierSpherocity()
-    : AliEventClassifierBase() {}
+    : AliEventClassifierBase(), fUseExactSpherocity(kFALSE) {}
   AliEventClassifierSpherocity(const char* name, const char* title,
 			TList *taskOutputList);
   virtual ~AliEventClassifierSpherocity() {}
 
+  // Minimise exactly over the track directions instead of scanning trial axes in steps of 0.1 deg
+  void SetUseExactSpherocity(Bool_t exact = kTRUE) { fUseExactSpherocity = exact; }
+
  private:
   Bool_t TrackPassesSelection(AliMCParticle* track, AliStack *stack, Int_t iTrack);
   void CalculateClassifierValue(AliMCEvent *event, AliStack *stack);
+
+  Bool_t fUseExactSpherocity;  // use the exact minimisation of AliEventShapeTools
   
-  ClassDef(AliEventClassifierSpherocity, 1);
+  ClassDef(AliEventClassifierSpherocity, 2);
 };
 
 #endif
@@ -19,6 +19,7 @@
 
 #include "AliParticleContainer.h"
 #include "AliClusterContainer.h"
+#include "AliEmcalJetConstituentIndex.h"
 
 /// \cond CLASSIMP
 ClassImp(AliEmcalJet);
@@ -62,7 +63,9 @@ AliEmcalJet::AliEmcalJet() :
   fHasGhost(kFALSE),
   fGhosts(),
   fJetShapeProperties(0),
-  fJetAcceptanceType(0)
+  fJetAcceptanceType(0),
+  fConstituentIndex(0),
+  fConstituentIndexPos(-1)
 {
   fClosestJets[0] = 0;
   fClosestJets[1] = 0;
@@ -112,7 +115,9 @@ AliEmcalJet::AliEmcalJet(Double_t px, Double_t py, Double_t pz) :
   fHasGhost(kFALSE),
   fGhosts(),
   fJetShapeProperties(0),
-  fJetAcceptanceType(0)
+  fJetAcceptanceType(0),
+  fConstituentIndex(0),
+  fConstituentIndexPos(-1)
 {
   if (fPt != 0) {
     fPhi = TVector2::Phi_0_2pi(TMath::ATan2(py, px));
@@ -167,7 +172,9 @@ AliEmcalJet::AliEmcalJet(Double_t pt, Double_t eta, Double_t phi, Double_t m) :
   fHasGhost(kFALSE),
   fGhosts(),
   fJetShapeProperties(0),
-  fJetAcceptanceType(0)
+  fJetAcceptanceType(0),
+  fConstituentIndex(0),
+  fConstituentIndexPos(-1)
 {
   fPhi = TVector2::Phi_0_2pi(fPhi);
 
@@ -216,7 +223,9 @@ AliEmcalJet::AliEmcalJet(const AliEmcalJet& jet) :
   fHasGhost(jet.fHasGhost),
   fGhosts(jet.fGhosts),
   fJetShapeProperties(0),
-  fJetAcceptanceType(jet.fJetAcceptanceType)
+  fJetAcceptanceType(jet.fJetAcceptanceType),
+  fConstituentIndex(0),
+  fConstituentIndexPos(-1)
 {
   // Copy constructor.
   fClosestJets[0]     = jet.fClosestJets[0];
@@ -285,6 +294,8 @@ AliEmcalJet& AliEmcalJet::operator=(const AliEmcalJet& jet)
       fJetShapeProperties = new AliEmcalJetShapeProperties(*(jet.fJetShapeProperties));
     }
     fJetAcceptanceType  = jet.fJetAcceptanceType;
+    fConstituentIndex   = 0;
+    fConstituentIndexPos = -1;
   }
 
   return *this;
@@ -380,6 +391,7 @@ void AliEmcalJet::SortConstituents()
 {
   std::sort(fClusterIDs.GetArray(), fClusterIDs.GetArray() + fClusterIDs.GetSize());
   std::sort(fTrackIDs.GetArray(), fTrackIDs.GetArray() + fTrackIDs.GetSize());
+  fConstituentIndex = 0;
 }
 
 /**
@@ -412,6 +424,12 @@ Double_t AliEmcalJet::DeltaR(const AliVParticle* part) const
  */
 std::vector<int> AliEmcalJet::GetPtSortedTrackConstituentIndexes(TClonesArray* tracks) const
 {
+  const AliEmcalJetConstituentIndex* index = GetConstituentIndex();
+  if (index) {
+    const Int_t* sorted = index->GetPtSortedTrackPositions(fConstituentIndexPos, tracks);
+    if (sorted) return std::vector<int>(sorted, sorted + GetNumberOfTracks());
+  }
+
   typedef std::pair<Double_t, Int_t> ptidx_pair;
 
   // Create vector for Pt sorting
@@ -434,6 +452,9 @@ std::vector<int> AliEmcalJet::GetPtSortedTrackConstituentIndexes(TClonesArray* t
   // populating the return object with indexes of sorted tracks
   for (auto it : pair_list) index_sorted_list.push_back(it.second);
 
+  // keep the result for the rest of the event (only if all the constituents were found)
+  if (index) index->SetPtSortedTrackPositions(fConstituentIndexPos, tracks, index_sorted_list);
+
   return index_sorted_list;
 }
 
@@ -531,6 +552,13 @@ void AliEmcalJet::ResetMatching()
  */
 Int_t AliEmcalJet::ContainsTrack(Int_t it) const
 {
+  const AliEmcalJetConstituentIndex* index = GetConstituentIndex();
+  if (index && index->HasUniqueTracks()) {
+    Int_t pos = -1;
+    if (index->GetJetOfTrack(it, pos) != fConstituentIndexPos) return -1;
+    return pos;
+  }
+
   for (Int_t i = 0; i < fTrackIDs.GetSize(); i++) {
     if (it == fTrackIDs[i]) return i;
   }
@@ -544,6 +572,13 @@ Int_t AliEmcalJet::ContainsTrack(Int_t it) const
  */
 Int_t AliEmcalJet::ContainsCluster(Int_t ic) const
 {
+  const AliEmcalJetConstituentIndex* index = GetConstituentIndex();
+  if (index && index->HasUniqueClusters()) {
+    Int_t pos = -1;
+    if (index->GetJetOfCluster(ic, pos) != fConstituentIndexPos) return -1;
+    return pos;
+  }
+
   for (Int_t i = 0; i < fClusterIDs.GetSize(); i++) {
     if (ic == fClusterIDs[i]) return i;
   }
@@ -655,6 +690,19 @@ void AliEmcalJet::AddGhost(const Double_t dPx, const Double_t dPy, const Double_
   return;
 }
 
+/**
+ * Get the per-event constituent index of the jet collection, built by AliJetContainer
+ * (see AliEmcalJetConstituentIndex). The index is returned only if it was built for
+ * the current content of this jet.
+ * @return Pointer to the constituent index, or null if not available
+ */
+const AliEmcalJetConstituentIndex* AliEmcalJet::GetConstituentIndex() const
+{
+  if (!fConstituentIndex) return 0;
+  if (!fConstituentIndex->IsConsistent(this, fConstituentIndexPos)) return 0;
+  return fConstituentIndex;
+}
+
 /**
  * Clear this object: remove matching information, jet constituents, ghosts
  */
@@ -662,6 +710,7 @@ void AliEmcalJet::Clear(Option_t */*option*/)
 {
   fClusterIDs.Set(0);
   fTrackIDs.Set(0);
+  fConstituentIndex = 0;
   fClosestJets[0] = 0;
   fClosestJets[1] = 0;
   fClosestJetsDist[0] = 0;
@@ -21,6 +21,8 @@
 
 #include "AliEmcalJetShapeProperties.h"
 
+class AliEmcalJetConstituentIndex;
+
 /**
  * @class AliEmcalJet
  * @brief Represent a jet reconstructed using the EMCal jet framework
@@ -190,8 +192,8 @@ class AliEmcalJet : public AliVParticle
   void              SetMaxNeutralPt(Double32_t t)      { fMaxNPt  = t;                     }
   void              SetMaxChargedPt(Double32_t t)      { fMaxCPt  = t;                     }
   void              SetNEF(Double_t nef)               { fNEF     = nef;                   }
-  void              SetNumberOfClusters(Int_t n)       { fClusterIDs.Set(n);               }
-  void              SetNumberOfTracks(Int_t n)         { fTrackIDs.Set(n);                 }
+  void              SetNumberOfClusters(Int_t n)       { fClusterIDs.Set(n); fConstituentIndex = 0; }
+  void              SetNumberOfTracks(Int_t n)         { fTrackIDs.Set(n); fConstituentIndex = 0;   }
   void              SetNumberOfCharged(Int_t n)        { fNch = n;                         }
   void              SetNumberOfNeutrals(Int_t n)       { fNn = n;                          }
   void              SetMCPt(Double_t p)                { fMCPt = p;                        }
@@ -199,10 +201,14 @@ class AliEmcalJet : public AliVParticle
   void              SetPtEmc(Double_t pt)              { fPtEmc          = pt;             }
   void              SetPtSub(Double_t ps)              { fPtSub          = ps;             }
   void              SetPtSubVect(Double_t ps)          { fPtSubVect      = ps;             }
-  void              AddClusterAt(Int_t clus, Int_t idx){ fClusterIDs.AddAt(clus, idx);     }
-  void              AddTrackAt(Int_t track, Int_t idx) { fTrackIDs.AddAt(track, idx);      }
+  void              AddClusterAt(Int_t clus, Int_t idx){ fClusterIDs.AddAt(clus, idx); fConstituentIndex = 0; }
+  void              AddTrackAt(Int_t track, Int_t idx) { fTrackIDs.AddAt(track, idx); fConstituentIndex = 0;     }
   void              Clear(Option_t */*option*/="");
 
+  // Per-event constituent index (set by AliJetContainer)
+  void              SetConstituentIndex(const AliEmcalJetConstituentIndex* index, Int_t ijet) { fConstituentIndex = index; fConstituentIndexPos = ijet; }
+  const AliEmcalJetConstituentIndex *GetConstituentIndex() const;
+
   // Sorting methods
   void              SortConstituents();
   std::vector<int>  GetPtSortedTrackConstituentIndexes(TClonesArray *tracks) const;
@@ -313,6 +319,9 @@ class AliEmcalJet : public AliVParticle
   AliEmcalJetShapeProperties *fJetShapeProperties; //!<! Pointer to the jet shape properties
   UInt_t fJetAcceptanceType;    //!<!  Jet acceptance type (stored bitwise)
 
+  const AliEmcalJetConstituentIndex *fConstituentIndex; //!<! Constituent index of the jet collection in the current event (not owned)
+  Int_t             fConstituentIndexPos; //!<! Position of the jet in the constituent index
+
  private:
   /**
    * @struct sort_descend
@@ -324,7 +333,7 @@ class AliEmcalJet : public AliVParticle
   };
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJet,19);
+  ClassDef(AliEmcalJet,20);
   /// \endcond
 };
 
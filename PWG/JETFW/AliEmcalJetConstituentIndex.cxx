@@ -0,0 +1,271 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <map>
+#include <memory>
+
+#include <TClonesArray.h>
+
+#include "AliAnalysisManager.h"
+#include "AliVEventHandler.h"
+#include "AliVEvent.h"
+#include "AliEmcalJet.h"
+
+#include "AliEmcalJetConstituentIndex.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalJetConstituentIndex);
+/// \endcond
+
+/**
+ * Default constructor.
+ */
+AliEmcalJetConstituentIndex::AliEmcalJetConstituentIndex() :
+  TObject(),
+  fJets(0),
+  fEntry(-1),
+  fEvent(0),
+  fJetPt(),
+  fTrackOffsets(),
+  fTrackIDs(),
+  fTrackPtOrder(),
+  fPtOrderTracks(),
+  fClusterOffsets(),
+  fClusterIDs(),
+  fUniqueTracks(kTRUE),
+  fUniqueClusters(kTRUE),
+  fTrackMap(),
+  fClusterMap()
+{
+}
+
+/**
+ * Get the index shared by all the jet containers wrapping a jet array.
+ * The index is created the first time it is requested for the array
+ * and deleted at the end of the program.
+ * @param jets Array containing the jets
+ * @return Pointer to the index of the array
+ */
+AliEmcalJetConstituentIndex* AliEmcalJetConstituentIndex::GetIndexForArray(const TClonesArray* jets)
+{
+  static std::map<const TClonesArray*, std::unique_ptr<AliEmcalJetConstituentIndex> > indexes;
+  std::unique_ptr<AliEmcalJetConstituentIndex>& index = indexes[jets];
+  if (!index) index.reset(new AliEmcalJetConstituentIndex());
+  return index.get();
+}
+
+/**
+ * Clear the index. The memory of the flat arrays and of the maps is kept
+ * to be reused in the next event.
+ */
+void AliEmcalJetConstituentIndex::Reset()
+{
+  fJets = 0;
+  fEntry = -1;
+  fEvent = 0;
+  fJetPt.clear();
+  fTrackOffsets.clear();
+  fTrackIDs.clear();
+  fTrackPtOrder.clear();
+  fPtOrderTracks.clear();
+  fClusterOffsets.clear();
+  fClusterIDs.clear();
+  fUniqueTracks = kTRUE;
+  fUniqueClusters = kTRUE;
+  fTrackMap.clear();
+  fClusterMap.clear();
+}
+
+/**
+ * Build the index for the jets of the current event and
+ * attach it to each of them (see AliEmcalJet::SetConstituentIndex()).
+ * @param jets Array containing the jets
+ */
+void AliEmcalJetConstituentIndex::Build(TClonesArray* jets)
+{
+  Reset();
+  if (!jets) return;
+
+  const Int_t njets = jets->GetEntriesFast();
+
+  fJetPt.reserve(njets);
+  fTrackOffsets.reserve(njets + 1);
+  fClusterOffsets.reserve(njets + 1);
+  fTrackOffsets.push_back(0);
+  fClusterOffsets.push_back(0);
+
+  for (Int_t ijet = 0; ijet < njets; ijet++) {
+    const AliEmcalJet* jet = static_cast<const AliEmcalJet*>(jets->UncheckedAt(ijet));
+    fJetPt.push_back(jet ? jet->Pt() : -1);
+    if (jet) {
+      for (Int_t i = 0; i < jet->GetNumberOfTracks(); i++) fTrackIDs.push_back(jet->TrackAt(i));
+      for (Int_t i = 0; i < jet->GetNumberOfClusters(); i++) fClusterIDs.push_back(jet->ClusterAt(i));
+    }
+    fTrackOffsets.push_back(fTrackIDs.size());
+    fClusterOffsets.push_back(fClusterIDs.size());
+  }
+
+  fTrackPtOrder.assign(fTrackIDs.size(), -1);
+  fPtOrderTracks.assign(njets, 0);
+
+  fUniqueTracks = FillReverseMap(fTrackMap, fTrackOffsets, fTrackIDs);
+  fUniqueClusters = FillReverseMap(fClusterMap, fClusterOffsets, fClusterIDs);
+
+  fJets = jets;
+
+  for (Int_t ijet = 0; ijet < njets; ijet++) {
+    AliEmcalJet* jet = static_cast<AliEmcalJet*>(jets->UncheckedAt(ijet));
+    if (jet) jet->SetConstituentIndex(this, ijet);
+  }
+}
+
+/**
+ * Build the index for the jets of the current event, unless it was already built
+ * for the same jet array in this event (e.g. by another container of the same array).
+ * The event is identified by the entry and the input event of the analysis manager;
+ * without analysis manager the index is always rebuilt.
+ * @param jets Array containing the jets
+ * @return kTRUE if the index was rebuilt
+ */
+Bool_t AliEmcalJetConstituentIndex::Update(TClonesArray* jets)
+{
+  Long64_t entry = -1;
+  AliVEvent* event = 0;
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  if (mgr) {
+    entry = mgr->GetCurrentEntry();
+    AliVEventHandler* handler = mgr->GetInputEventHandler();
+    event = handler ? handler->GetEvent() : 0;
+    if (jets && jets == fJets && entry == fEntry && event == fEvent) return kFALSE;
+  }
+
+  Build(jets);
+  if (mgr) {
+    fEntry = entry;
+    fEvent = event;
+  }
+  return kTRUE;
+}
+
+/**
+ * Fill a reverse map id -> (jet, position in the jet).
+ * @param map Map to be filled
+ * @param offsets First entry of each jet in the flat id array
+ * @param ids Flat id array
+ * @return kFALSE if the same id was found more than once, kTRUE otherwise
+ */
+Bool_t AliEmcalJetConstituentIndex::FillReverseMap(ConstituentMap_t& map, const std::vector<Int_t>& offsets, const std::vector<Int_t>& ids)
+{
+  Bool_t unique = kTRUE;
+  map.reserve(ids.size());
+  for (UInt_t ijet = 0; ijet + 1 < offsets.size(); ijet++) {
+    for (Int_t i = offsets[ijet]; i < offsets[ijet+1]; i++) {
+      if (!map.insert(std::make_pair(ids[i], std::make_pair(Int_t(ijet), i - offsets[ijet]))).second) unique = kFALSE;
+    }
+  }
+  return unique;
+}
+
+/**
+ * Look up an id in a reverse map.
+ * @param map Reverse map
+ * @param id Id to search
+ * @param pos Filled with the position of the constituent in the jet
+ * @return The position of the jet in the array, -1 if the id does not belong to any jet
+ */
+Int_t AliEmcalJetConstituentIndex::FindInReverseMap(const ConstituentMap_t& map, Int_t id, Int_t& pos)
+{
+  ConstituentMap_t::const_iterator it = map.find(id);
+  if (it == map.end()) {
+    pos = -1;
+    return -1;
+  }
+  pos = it->second.second;
+  return it->second.first;
+}
+
+/**
+ * Find the jet containing a given track.
+ * If the same track is a constituent of more than one jet (see HasUniqueTracks())
+ * the first of them is returned.
+ * @param id Track id, as stored in AliEmcalJet
+ * @param pos Filled with the position of the track in the jet constituent array
+ * @return The position of the jet in the array, -1 if the track is not a constituent of any jet
+ */
+Int_t AliEmcalJetConstituentIndex::GetJetOfTrack(Int_t id, Int_t& pos) const
+{
+  return FindInReverseMap(fTrackMap, id, pos);
+}
+
+/**
+ * Find the jet containing a given cluster.
+ * If the same cluster is a constituent of more than one jet (see HasUniqueClusters())
+ * the first of them is returned.
+ * @param id Cluster id, as stored in AliEmcalJet
+ * @param pos Filled with the position of the cluster in the jet constituent array
+ * @return The position of the jet in the array, -1 if the cluster is not a constituent of any jet
+ */
+Int_t AliEmcalJetConstituentIndex::GetJetOfCluster(Int_t id, Int_t& pos) const
+{
+  return FindInReverseMap(fClusterMap, id, pos);
+}
+
+/**
+ * Get the stored pt ordering of the track constituents of a jet.
+ * @param ijet Position of the jet in the array
+ * @param tracks Array containing the tracks the ordering is requested for
+ * @return Positions of the track constituents ordered by decreasing pt, or null if
+ * the ordering was not stored yet or was determined with another track array
+ */
+const Int_t* AliEmcalJetConstituentIndex::GetPtSortedTrackPositions(Int_t ijet, const TClonesArray* tracks) const
+{
+  if (!tracks || ijet < 0 || ijet >= GetNJets()) return 0;
+  if (fPtOrderTracks[ijet] != tracks) return 0;
+  return fTrackPtOrder.data() + fTrackOffsets[ijet];
+}
+
+/**
+ * Store the pt ordering of the track constituents of a jet, so that
+ * it does not need to be recalculated for the rest of the event.
+ * Only the ordering determined with the first track array is stored.
+ * @param ijet Position of the jet in the array
+ * @param tracks Array containing the tracks the ordering was determined with
+ * @param order Positions of the track constituents ordered by decreasing pt
+ */
+void AliEmcalJetConstituentIndex::SetPtSortedTrackPositions(Int_t ijet, const TClonesArray* tracks, const std::vector<int>& order) const
+{
+  if (!tracks || ijet < 0 || ijet >= GetNJets()) return;
+  if (fPtOrderTracks[ijet]) return;
+  if (Int_t(order.size()) != GetNumberOfTracks(ijet)) return;
+  std::copy(order.begin(), order.end(), fTrackPtOrder.begin() + fTrackOffsets[ijet]);
+  fPtOrderTracks[ijet] = tracks;
+}
+
+/**
+ * Check that the index still describes a jet, i.e. that it was built for the same
+ * jet array in the current event and that the constituents were not changed afterwards.
+ * @param jet Pointer to the jet
+ * @param ijet Position of the jet in the array
+ * @return kTRUE if the index can be used for this jet
+ */
+Bool_t AliEmcalJetConstituentIndex::IsConsistent(const AliEmcalJet* jet, Int_t ijet) const
+{
+  if (!fJets || ijet < 0 || ijet >= GetNJets()) return kFALSE;
+  if (fJets->UncheckedAt(ijet) != jet) return kFALSE;
+  if (fJetPt[ijet] != jet->Pt()) return kFALSE;
+  if (GetNumberOfTracks(ijet) != jet->GetNumberOfTracks()) return kFALSE;
+  if (GetNumberOfClusters(ijet) != jet->GetNumberOfClusters()) return kFALSE;
+  return kTRUE;
+}
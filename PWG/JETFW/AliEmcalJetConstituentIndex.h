@@ -0,0 +1,105 @@
+#ifndef ALIEMCALJETCONSTITUENTINDEX_H
+#define ALIEMCALJETCONSTITUENTINDEX_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+#include <unordered_map>
+#endif
+
+#include <TObject.h>
+
+class TClonesArray;
+class AliEmcalJet;
+class AliVEvent;
+
+/**
+ * @class AliEmcalJetConstituentIndex
+ * @brief Per-event index of the constituents of all the jets in a jet collection
+ * @ingroup EMCALCOREFW
+ *
+ * There is one index per jet array, shared by all the jet containers wrapping the array
+ * (see GetIndexForArray()). It is built on request of the containers (see
+ * AliJetContainer::SetBuildConstituentIndex()) at the beginning of each event, only once
+ * per event even if several containers use the same array (see Update()). It stores:
+ * - the track and cluster ids of all the jets in one flat array each, with an offset
+ *   array giving the first entry of each jet (CSR layout);
+ * - for each jet, the positions of the track constituents ordered by decreasing \f$ p_{T} \f$,
+ *   computed the first time they are requested in the event and kept until the next one,
+ *   together with the track array they were computed with (requests for another
+ *   track array are not cached);
+ * - a reverse map from the track (cluster) id to the jet and to the position of the constituent
+ *   in the jet.
+ *
+ * The jets of the collection keep a (non-owning) pointer to the index, so that
+ * AliEmcalJet::ContainsTrack(), AliEmcalJet::ContainsCluster() and
+ * AliEmcalJet::GetPtSortedTrackConstituentIndexes() do not need to loop over the
+ * constituents or sort them at each call.
+ */
+class AliEmcalJetConstituentIndex : public TObject {
+ public:
+  AliEmcalJetConstituentIndex();
+  virtual ~AliEmcalJetConstituentIndex() {;}
+
+  static AliEmcalJetConstituentIndex *GetIndexForArray(const TClonesArray* jets);
+
+  void                        Reset();
+  void                        Build(TClonesArray* jets);
+  Bool_t                      Update(TClonesArray* jets);
+
+  Bool_t                      IsBuilt()                                const { return fJets != 0                                   ; }
+  TClonesArray               *GetJetArray()                            const { return fJets                                        ; }
+  Int_t                       GetNJets()                               const { return fTrackOffsets.empty() ? 0 : fTrackOffsets.size() - 1; }
+
+  Int_t                       GetNumberOfTracks(Int_t ijet)            const { return fTrackOffsets[ijet+1] - fTrackOffsets[ijet]  ; }
+  Int_t                       GetNumberOfClusters(Int_t ijet)          const { return fClusterOffsets[ijet+1] - fClusterOffsets[ijet]; }
+  const Int_t                *GetTrackIDs(Int_t ijet)                  const { return fTrackIDs.data() + fTrackOffsets[ijet]       ; }
+  const Int_t                *GetClusterIDs(Int_t ijet)                const { return fClusterIDs.data() + fClusterOffsets[ijet]   ; }
+
+  const Int_t                *GetPtSortedTrackPositions(Int_t ijet, const TClonesArray* tracks) const;
+  void                        SetPtSortedTrackPositions(Int_t ijet, const TClonesArray* tracks, const std::vector<int>& order) const;
+
+  Bool_t                      HasUniqueTracks()                        const { return fUniqueTracks                                ; }
+  Bool_t                      HasUniqueClusters()                      const { return fUniqueClusters                              ; }
+
+  Int_t                       GetJetOfTrack(Int_t id, Int_t& pos)      const;
+  Int_t                       GetJetOfCluster(Int_t id, Int_t& pos)    const;
+
+  Bool_t                      IsConsistent(const AliEmcalJet* jet, Int_t ijet) const;
+
+ protected:
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+  typedef std::unordered_map<Int_t, std::pair<Int_t, Int_t> > ConstituentMap_t;
+
+  static Bool_t               FillReverseMap(ConstituentMap_t& map, const std::vector<Int_t>& offsets, const std::vector<Int_t>& ids);
+  static Int_t                FindInReverseMap(const ConstituentMap_t& map, Int_t id, Int_t& pos);
+#endif
+
+  TClonesArray               *fJets;                 //!<! jet array the index was built for
+  Long64_t                    fEntry;                //!<! entry of the analysis manager the index was built in (-1 if unknown)
+  AliVEvent                  *fEvent;                //!<! input event the index was built in
+  std::vector<Double_t>       fJetPt;                //!<! pt of each jet when the index was built
+  std::vector<Int_t>          fTrackOffsets;         //!<! first entry in fTrackIDs of each jet (size number of jets + 1)
+  std::vector<Int_t>          fTrackIDs;             //!<! track ids of all the jets
+  mutable std::vector<Int_t>  fTrackPtOrder;         //!<! positions of the track constituents in each jet, ordered by decreasing pt
+  mutable std::vector<const TClonesArray*> fPtOrderTracks; //!<! track array the pt ordering of each jet was determined with (null if not yet)
+  std::vector<Int_t>          fClusterOffsets;       //!<! first entry in fClusterIDs of each jet (size number of jets + 1)
+  std::vector<Int_t>          fClusterIDs;           //!<! cluster ids of all the jets
+  Bool_t                      fUniqueTracks;         //!<! whether each track id belongs to a single jet
+  Bool_t                      fUniqueClusters;       //!<! whether each cluster id belongs to a single jet
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+  ConstituentMap_t            fTrackMap;             //!<! track id -> (jet, position in the jet)
+  ConstituentMap_t            fClusterMap;           //!<! cluster id -> (jet, position in the jet)
+#endif
+
+ private:
+  AliEmcalJetConstituentIndex(const AliEmcalJetConstituentIndex&);            // not implemented
+  AliEmcalJetConstituentIndex& operator=(const AliEmcalJetConstituentIndex&); // not implemented
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalJetConstituentIndex, 2);
+  /// \endcond
+};
+
+#endif
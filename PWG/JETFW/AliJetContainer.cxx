@@ -63,7 +63,9 @@ AliJetContainer::AliJetContainer():
   fGeom(0),
   fRunNumber(0),
   fTpcHolePos(0),
-  fTpcHoleWidth(0)
+  fTpcHoleWidth(0),
+  fBuildConstituentIndex(kFALSE),
+  fConstituentIndex(0)
 {
   fBaseClassName = "AliEmcalJet";
   SetClassName("AliEmcalJet");
@@ -104,7 +106,9 @@ AliJetContainer::AliJetContainer(const char *name):
   fGeom(0),
   fRunNumber(0),
   fTpcHolePos(0),
-  fTpcHoleWidth(0)
+  fTpcHoleWidth(0),
+  fBuildConstituentIndex(kFALSE),
+  fConstituentIndex(0)
 {
   fBaseClassName = "AliEmcalJet";
   SetClassName("AliEmcalJet");
@@ -154,7 +158,11 @@ AliJetContainer::AliJetContainer(EJetType_t jetType, EJetAlgo_t jetAlgo, ERecoSc
   fLocalRho(0),
   fRhoMass(0),
   fGeom(0),
-  fRunNumber(0)
+  fRunNumber(0),
+  fTpcHolePos(0),
+  fTpcHoleWidth(0),
+  fBuildConstituentIndex(kFALSE),
+  fConstituentIndex(0)
 {
   fBaseClassName = "AliEmcalJet";
   SetClassName("AliEmcalJet");
@@ -405,6 +413,9 @@ Bool_t AliJetContainer::GetMomentumFromJet(TLorentzVector &mom, const AliEmcalJe
  */
 Bool_t AliJetContainer::GetMomentum(TLorentzVector &mom, Int_t i) const
 {
+  Bool_t result = kFALSE;
+  if (GetMomentumFromCache(mom, i, result)) return result;
+
   AliEmcalJet *jet = GetJet(i);
   return GetMomentumFromJet(mom, jet);
 }
@@ -612,6 +623,25 @@ Bool_t AliJetContainer::ApplyJetCuts(const AliEmcalJet *jet, UInt_t &rejectionRe
   return kTRUE;
 }
 
+/**
+ * Build the key of the shared per-event cache, adding the jet cuts
+ * and the arrays used to find the leading hadron to the cuts of the
+ * base class.
+ * @return Key of the shared per-event cache
+ */
+TString AliJetContainer::BuildEventCacheKey() const
+{
+  TString key = AliEmcalContainer::BuildEventCacheKey();
+  key += TString::Format("/%u/%.9g/%d/%.9g/%.9g/%.9g/%.9g/%.9g/%.9g/%.9g/%.9g/%.9g/%.9g/%d/%d/%d/%.17g/%.17g",
+                         fJetAcceptanceType, fJetRadius, fFlavourSelection, fJetAreaCut, fAreaEmcCut,
+                         fMinClusterPt, fMaxClusterPt, fMinTrackPt, fMaxTrackPt, fZLeadingEmcCut, fZLeadingChCut,
+                         fNEFMinCut, fNEFMaxCut, fLeadingHadronType, fMinNConstituents, fTagStatus,
+                         fTpcHolePos, fTpcHoleWidth);
+  key += TString::Format("/%s/%s", fParticleContainer ? fParticleContainer->GetArrayName().Data() : "",
+                         fClusterContainer ? fClusterContainer->GetArrayName().Data() : "");
+  return key;
+}
+
 /**
  * Retrieve the transverse momentum of leading hadron of the jet.
  * Depending on the internal settings, the leading hadron can be
@@ -805,6 +835,24 @@ Int_t AliJetContainer::GetNAcceptedJets()
   return accepted().GetEntries();
 }
 
+/**
+ * Updates the constituent index of the jets for the new event, if requested
+ * (see SetBuildConstituentIndex()). The index is shared with the other containers
+ * of the same jet array and built only once per event (see AliEmcalJetConstituentIndex).
+ */
+void AliJetContainer::NextEvent()
+{
+  AliParticleContainer::NextEvent();
+
+  if (fBuildConstituentIndex && fClArray) {
+    fConstituentIndex = AliEmcalJetConstituentIndex::GetIndexForArray(fClArray);
+    fConstituentIndex->Update(fClArray);
+  }
+  else {
+    fConstituentIndex = 0;
+  }
+}
+
 /**
  * Get fraction of shared pT between matched jets.
  * Uses ClosestJet() jet pT as baseline: fraction = \Sum_{const,jet1} pT,const,i / pT,jet,closest
@@ -20,6 +20,7 @@ class AliLocalRhoParameter;
 #include "AliLog.h"
 #include "AliVEvent.h"
 #include "AliEmcalJet.h"
+#include "AliEmcalJetConstituentIndex.h"
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
 typedef EMCALIterableContainer::AliEmcalIterableContainerT<AliEmcalJet, EMCALIterableContainer::operator_star_object<AliEmcalJet> > AliJetIterableContainer;
@@ -129,6 +130,8 @@ class AliJetContainer : public AliParticleContainer {
   void                        SetTpcHoleWidth(Double_t b)                             {fTpcHoleWidth    =   b     ;} 
 
 
+  void                        SetBuildConstituentIndex(Bool_t b)                   { fBuildConstituentIndex = b         ; }
+
   void                        ConnectParticleContainer(AliParticleContainer *c)    { fParticleContainer = c             ; }
   void                        ConnectClusterContainer(AliClusterContainer *c)      { fClusterContainer  = c             ; }
 
@@ -152,6 +155,8 @@ class AliJetContainer : public AliParticleContainer {
   Int_t                       GetFlavourCut()                       const    {return fFlavourSelection;}
   Int_t                       GetNJets()                            const    {return GetNEntries();}
   Int_t                       GetNAcceptedJets()                         ;
+  virtual void                NextEvent();
+  const AliEmcalJetConstituentIndex *GetConstituentIndex()          const    {return fConstituentIndex && fConstituentIndex->IsBuilt() ? fConstituentIndex : 0;}
 
   Double_t                    GetLeadingHadronPt(const AliEmcalJet* jet)  const;
   void                        GetLeadingHadronMomentum(TLorentzVector &mom, const AliEmcalJet* jet)  const;
@@ -194,6 +199,8 @@ class AliJetContainer : public AliParticleContainer {
 #endif
 
  protected:
+  virtual TString             BuildEventCacheKey() const;
+
   UInt_t                      fJetAcceptanceType;    ///  Jet acceptance type cut, see AliEmcalJet::JetAcceptanceType
   Float_t                     fJetRadius;            ///  jet radius
   TString                     fRhoName;              ///  Name of rho object
@@ -224,11 +231,13 @@ class AliJetContainer : public AliParticleContainer {
   Int_t                       fRunNumber;            //!<! run number
   Double_t                    fTpcHolePos;           ///   position(in radians) of the malfunctioning TPC sector
   Double_t                    fTpcHoleWidth;         ///   width of the malfunctioning TPC area
+  Bool_t                      fBuildConstituentIndex;///   build the constituent index of the jets at each event (off by default)
+  AliEmcalJetConstituentIndex *fConstituentIndex;    //!<! constituent index of the jet array in the current event (shared, not owned)
  private:
   AliJetContainer(const AliJetContainer& obj); // copy constructor
   AliJetContainer& operator=(const AliJetContainer& other); // assignment
 
-  ClassDef(AliJetContainer, 18);
+  ClassDef(AliJetContainer, 19);
 };
 
 #endif
@@ -0,0 +1,208 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <TMath.h>
+
+#include "AliEventShapeTools.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEventShapeTools);
+/// \endcond
+
+/**
+ * Sweep a half plane around the origin, with the edge aligned with each of the tracks in turn.
+ * For the edge along track j, the half plane contains the tracks with
+ * \f$ \varphi_{j} - \pi < \varphi \le \varphi_{j} \f$ and D is twice its momentum sum minus the total momentum.
+ * - \f$ |D \times \hat{n}_{j}| \f$ is the sum of \f$ |\vec{p}_{T,i} \times \hat{n}_{j}| \f$ (spherocity);
+ * - \f$ |D| \f$ is the sum of \f$ |\vec{p}_{T,i} \cdot \hat{D}| \f$ (thrust).
+ * @param n Number of tracks
+ * @param px Track px
+ * @param py Track py
+ * @param sumPt Filled with the scalar pt sum
+ * @param minCross Filled with the minimum of the sum of the cross products
+ * @param minCrossPhi Filled with the azimuth of the axis at the minimum
+ * @param maxDiff Filled with the maximum of |D|
+ * @param maxDiffPhi Filled with the azimuth of D at the maximum
+ * @return Number of tracks with non-zero pt
+ */
+Int_t AliEventShapeTools::SweepHalfPlanes(Int_t n, const Double_t* px, const Double_t* py, Double_t& sumPt,
+                                          Double_t& minCross, Double_t& minCrossPhi, Double_t& maxDiff, Double_t& maxDiffPhi)
+{
+  sumPt = 0;
+  minCross = 0;
+  minCrossPhi = 0;
+  maxDiff = 0;
+  maxDiffPhi = 0;
+
+  std::vector<std::pair<Double_t, Int_t> > sorted;
+  sorted.reserve(n);
+  Double_t totX = 0, totY = 0;
+  for (Int_t i = 0; i < n; i++) {
+    if (px[i] == 0 && py[i] == 0) continue;
+    Double_t phi = TMath::ATan2(py[i], px[i]);
+    if (phi < 0) phi += TMath::TwoPi();
+    sorted.push_back(std::make_pair(phi, i));
+    sumPt += TMath::Sqrt(px[i] * px[i] + py[i] * py[i]);
+    totX += px[i];
+    totY += py[i];
+  }
+  const Int_t m = sorted.size();
+  if (m == 0) return 0;
+
+  std::sort(sorted.begin(), sorted.end());
+
+  // tracks k = 0..2m-1 of the sweep: the sorted tracks twice, the second time with phi + 2pi
+  Int_t lo = 0;
+  Int_t hi = -1;
+  Double_t sx = 0, sy = 0;
+  minCross = -1;
+  maxDiff = -1;
+  for (Int_t j = 0; j < m; j++) {
+    const Double_t theta = sorted[j].first + TMath::TwoPi();
+    while (hi < j + m) {
+      hi++;
+      const Int_t i = sorted[hi % m].second;
+      sx += px[i];
+      sy += py[i];
+    }
+    while (sorted[lo % m].first + (lo >= m ? TMath::TwoPi() : 0) <= theta - TMath::Pi()) {
+      const Int_t i = sorted[lo % m].second;
+      sx -= px[i];
+      sy -= py[i];
+      lo++;
+    }
+
+    const Double_t dx = 2 * sx - totX;
+    const Double_t dy = 2 * sy - totY;
+
+    const Double_t cross = TMath::Abs(dx * TMath::Sin(theta) - dy * TMath::Cos(theta));
+    if (minCross < 0 || cross < minCross) {
+      minCross = cross;
+      minCrossPhi = sorted[j].first;
+    }
+
+    const Double_t diff = TMath::Sqrt(dx * dx + dy * dy);
+    if (diff > maxDiff) {
+      maxDiff = diff;
+      maxDiffPhi = TMath::ATan2(dy, dx);
+    }
+  }
+
+  return m;
+}
+
+/**
+ * Exact transverse spherocity.
+ * @param n Number of tracks
+ * @param px Track px
+ * @param py Track py
+ * @param axisPhi If given, filled with the azimuth of the spherocity axis (in [0, 2pi[)
+ * @return Spherocity, -1 if there are no tracks with non-zero pt
+ */
+Double_t AliEventShapeTools::Spherocity(Int_t n, const Double_t* px, const Double_t* py, Double_t* axisPhi)
+{
+  Double_t sumPt = 0, minCross = 0, minCrossPhi = 0, maxDiff = 0, maxDiffPhi = 0;
+  if (!SweepHalfPlanes(n, px, py, sumPt, minCross, minCrossPhi, maxDiff, maxDiffPhi)) return -1;
+
+  if (axisPhi) *axisPhi = minCrossPhi;
+  Double_t ratio = minCross / sumPt;
+  return ratio * ratio * TMath::Pi() * TMath::Pi() / 4.;
+}
+
+/**
+ * Transverse spherocity minimised over trial axes in steps of stepDeg degrees,
+ * as done so far by the event-shape classes.
+ * @param n Number of tracks
+ * @param px Track px
+ * @param py Track py
+ * @param stepDeg Angle between two trial axes, in degrees
+ * @return Spherocity, -1 if there are no tracks with non-zero pt
+ */
+Double_t AliEventShapeTools::SpherocityGridScan(Int_t n, const Double_t* px, const Double_t* py, Double_t stepDeg)
+{
+  Double_t sumPt = 0;
+  for (Int_t i = 0; i < n; i++) sumPt += TMath::Sqrt(px[i] * px[i] + py[i] * py[i]);
+  if (!(sumPt > 0) || !(stepDeg > 0)) return -1;
+
+  Double_t minRatioSquare = 2;
+  for (Int_t istep = 0; istep < 360 / stepDeg; istep++) {
+    const Double_t phi = TMath::Pi() * istep * stepDeg / 180.;
+    const Double_t nx = TMath::Cos(phi);
+    const Double_t ny = TMath::Sin(phi);
+    Double_t sum = 0;
+    for (Int_t i = 0; i < n; i++) sum += TMath::Abs(ny * px[i] - nx * py[i]);
+    const Double_t ratioSquare = (sum / sumPt) * (sum / sumPt);
+    if (ratioSquare < minRatioSquare) minRatioSquare = ratioSquare;
+  }
+
+  return minRatioSquare * TMath::Pi() * TMath::Pi() / 4.;
+}
+
+/**
+ * Exact transverse thrust.
+ * @param n Number of tracks
+ * @param px Track px
+ * @param py Track py
+ * @param axisPhi If given, filled with the azimuth of the thrust axis (in ]-pi, pi])
+ * @return Thrust, -1 if there are no tracks with non-zero pt
+ */
+Double_t AliEventShapeTools::Thrust(Int_t n, const Double_t* px, const Double_t* py, Double_t* axisPhi)
+{
+  Double_t sumPt = 0, minCross = 0, minCrossPhi = 0, maxDiff = 0, maxDiffPhi = 0;
+  if (!SweepHalfPlanes(n, px, py, sumPt, minCross, minCrossPhi, maxDiff, maxDiffPhi)) return -1;
+
+  if (axisPhi) *axisPhi = maxDiffPhi;
+  return maxDiff / sumPt;
+}
+
+/**
+ * Transverse sphericity \f$ 2 \lambda_{2} / (\lambda_{1} + \lambda_{2}) \f$ from the eigenvalues
+ * of the transverse momentum tensor.
+ * @param n Number of tracks
+ * @param px Track px
+ * @param py Track py
+ * @param linearized If true each track is weighted by 1/pt (linearized tensor, infrared safe)
+ * @return Sphericity, -1 if there are no tracks with non-zero pt
+ */
+Double_t AliEventShapeTools::Sphericity(Int_t n, const Double_t* px, const Double_t* py, Bool_t linearized)
+{
+  Double_t s00 = 0, s01 = 0, s11 = 0, norm = 0;
+  for (Int_t i = 0; i < n; i++) {
+    const Double_t pt = TMath::Sqrt(px[i] * px[i] + py[i] * py[i]);
+    if (pt == 0) continue;
+    const Double_t w = linearized ? 1. / pt : 1.;
+    s00 += px[i] * px[i] * w;
+    s01 += px[i] * py[i] * w;
+    s11 += py[i] * py[i] * w;
+    norm += pt * pt * w;
+  }
+  if (!(norm > 0)) return -1;
+
+  s00 /= norm;
+  s01 /= norm;
+  s11 /= norm;
+
+  const Double_t trace = s00 + s11;
+  const Double_t disc = TMath::Sqrt(TMath::Max(0., trace * trace - 4 * (s00 * s11 - s01 * s01)));
+  const Double_t lambda1 = (trace + disc) / 2;
+  const Double_t lambda2 = (trace - disc) / 2;
+  if (lambda1 + lambda2 == 0) return 0;
+
+  return 2 * TMath::Min(lambda1, lambda2) / (lambda1 + lambda2);
+}
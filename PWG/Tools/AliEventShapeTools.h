@@ -0,0 +1,51 @@
+#ifndef ALIEVENTSHAPETOOLS_H
+#define ALIEVENTSHAPETOOLS_H
+
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <TObject.h>
+
+/**
+ * @class AliEventShapeTools
+ * @brief Transverse event shapes (spherocity, sphericity, thrust) from arrays of track momenta
+ *
+ * Common implementation of the transverse event-shape observables, to be used by the
+ * event-shape classes instead of their own scans. The input are the \f$ p_{x} \f$ and \f$ p_{y} \f$
+ * of the selected tracks, extracted once per event by the caller.
+ *
+ * Spherocity
+ * \f[ S_{0} = \frac{\pi^{2}}{4} \min_{\hat{n}} \left( \frac{\sum_{i} |\vec{p}_{T,i} \times \hat{n}|}{\sum_{i} p_{T,i}} \right)^{2} \f]
+ * and thrust
+ * \f[ T = \max_{\hat{n}} \frac{\sum_{i} |\vec{p}_{T,i} \cdot \hat{n}|}{\sum_{i} p_{T,i}} \f]
+ * are computed exactly in \f$ O(N \log N) \f$: the sum in the spherocity is concave between
+ * the directions of two consecutive tracks, so its minimum is at an axis aligned with
+ * one of the tracks, and the thrust axis is parallel to the difference between the momentum
+ * sums on the two sides of a line through one of the tracks. After sorting the tracks in
+ * azimuth, both are found by sweeping a half plane around the origin, updating its
+ * momentum sum by one track at each step.
+ *
+ * SpherocityGridScan() gives the spherocity with the scan over trial axes used so far
+ * by the event-shape classes, for comparison. The exact value is never above it, and
+ * the two differ by at most the effect of the step size.
+ */
+class AliEventShapeTools : public TObject {
+ public:
+  AliEventShapeTools() : TObject() {;}
+  virtual ~AliEventShapeTools() {;}
+
+  static Double_t Spherocity(Int_t n, const Double_t* px, const Double_t* py, Double_t* axisPhi = 0);
+  static Double_t SpherocityGridScan(Int_t n, const Double_t* px, const Double_t* py, Double_t stepDeg = 0.1);
+  static Double_t Thrust(Int_t n, const Double_t* px, const Double_t* py, Double_t* axisPhi = 0);
+  static Double_t Sphericity(Int_t n, const Double_t* px, const Double_t* py, Bool_t linearized = kTRUE);
+
+ protected:
+  static Int_t    SweepHalfPlanes(Int_t n, const Double_t* px, const Double_t* py, Double_t& sumPt,
+                                  Double_t& minCross, Double_t& minCrossPhi, Double_t& maxDiff, Double_t& maxDiffPhi);
+
+  /// \cond CLASSIMP
+  ClassDef(AliEventShapeTools, 1);
+  /// \endcond
+};
+
+#endif
@@ -32,6 +32,7 @@
 #include "AliAODMCParticle.h" 
 #include "AliPIDResponse.h"   
 #include "AliPIDCombined.h"   
+#include "AliPIDNSigmaCache.h"
 #include "AliAnalysisManager.h"
 #include "AliInputEventHandler.h"
 
@@ -313,11 +314,13 @@ void AliHelperPID::CalculateNSigmas(AliVTrack * trk, Bool_t FIllQAHistos){
   //defines data member fnsigmas
   
   // Compute nsigma for each hypthesis
+  // (through the n-sigma cache shared with the other tasks of the train)
   AliVParticle *inEvHMain = dynamic_cast<AliVParticle *>(trk);
+  AliPIDNSigmaCache *pidCache = AliPIDNSigmaCache::Instance();
   // --- TPC
-  Double_t nsigmaTPCkProton = fPIDResponse->NumberOfSigmasTPC(inEvHMain, AliPID::kProton);
-  Double_t nsigmaTPCkKaon   = fPIDResponse->NumberOfSigmasTPC(inEvHMain, AliPID::kKaon); 
-  Double_t nsigmaTPCkPion   = fPIDResponse->NumberOfSigmasTPC(inEvHMain, AliPID::kPion); 
+  Double_t nsigmaTPCkProton = pidCache->NumberOfSigmasTPC(inEvHMain, AliPID::kProton);
+  Double_t nsigmaTPCkKaon   = pidCache->NumberOfSigmasTPC(inEvHMain, AliPID::kKaon); 
+  Double_t nsigmaTPCkPion   = pidCache->NumberOfSigmasTPC(inEvHMain, AliPID::kPion); 
   // --- TOF
   Double_t nsigmaTOFkProton=999.,nsigmaTOFkKaon=999.,nsigmaTOFkPion=999.;
   Double_t nsigmaTPCTOFkProton=999.,nsigmaTPCTOFkKaon=999.,nsigmaTPCTOFkPion=999.;
@@ -325,9 +328,9 @@ void AliHelperPID::CalculateNSigmas(AliVTrack * trk, Bool_t FIllQAHistos){
   CheckTOF(trk);
   
   if(fHasTOFPID && trk->Pt()>fPtTOFPID){//use TOF information
-    nsigmaTOFkProton = fPIDResponse->NumberOfSigmasTOF(inEvHMain, AliPID::kProton);
-    nsigmaTOFkKaon   = fPIDResponse->NumberOfSigmasTOF(inEvHMain, AliPID::kKaon); 
-    nsigmaTOFkPion   = fPIDResponse->NumberOfSigmasTOF(inEvHMain, AliPID::kPion); 
+    nsigmaTOFkProton = pidCache->NumberOfSigmasTOF(inEvHMain, AliPID::kProton);
+    nsigmaTOFkKaon   = pidCache->NumberOfSigmasTOF(inEvHMain, AliPID::kKaon); 
+    nsigmaTOFkPion   = pidCache->NumberOfSigmasTOF(inEvHMain, AliPID::kPion); 
     Double_t d2Proton=nsigmaTPCkProton * nsigmaTPCkProton + nsigmaTOFkProton * nsigmaTOFkProton;
     Double_t d2Kaon=nsigmaTPCkKaon * nsigmaTPCkKaon + nsigmaTOFkKaon * nsigmaTOFkKaon;
     Double_t d2Pion=nsigmaTPCkPion * nsigmaTPCkPion + nsigmaTOFkPion * nsigmaTOFkPion;
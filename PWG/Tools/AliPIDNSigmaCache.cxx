@@ -0,0 +1,293 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "AliAnalysisManager.h"
+#include "AliInputEventHandler.h"
+#include "AliVEvent.h"
+#include "AliVParticle.h"
+#include "AliVTrack.h"
+
+#include "AliPIDNSigmaCache.h"
+
+/// \cond CLASSIMP
+ClassImp(AliPIDNSigmaCache);
+/// \endcond
+
+AliPIDNSigmaCache* AliPIDNSigmaCache::fgInstance = 0;
+
+/**
+ * Default constructor.
+ */
+AliPIDNSigmaCache::AliPIDNSigmaCache() :
+  TObject(),
+  fPIDResponse(0),
+  fManualEvents(kFALSE),
+  fEntry(-1),
+  fEvent(0),
+  fEventPIDResponse(0),
+  fEventTuneOnData(kFALSE),
+  fEventTuneOnDataMask(0),
+  fEventCentrality(-1),
+  fNSlots(0),
+  fTrackPt(),
+  fTrackLabel(),
+  fTOFStartTime(),
+  fTOFStartTimeRes(),
+  fNSigma(),
+  fNSigmaDone(),
+  fProb(),
+  fProbStatus(),
+  fNRequests(0),
+  fNEvaluations(0),
+  fSlots()
+{
+}
+
+/**
+ * Access the cache shared by all the tasks, creating it the first time.
+ * @return Pointer to the shared cache
+ */
+AliPIDNSigmaCache* AliPIDNSigmaCache::Instance()
+{
+  if (!fgInstance) {
+    static Bool_t cleanupRegistered = kFALSE;
+    if (!cleanupRegistered) {
+      std::atexit(AliPIDNSigmaCache::DeleteInstance);
+      cleanupRegistered = kTRUE;
+    }
+    fgInstance = new AliPIDNSigmaCache();
+  }
+  return fgInstance;
+}
+
+/**
+ * Delete the cache shared by all the tasks. A new one is created
+ * by the next call to Instance().
+ */
+void AliPIDNSigmaCache::DeleteInstance()
+{
+  delete fgInstance;
+  fgInstance = 0;
+}
+
+/**
+ * Get the PID response used to fill the cache. If it was not set with
+ * SetPIDResponse(), the one of the input handler of the analysis manager is used.
+ * @return Pointer to the PID response, 0 if not available
+ */
+AliPIDResponse* AliPIDNSigmaCache::GetPIDResponse()
+{
+  if (fPIDResponse) return fPIDResponse;
+
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  AliInputEventHandler* handler = mgr ? dynamic_cast<AliInputEventHandler*>(mgr->GetInputEventHandler()) : 0;
+  return handler ? handler->GetPIDResponse() : 0;
+}
+
+/**
+ * Signal the beginning of a new event. To be used only when the cache is
+ * used outside of an analysis manager: once called, the automatic detection
+ * of the event change is switched off.
+ */
+void AliPIDNSigmaCache::NextEvent()
+{
+  fManualEvents = kTRUE;
+  Invalidate();
+}
+
+/**
+ * Empty the cache. The memory is kept to be reused in the next event.
+ */
+void AliPIDNSigmaCache::Invalidate()
+{
+  fNSlots = 0;
+  fSlots.clear();
+}
+
+/**
+ * Check whether the analysis manager moved to another event (or the PID response changed)
+ * since the cache was filled, and invalidate the cache if so. Sets the PID response
+ * used to fill the cache in the current event.
+ * @return kFALSE if the event change cannot be detected, and the cache must not be used
+ */
+Bool_t AliPIDNSigmaCache::CheckEvent()
+{
+  AliPIDResponse* pid = 0;
+  Long64_t entry = fEntry;
+  AliVEvent* event = fEvent;
+  if (fManualEvents) {
+    pid = GetPIDResponse();
+    if (!pid) return kFALSE;
+  }
+  else {
+    AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+    if (!mgr) return kFALSE;
+
+    AliInputEventHandler* handler = dynamic_cast<AliInputEventHandler*>(mgr->GetInputEventHandler());
+    event = handler ? handler->GetEvent() : 0;
+    pid = fPIDResponse ? fPIDResponse : (handler ? handler->GetPIDResponse() : 0);
+    if (!pid) return kFALSE;
+    entry = mgr->GetCurrentEntry();
+  }
+
+  // the response configuration is part of the key (see the class description)
+  Bool_t tuneOnData = pid->IsTunedOnData();
+  Int_t tuneOnDataMask = pid->GetTunedOnDataMask();
+  Float_t centrality = pid->GetCurrentCentrality();
+
+  if (entry != fEntry || event != fEvent || pid != fEventPIDResponse ||
+      tuneOnData != fEventTuneOnData || tuneOnDataMask != fEventTuneOnDataMask || centrality != fEventCentrality) {
+    Invalidate();
+    fEntry = entry;
+    fEvent = event;
+    fEventPIDResponse = pid;
+    fEventTuneOnData = tuneOnData;
+    fEventTuneOnDataMask = tuneOnDataMask;
+    fEventCentrality = centrality;
+  }
+
+  return kTRUE;
+}
+
+/**
+ * Find the slot of a track in the cache, adding it if not yet there.
+ * @param track Pointer to the track
+ * @return Position of the track in the cache
+ */
+Int_t AliPIDNSigmaCache::GetSlot(const AliVParticle* track)
+{
+  Float_t pt = track->Pt();
+  Int_t label = track->GetLabel();
+
+  std::pair<std::unordered_map<const AliVParticle*, Int_t>::iterator, Bool_t> res = fSlots.insert(std::make_pair(track, fNSlots));
+  Int_t slot = res.first->second;
+
+  if (!res.second) {
+    if (fTrackPt[slot] == pt && fTrackLabel[slot] == label) return slot;
+    // the address was reused by another track: start from an empty slot
+  }
+  else {
+    fNSlots++;
+    if (Int_t(fTrackPt.size()) < fNSlots) {
+      fTrackPt.resize(fNSlots);
+      fTrackLabel.resize(fNSlots);
+      fTOFStartTime.resize(fNSlots);
+      fTOFStartTimeRes.resize(fNSlots);
+      fNSigma.resize(fNSlots * kNDet * kNSp);
+      fNSigmaDone.resize(fNSlots * kNDet * kNSp);
+      fProb.resize(fNSlots * kNDet * AliPID::kSPECIES);
+      fProbStatus.resize(fNSlots * kNDet);
+    }
+  }
+
+  fTrackPt[slot] = pt;
+  fTrackLabel[slot] = label;
+  fTOFStartTime[slot] = -1e30;
+  fTOFStartTimeRes[slot] = -1e30;
+  std::fill(fNSigmaDone.begin() + slot * kNDet * kNSp, fNSigmaDone.begin() + (slot + 1) * kNDet * kNSp, 0);
+  std::fill(fProbStatus.begin() + slot * kNDet, fProbStatus.begin() + (slot + 1) * kNDet, -1);
+
+  return slot;
+}
+
+/**
+ * Make sure that the TOF entries of a track were computed with the current TOF
+ * start time and resolution at the momentum of the track, which depend on the T0 mode
+ * set with AliPIDResponse::SetTOFResponse(). Otherwise they are cleared to be recomputed.
+ * @param slot Position of the track in the cache
+ * @param track Pointer to the track
+ */
+void AliPIDNSigmaCache::CheckTOFStartTime(Int_t slot, const AliVParticle* track)
+{
+  const AliTOFPIDResponse& tofResponse = fEventPIDResponse->GetTOFResponse();
+  Float_t p = track->P();
+  Float_t startTime = tofResponse.GetStartTime(p);
+  Float_t startTimeRes = tofResponse.GetStartTimeRes(p);
+  if (fTOFStartTime[slot] == startTime && fTOFStartTimeRes[slot] == startTimeRes) return;
+
+  Int_t i = slot * kNDet + AliPIDResponse::kTOF;
+  std::fill(fNSigmaDone.begin() + i * kNSp, fNSigmaDone.begin() + (i + 1) * kNSp, 0);
+  fProbStatus[i] = -1;
+  fTOFStartTime[slot] = startTime;
+  fTOFStartTimeRes[slot] = startTimeRes;
+}
+
+/**
+ * Number of sigmas of a track from the expected signal of a given species in a detector,
+ * as given by AliPIDResponse::NumberOfSigmas().
+ * @param det Detector
+ * @param track Pointer to the track
+ * @param type Particle species
+ * @return Number of sigmas
+ */
+Float_t AliPIDNSigmaCache::NumberOfSigmas(AliPIDResponse::EDetector det, const AliVParticle* track, AliPID::EParticleType type)
+{
+  fNRequests++;
+  if (!track) return -999.;
+
+  if (!CheckEvent() || Int_t(det) < 0 || Int_t(det) >= kNDet || Int_t(type) < 0 || Int_t(type) >= kNSp) {
+    AliPIDResponse* pid = GetPIDResponse();
+    if (!pid) return -999.;
+    fNEvaluations++;
+    return pid->NumberOfSigmas(det, track, type);
+  }
+
+  Int_t slot = GetSlot(track);
+  if (det == AliPIDResponse::kTOF) CheckTOFStartTime(slot, track);
+  Int_t i = (slot * kNDet + det) * kNSp + type;
+  if (!fNSigmaDone[i]) {
+    fNEvaluations++;
+    fNSigma[i] = fEventPIDResponse->NumberOfSigmas(det, track, type);
+    fNSigmaDone[i] = 1;
+  }
+  return fNSigma[i];
+}
+
+/**
+ * Probabilities of a track for the different species in a detector,
+ * as given by AliPIDResponse::ComputePIDProbability().
+ * Only the probabilities for the AliPID::kSPECIES standard species are cached.
+ * @param det Detector
+ * @param track Pointer to the track
+ * @param nSpecies Number of species
+ * @param p Filled with the probabilities
+ * @return Status of the PID of the detector
+ */
+AliPIDResponse::EDetPidStatus AliPIDNSigmaCache::ComputePIDProbability(AliPIDResponse::EDetector det, const AliVTrack* track, Int_t nSpecies, Double_t p[])
+{
+  fNRequests++;
+  if (!track) return AliPIDResponse::kDetNoSignal;
+
+  if (!CheckEvent() || Int_t(det) < 0 || Int_t(det) >= kNDet || nSpecies != AliPID::kSPECIES) {
+    AliPIDResponse* pid = GetPIDResponse();
+    if (!pid) return AliPIDResponse::kDetNoSignal;
+    fNEvaluations++;
+    return pid->ComputePIDProbability(det, track, nSpecies, p);
+  }
+
+  Int_t slot = GetSlot(track);
+  if (det == AliPIDResponse::kTOF) CheckTOFStartTime(slot, track);
+  Int_t i = slot * kNDet + det;
+  Double_t* prob = &fProb[i * AliPID::kSPECIES];
+  if (fProbStatus[i] < 0) {
+    fNEvaluations++;
+    fProbStatus[i] = fEventPIDResponse->ComputePIDProbability(det, track, AliPID::kSPECIES, prob);
+  }
+  std::copy(prob, prob + AliPID::kSPECIES, p);
+  return static_cast<AliPIDResponse::EDetPidStatus>(fProbStatus[i]);
+}
@@ -0,0 +1,131 @@
+#ifndef ALIPIDNSIGMACACHE_H
+#define ALIPIDNSIGMACACHE_H
+
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+#include <unordered_map>
+#endif
+
+#include <TObject.h>
+
+#include "AliPID.h"
+#include "AliPIDResponse.h"
+
+class AliVEvent;
+class AliVParticle;
+class AliVTrack;
+
+/**
+ * @class AliPIDNSigmaCache
+ * @brief Per-event cache of the PID n-sigma and probabilities shared by all the tasks of a train
+ *
+ * The n-sigma (and the detector probabilities) of a track are computed by AliPIDResponse
+ * the first time they are requested in the event, and are then served from a
+ * compact track x detector x species table for the rest of the event, so that the same
+ * spline and parametrization lookups are not repeated by each task of the train and by
+ * each cut variation inside a task.
+ *
+ * The cache is reached through the static accessor Instance() and its methods have
+ * the same signature as the ones of AliPIDResponse, so that an existing helper
+ * can adopt it by replacing
+ * ~~~{.cxx}
+ * fPIDResponse->NumberOfSigmasTPC(track, AliPID::kPion);
+ * ~~~
+ * with
+ * ~~~{.cxx}
+ * AliPIDNSigmaCache::Instance()->NumberOfSigmasTPC(track, AliPID::kPion);
+ * ~~~
+ *
+ * The tracks are identified by their address in memory, with a check on their
+ * \f$ p_{T} \f$ and label to protect against a track created and deleted within the event
+ * (e.g. by an event mixing pool) whose address is later reused. The table is invalidated
+ * whenever the analysis manager moves to another entry or input event, or the PID response
+ * object changes. If no analysis manager is available (e.g. in a stand-alone macro), the
+ * event change cannot be detected and the requests are passed to AliPIDResponse
+ * without caching, unless the user calls NextEvent() explicitly at each event.
+ *
+ * The configuration of the PID response that tasks commonly change within an event is
+ * part of the cache key:
+ * - the TOF start time and its resolution at the momentum of the track (set by
+ *   AliPIDResponse::SetTOFResponse() for the chosen T0 mode): the TOF entries of a track
+ *   are recomputed if they differ from the ones the entries were computed with;
+ * - the tune-on-data settings and the centrality of the PID response: the whole table
+ *   is invalidated if they change.
+ *
+ * Any other change of the response configuration within an event (e.g. a different
+ * TPC response parametrization) must be followed by a call to Invalidate(),
+ * otherwise the values computed with the previous configuration are returned.
+ *
+ * The shared instance can be deleted with DeleteInstance(); this is also done
+ * automatically at the end of the program.
+ */
+class AliPIDNSigmaCache : public TObject {
+ public:
+  AliPIDNSigmaCache();
+  virtual ~AliPIDNSigmaCache() {;}
+
+  static AliPIDNSigmaCache   *Instance();
+  static void                 DeleteInstance();
+
+  void                        SetPIDResponse(AliPIDResponse* pid)                 { fPIDResponse = pid; Invalidate()  ; }
+  AliPIDResponse             *GetPIDResponse();
+
+  void                        NextEvent();
+  void                        Invalidate();
+
+  Float_t                     NumberOfSigmas(AliPIDResponse::EDetector det, const AliVParticle* track, AliPID::EParticleType type);
+  Float_t                     NumberOfSigmasITS(const AliVParticle* track, AliPID::EParticleType type) { return NumberOfSigmas(AliPIDResponse::kITS, track, type); }
+  Float_t                     NumberOfSigmasTPC(const AliVParticle* track, AliPID::EParticleType type) { return NumberOfSigmas(AliPIDResponse::kTPC, track, type); }
+  Float_t                     NumberOfSigmasTOF(const AliVParticle* track, AliPID::EParticleType type) { return NumberOfSigmas(AliPIDResponse::kTOF, track, type); }
+
+  AliPIDResponse::EDetPidStatus ComputePIDProbability(AliPIDResponse::EDetector det, const AliVTrack* track, Int_t nSpecies, Double_t p[]);
+
+  Int_t                       GetNCachedTracks()                                  const { return fNSlots                          ; }
+  ULong64_t                   GetNRequests()                                      const { return fNRequests                       ; }
+  ULong64_t                   GetNEvaluations()                                   const { return fNEvaluations                    ; }
+
+ protected:
+  enum { kNDet = AliPIDResponse::kNdetectors, kNSp = AliPID::kSPECIESC };
+
+  Bool_t                      CheckEvent();
+  Int_t                       GetSlot(const AliVParticle* track);
+  void                        CheckTOFStartTime(Int_t slot, const AliVParticle* track);
+
+  static AliPIDNSigmaCache   *fgInstance;            //!<! instance shared by all the tasks
+
+  AliPIDResponse             *fPIDResponse;          //!<! PID response used to fill the cache
+  Bool_t                      fManualEvents;         //!<! event changes signalled by the user with NextEvent()
+  Long64_t                    fEntry;                //!<! analysis manager entry the cache was filled for
+  AliVEvent                  *fEvent;                //!<! input event the cache was filled for
+  AliPIDResponse             *fEventPIDResponse;     //!<! PID response the cache was filled with
+  Bool_t                      fEventTuneOnData;      //!<! tune-on-data flag of the PID response the cache was filled with
+  Int_t                       fEventTuneOnDataMask;  //!<! tune-on-data detector mask of the PID response the cache was filled with
+  Float_t                     fEventCentrality;      //!<! centrality of the PID response the cache was filled with
+  Int_t                       fNSlots;               //!<! number of tracks in the cache
+  std::vector<Float_t>        fTrackPt;              //!<! pt of the track in each slot
+  std::vector<Int_t>          fTrackLabel;           //!<! label of the track in each slot
+  std::vector<Float_t>        fTOFStartTime;         //!<! TOF start time the TOF entries of each slot were computed with
+  std::vector<Float_t>        fTOFStartTimeRes;      //!<! TOF start time resolution the TOF entries of each slot were computed with
+  std::vector<Float_t>        fNSigma;               //!<! n-sigma, slot x detector x species
+  std::vector<Char_t>         fNSigmaDone;           //!<! whether the n-sigma was computed, slot x detector x species
+  std::vector<Double_t>       fProb;                 //!<! probabilities for AliPID::kSPECIES species, slot x detector x species
+  std::vector<Int_t>          fProbStatus;           //!<! detector PID status of the probabilities (-1 if not computed), slot x detector
+  ULong64_t                   fNRequests;            //!<! number of requests (monitoring)
+  ULong64_t                   fNEvaluations;         //!<! number of requests passed to the PID response (monitoring)
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+  std::unordered_map<const AliVParticle*, Int_t> fSlots; //!<! track -> slot
+#endif
+
+ private:
+  AliPIDNSigmaCache(const AliPIDNSigmaCache&);            // not implemented
+  AliPIDNSigmaCache& operator=(const AliPIDNSigmaCache&); // not implemented
+
+  /// \cond CLASSIMP
+  ClassDef(AliPIDNSigmaCache, 2);
+  /// \endcond
+};
+
+#endif
@@ -38,6 +38,8 @@
 #include "TArrayF.h"
 #include "TArrayD.h"
 #include "THnSparse.h"
+#include "TH1D.h"
+#include "TH2D.h"
 #include "TMath.h"
 
 templateClassImp(AliTHnT)
@@ -53,7 +55,11 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT() :
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fCumulStep(-1),
+  fCumulAxes(0),
+  fCumulValues(0),
+  fCumulSumw2(0)
 {
   // Constructor
 }
@@ -69,7 +75,11 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const Char_t* name, const Char_t*
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fCumulStep(-1),
+  fCumulAxes(0),
+  fCumulValues(0),
+  fCumulSumw2(0)
 {
   // Constructor
 
@@ -106,7 +116,11 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const AliTHnT &c) :
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fCumulStep(-1),
+  fCumulAxes(0),
+  fCumulValues(0),
+  fCumulSumw2(0)
 {
   //
   // AliTHnT copy constructor
@@ -135,6 +149,7 @@ AliTHnT<TemplateArray, TemplateType>::~AliTHnT()
   delete[] fNbinsCache;
   delete[] fLastVars;
   delete[] fLastBins;
+  DeleteCumulativeTable();
 }
 
 template <class TemplateArray, typename TemplateType>
@@ -166,6 +181,7 @@ AliTHnT<TemplateArray, TemplateType> &AliTHnT<TemplateArray, TemplateType>::oper
 
   if (this != &c) {
     AliCFContainer::operator=(c);
+    DeleteCumulativeTable();
     fNBins=c.fNBins;
     fNVars=c.fNVars;
     if(fNSteps) {
@@ -212,6 +228,7 @@ void AliTHnT<TemplateArray, TemplateType>::Copy(TObject& c) const
   target.fNBins = fNBins;
   target.fNVars = fNVars;
   
+  target.DeleteCumulativeTable();
   target.Init();
 
   for (Int_t i=0; i<fNSteps; i++)
@@ -243,6 +260,7 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
     return 1;
   
   AliCFContainer::Merge(list);
+  DeleteCumulativeTable();
 
   TIterator* iter = list->MakeIterator();
   TObject* obj;
@@ -334,6 +352,9 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //     Printf("%lld", bin);
   }
 
+  if (fCumulValues)
+    DeleteCumulativeTable();
+
   if (!fValues[istep])
   {
     fValues[istep] = new TemplateArray(fNBins);
@@ -457,6 +478,8 @@ void AliTHnT<TemplateArray, TemplateType>::ReduceAxis()
   // "removes" one axis by summing over the axis and putting the entry to bin 1
   // TODO presently only implemented for the last axis
   
+  DeleteCumulativeTable();
+
   Int_t axis = fNVars-1;
   
   for (Int_t i=0; i<fNSteps; i++)
@@ -531,5 +554,326 @@ void AliTHnT<TemplateArray, TemplateType>::ReduceAxis()
   }
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::DeleteCumulativeTable()
+{
+  // deletes the cumulative table built with BuildCumulativeTable
+  
+  delete fCumulValues;
+  delete fCumulSumw2;
+  delete[] fCumulAxes;
+  fCumulValues = 0;
+  fCumulSumw2 = 0;
+  fCumulAxes = 0;
+  fCumulStep = -1;
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::BuildCumulativeTable(Int_t step, Int_t nAxes, const Int_t* axes)
+{
+  // builds for step <step> the cumulative sums of the content (and sumw2) along the axes <axes>
+  // with these, the sum over a bin range of each of these axes in ProjectionRange1D/2D is obtained
+  // from the two edges of the range instead of looping over all its bins.
+  // Useful when many projections with different ranges are requested (e.g. loops over centrality and pT ranges);
+  // the table takes 8 bytes per bin (16 with sumw2) and is deleted when the container is filled or modified
+  
+  DeleteCumulativeTable();
+  
+  if (step < 0 || step >= fNSteps || !fValues[step])
+    return;
+  
+  fCumulAxes = new Bool_t[fNVars];
+  for (Int_t i=0; i<fNVars; i++)
+    fCumulAxes[i] = kFALSE;
+  for (Int_t i=0; i<nAxes; i++)
+    if (axes[i] >= 0 && axes[i] < fNVars)
+      fCumulAxes[axes[i]] = kTRUE;
+  
+  fCumulValues = new TArrayD(fNBins);
+  if (fSumw2[step])
+    fCumulSumw2 = new TArrayD(fNBins);
+  
+  for (Long64_t l = 0; l<fNBins; l++)
+  {
+    fCumulValues->GetArray()[l] = fValues[step]->GetArray()[l];
+    if (fCumulSumw2)
+      fCumulSumw2->GetArray()[l] = fSumw2[step]->GetArray()[l];
+  }
+  
+  // one cumulative sum per axis; bin l-stride has already been summed when l is reached
+  Long64_t stride = 1;
+  for (Int_t i=fNVars-1; i>=0; i--)
+  {
+    Int_t nBins = GetAxis(i, step)->GetNbins();
+    if (fCumulAxes[i])
+    {
+      for (Long64_t l = 0; l<fNBins; l++)
+      {
+	if ((l / stride) % nBins == 0)
+	  continue;
+	fCumulValues->GetArray()[l] += fCumulValues->GetArray()[l - stride];
+	if (fCumulSumw2)
+	  fCumulSumw2->GetArray()[l] += fCumulSumw2->GetArray()[l - stride];
+      }
+    }
+    stride *= nBins;
+  }
+  
+  fCumulStep = step;
+}
+
+template <typename T>
+static void AliTHnSumRange(Int_t nVars, const Long64_t* strides, const Int_t* nPos, Int_t** pos, Int_t** sign,
+                           Int_t nProj, const Int_t* projAxes, const Int_t* firstBins, Int_t nOutX,
+                           const T* source, const T* sourceSumw2, Double_t* values, Double_t* sumw2)
+{
+  // loops over the bins (or cumulative table edges) listed in pos for each axis and
+  // adds their content to the projection, the last axis (contiguous in memory) being the fastest
+
+  Int_t* idx = new Int_t[nVars];
+  for (Int_t i=0; i<nVars; i++)
+    idx[i] = 0;
+
+  while (1)
+  {
+    Long64_t globalBin = 0;
+    Int_t s = 1;
+    for (Int_t i=0; i<nVars; i++)
+    {
+      globalBin += pos[i][idx[i]] * strides[i];
+      s *= sign[i][idx[i]];
+    }
+    
+    Int_t outBin = pos[projAxes[0]][idx[projAxes[0]]] - firstBins[0];
+    if (nProj > 1)
+      outBin += nOutX * (pos[projAxes[1]][idx[projAxes[1]]] - firstBins[1]);
+    
+    values[outBin] += s * source[globalBin];
+    sumw2[outBin] += s * sourceSumw2[globalBin];
+    
+    Int_t i = nVars-1;
+    for (; i>=0; i--)
+    {
+      if (++idx[i] < nPos[i])
+	break;
+      idx[i] = 0;
+    }
+    if (i < 0)
+      break;
+  }
+  
+  delete[] idx;
+}
+
+template <class TemplateArray, typename TemplateType>
+Bool_t AliTHnT<TemplateArray, TemplateType>::ProjectRange(Int_t step, Int_t nProj, const Int_t* projAxes, const Int_t* firstBins, const Int_t* lastBins, Double_t* values, Double_t* sumw2)
+{
+  // sums the content of step <step> over the bin ranges [firstBins[i], lastBins[i]] (TAxis bin numbers) of all the axes
+  // into the <nProj> (1 or 2) axes <projAxes>; if firstBins/lastBins are not given, the axis ranges
+  // (as set e.g. by GetGrid(step)->GetGrid()->GetAxis(i)->SetRangeUser) are used
+  // values and sumw2 are filled in the range of the projected axes, x fastest
+  // if no sumw2 is stored, sumw2 contains the sum of the values
+  // uses the cumulative table for the axes it was built for (see BuildCumulativeTable)
+
+  if (step < 0 || step >= fNSteps || !fValues[step])
+    return kFALSE;
+
+  Bool_t useTable = (fCumulStep == step && fCumulValues);
+  for (Int_t j=0; j<nProj; j++)
+    if (useTable && fCumulAxes[projAxes[j]])
+      useTable = kFALSE;
+
+  Long64_t* strides = new Long64_t[fNVars];
+  Int_t* first = new Int_t[fNVars];
+  Int_t* nPos = new Int_t[fNVars];
+  Int_t** pos = new Int_t*[fNVars];
+  Int_t** sign = new Int_t*[fNVars];
+  
+  Bool_t empty = kFALSE;
+  Long64_t stride = 1;
+  for (Int_t i=fNVars-1; i>=0; i--)
+  {
+    TAxis* axis = GetAxis(i, step);
+    Int_t nBins = axis->GetNbins();
+    strides[i] = stride;
+    stride *= nBins;
+    
+    // bins start from 0 here
+    first[i] = TMath::Max(1, (firstBins) ? firstBins[i] : axis->GetFirst()) - 1;
+    Int_t last = TMath::Min(nBins, (lastBins) ? lastBins[i] : axis->GetLast()) - 1;
+    if (last < first[i])
+      empty = kTRUE;
+    
+    Bool_t isProj = kFALSE;
+    for (Int_t j=0; j<nProj; j++)
+      if (projAxes[j] == i)
+        isProj = kTRUE;
+    
+    if (useTable && !isProj && fCumulAxes[i])
+    {
+      // edges of the range in the cumulative table
+      nPos[i] = (first[i] > 0) ? 2 : 1;
+      pos[i] = new Int_t[2];
+      sign[i] = new Int_t[2];
+      pos[i][0] = last;
+      sign[i][0] = 1;
+      pos[i][1] = first[i] - 1;
+      sign[i][1] = -1;
+    }
+    else
+    {
+      nPos[i] = TMath::Max(0, last - first[i] + 1);
+      pos[i] = new Int_t[TMath::Max(1, nPos[i])];
+      sign[i] = new Int_t[TMath::Max(1, nPos[i])];
+      for (Int_t j=0; j<nPos[i]; j++)
+      {
+	pos[i][j] = first[i] + j;
+	sign[i][j] = 1;
+      }
+    }
+  }
+  
+  if (!empty)
+  {
+    Int_t projFirst[2] = { first[projAxes[0]], (nProj > 1) ? first[projAxes[1]] : 0 };
+    Int_t nOutX = nPos[projAxes[0]];
+    
+    if (useTable)
+      AliTHnSumRange<Double_t>(fNVars, strides, nPos, pos, sign, nProj, projAxes, projFirst, nOutX,
+                               fCumulValues->GetArray(), (fCumulSumw2) ? fCumulSumw2->GetArray() : fCumulValues->GetArray(), values, sumw2);
+    else
+      AliTHnSumRange<TemplateType>(fNVars, strides, nPos, pos, sign, nProj, projAxes, projFirst, nOutX,
+                                   fValues[step]->GetArray(), (fSumw2[step]) ? fSumw2[step]->GetArray() : fValues[step]->GetArray(), values, sumw2);
+  }
+  
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    delete[] pos[i];
+    delete[] sign[i];
+  }
+  delete[] pos;
+  delete[] sign;
+  delete[] nPos;
+  delete[] first;
+  delete[] strides;
+  
+  return !empty;
+}
+
+template <class TemplateArray, typename TemplateType>
+TH1D* AliTHnT<TemplateArray, TemplateType>::ProjectionRange1D(Int_t step, Int_t axis, const Int_t* firstBins, const Int_t* lastBins, const char* name)
+{
+  // projects step <step> onto axis <axis>, summing the other axes over the ranges [firstBins[i], lastBins[i]] (TAxis bin numbers)
+  // if firstBins/lastBins are not given, the ranges set on the axes are used, as in THnSparse::Projection
+  // the histogram has the full binning of the axis and is filled only in its range
+  // computed from the dense arrays, without the need of calling FillParent() first
+  // the caller owns the returned histogram
+  
+  if (step < 0 || step >= fNSteps || axis < 0 || axis >= fNVars)
+    return 0;
+
+  TAxis* ax = GetAxis(axis, step);
+  Int_t nBins = ax->GetNbins();
+  
+  TString histName = (name) ? TString(name) : TString(Form("%s_proj_%d", GetName(), axis));
+  TH1D* hist = 0;
+  if (ax->GetXbins()->GetSize() > 0)
+    hist = new TH1D(histName, GetTitle(), nBins, ax->GetXbins()->GetArray());
+  else
+    hist = new TH1D(histName, GetTitle(), nBins, ax->GetXmin(), ax->GetXmax());
+  hist->GetXaxis()->SetTitle(ax->GetTitle());
+  hist->Sumw2();
+  
+  Double_t* values = new Double_t[nBins];
+  Double_t* sumw2 = new Double_t[nBins];
+  for (Int_t i=0; i<nBins; i++)
+    values[i] = sumw2[i] = 0;
+  
+  Int_t projAxes[1] = { axis };
+  if (ProjectRange(step, 1, projAxes, firstBins, lastBins, values, sumw2))
+  {
+    Int_t first = TMath::Max(1, (firstBins) ? firstBins[axis] : ax->GetFirst());
+    Int_t last = TMath::Min(nBins, (lastBins) ? lastBins[axis] : ax->GetLast());
+    Double_t entries = 0;
+    for (Int_t bin=first; bin<=last; bin++)
+    {
+      hist->SetBinContent(bin, values[bin-first]);
+      hist->SetBinError(bin, TMath::Sqrt(TMath::Abs(sumw2[bin-first])));
+      entries += values[bin-first];
+    }
+    hist->SetEntries(entries);
+  }
+  
+  delete[] values;
+  delete[] sumw2;
+  
+  return hist;
+}
+
+template <class TemplateArray, typename TemplateType>
+TH2D* AliTHnT<TemplateArray, TemplateType>::ProjectionRange2D(Int_t step, Int_t xAxis, Int_t yAxis, const Int_t* firstBins, const Int_t* lastBins, const char* name)
+{
+  // projects step <step> onto axes <xAxis> (x of the histogram) and <yAxis> (y of the histogram),
+  // summing the other axes over the ranges [firstBins[i], lastBins[i]] (TAxis bin numbers)
+  // if firstBins/lastBins are not given, the ranges set on the axes are used
+  // NOTE the order of the arguments is (x, y), contrary to THnSparse::Projection(y, x)
+  // the histogram has the full binning of the axes and is filled only in their ranges
+  // computed from the dense arrays, without the need of calling FillParent() first
+  // the caller owns the returned histogram
+  
+  if (step < 0 || step >= fNSteps || xAxis < 0 || xAxis >= fNVars || yAxis < 0 || yAxis >= fNVars || xAxis == yAxis)
+    return 0;
+
+  TAxis* ax[2] = { GetAxis(xAxis, step), GetAxis(yAxis, step) };
+  
+  TString histName = (name) ? TString(name) : TString(Form("%s_proj_%d_%d", GetName(), yAxis, xAxis));
+  TH2D* hist = 0;
+  if (ax[0]->GetXbins()->GetSize() > 0 && ax[1]->GetXbins()->GetSize() > 0)
+    hist = new TH2D(histName, GetTitle(), ax[0]->GetNbins(), ax[0]->GetXbins()->GetArray(), ax[1]->GetNbins(), ax[1]->GetXbins()->GetArray());
+  else if (ax[0]->GetXbins()->GetSize() > 0)
+    hist = new TH2D(histName, GetTitle(), ax[0]->GetNbins(), ax[0]->GetXbins()->GetArray(), ax[1]->GetNbins(), ax[1]->GetXmin(), ax[1]->GetXmax());
+  else if (ax[1]->GetXbins()->GetSize() > 0)
+    hist = new TH2D(histName, GetTitle(), ax[0]->GetNbins(), ax[0]->GetXmin(), ax[0]->GetXmax(), ax[1]->GetNbins(), ax[1]->GetXbins()->GetArray());
+  else
+    hist = new TH2D(histName, GetTitle(), ax[0]->GetNbins(), ax[0]->GetXmin(), ax[0]->GetXmax(), ax[1]->GetNbins(), ax[1]->GetXmin(), ax[1]->GetXmax());
+  hist->GetXaxis()->SetTitle(ax[0]->GetTitle());
+  hist->GetYaxis()->SetTitle(ax[1]->GetTitle());
+  hist->Sumw2();
+  
+  Int_t projAxes[2] = { xAxis, yAxis };
+  Int_t first[2], last[2];
+  for (Int_t j=0; j<2; j++)
+  {
+    first[j] = TMath::Max(1, (firstBins) ? firstBins[projAxes[j]] : ax[j]->GetFirst());
+    last[j] = TMath::Min(ax[j]->GetNbins(), (lastBins) ? lastBins[projAxes[j]] : ax[j]->GetLast());
+  }
+  Int_t nX = TMath::Max(0, last[0] - first[0] + 1);
+  Int_t nY = TMath::Max(0, last[1] - first[1] + 1);
+  
+  Double_t* values = new Double_t[TMath::Max(1, nX * nY)];
+  Double_t* sumw2 = new Double_t[TMath::Max(1, nX * nY)];
+  for (Int_t i=0; i<nX * nY; i++)
+    values[i] = sumw2[i] = 0;
+  
+  if (ProjectRange(step, 2, projAxes, firstBins, lastBins, values, sumw2))
+  {
+    Double_t entries = 0;
+    for (Int_t binY=first[1]; binY<=last[1]; binY++)
+      for (Int_t binX=first[0]; binX<=last[0]; binX++)
+      {
+        Int_t i = (binY - first[1]) * nX + (binX - first[0]);
+        hist->SetBinContent(binX, binY, values[i]);
+        hist->SetBinError(binX, binY, TMath::Sqrt(TMath::Abs(sumw2[i])));
+        entries += values[i];
+      }
+    hist->SetEntries(entries);
+  }
+  
+  delete[] values;
+  delete[] sumw2;
+  
+  return hist;
+}
+
 template class AliTHnT<TArrayF, Float_t>;
 template class AliTHnT<TArrayD, Double_t>;
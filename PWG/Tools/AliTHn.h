@@ -18,6 +18,8 @@ class TArray;
 class TArrayF;
 class TArrayD;
 class TCollection;
+class TH1D;
+class TH2D;
 
 class AliTHnBase : public AliCFContainer
 {
@@ -57,6 +59,12 @@ class AliTHnT : public AliTHnBase
   virtual void DeleteContainers();
   virtual void ReduceAxis();
   
+  // projections computed directly from the dense arrays (no FillParent needed)
+  TH1D* ProjectionRange1D(Int_t step, Int_t axis, const Int_t* firstBins = 0, const Int_t* lastBins = 0, const char* name = 0);
+  TH2D* ProjectionRange2D(Int_t step, Int_t xAxis, Int_t yAxis, const Int_t* firstBins = 0, const Int_t* lastBins = 0, const char* name = 0);
+  void BuildCumulativeTable(Int_t step, Int_t nAxes, const Int_t* axes);
+  void DeleteCumulativeTable();
+  
   AliTHnT(const AliTHnT &c);
   AliTHnT& operator=(const AliTHnT& corr);
   virtual void Copy(TObject& c) const;
@@ -66,6 +74,7 @@ class AliTHnT : public AliTHnBase
 protected:
   void Init();
   Long64_t GetGlobalBinIndex(const Int_t* binIdx);
+  Bool_t ProjectRange(Int_t step, Int_t nProj, const Int_t* projAxes, const Int_t* firstBins, const Int_t* lastBins, Double_t* values, Double_t* sumw2);
   
   Long64_t fNBins;   // number of total bins
   Int_t    fNVars;   // number of variables
@@ -78,7 +87,12 @@ protected:
   Double_t* fLastVars; //! caching of last used bins (in many loops some vars are the same for a while)
   Int_t* fLastBins; //! caching of last used bins (in many loops some vars are the same for a while)
   
-  ClassDef(AliTHnT, 5) // THn like container
+  Int_t fCumulStep;         //! step of the cumulative table (-1 if not built)
+  Bool_t* fCumulAxes;       //! axes along which the cumulative table is summed
+  TArrayD* fCumulValues;    //! cumulative sums of the values along fCumulAxes
+  TArrayD* fCumulSumw2;     //! cumulative sums of sumw2 along fCumulAxes (0 if no sumw2)
+  
+  ClassDef(AliTHnT, 6) // THn like container
 };
 
 typedef AliTHnT<TArrayF, Float_t> AliTHn;
@@ -8,7 +8,9 @@
 #pragma link C++ class AliBasicParticle+;
 #pragma link C++ class AliFigure+;
 #pragma link C++ class AliCanvas+;
+#pragma link C++ class AliEventShapeTools+;
 #pragma link C++ class AliHelperPID+;
+#pragma link C++ class AliPIDNSigmaCache+;
 #pragma link C++ class AliLatexTable+;
 #pragma link C++ class AliNamedArrayI+;
 #pragma link C++ class AliNamedString+;
@@ -37,4 +39,5 @@
 #pragma link C++ function TestTHistManager::TestRunBuildGrouped();
 #pragma link C++ function TestTHistManager::TestRunFillSimple();
 #pragma link C++ function TestTHistManager::TestRunFillGrouped();
+#pragma link C++ function TestTHistManager::TestRunFillHandles();
 #endif
@@ -420,15 +420,7 @@ void THistManager::FillTH1(const char *name, double x, double weight, Option_t *
 		Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
-	TString optionstring(opt);
-	if(optionstring.Contains("w")){
-	  // use bin width as weight
-	  Int_t bin = hist->GetXaxis()->FindBin(x);
-	  // check if not overflow or underflow bin
-	  if(bin != 0 && bin != hist->GetXaxis()->GetNbins())
-	    weight = 1./hist->GetXaxis()->GetBinWidth(bin);
-	}
-	hist->Fill(x, weight);
+	FillTH1(TH1Handle(hist), x, weight, opt);
 }
 
 void THistManager::FillTH1(const char *name, const char *label, double weight, Option_t *opt) {
@@ -442,6 +434,146 @@ void THistManager::FillTH1(const char *name, const char *label, double weight, O
   if(!hist){
     Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
     return;
+  }
+  FillTH1(TH1Handle(hist), label, weight, opt);
+}
+
+void THistManager::FillTH2(const char *name, double x, double y, double weight, Option_t *opt) {
+	TString dirname(basename(name)), hname(histname(name));
+	THashList *parent(FindGroup(dirname));
+	if(!parent){
+		Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
+		return;
+	}
+	TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
+	if(!hist){
+		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		return;
+	}
+	FillTH2(TH2Handle(hist), x, y, weight, opt);
+}
+
+void THistManager::FillTH2(const char *name, double *point, double weight, Option_t *opt) {
+	TString dirname(basename(name)), hname(histname(name));
+	THashList *parent(FindGroup(dirname));
+	if(!parent){
+		Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
+		return;
+	}
+	TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
+	if(!hist){
+		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		return;
+	}
+	FillTH2(TH2Handle(hist), point, weight, opt);
+}
+
+void THistManager::FillTH3(const char* name, double x, double y, double z, double weight, Option_t *opt) {
+	TString dirname(basename(name)), hname(histname(name));
+	THashList *parent(FindGroup(dirname));
+	if(!parent){
+		Fatal("THistManager::FillTH3", "Parent group %s does not exist", dirname.Data());
+		return;
+	}
+	TH3 *hist = dynamic_cast<TH3 *>(parent->FindObject(hname));
+	if(!hist){
+		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		return;
+	}
+	FillTH3(TH3Handle(hist), x, y, z, weight, opt);
+}
+
+void THistManager::FillTH3(const char* name, const double* point, double weight, Option_t *opt) {
+	TString dirname(basename(name)), hname(histname(name));
+	THashList *parent(FindGroup(dirname));
+	if(!parent){
+		Fatal("THistManager::FillTH3", "Parent group %s does not exist", dirname.Data());
+		return;
+	}
+	TH3 *hist = dynamic_cast<TH3 *>(parent->FindObject(hname));
+	if(!hist){
+		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		return;
+	}
+	FillTH3(TH3Handle(hist), point, weight, opt);
+}
+
+void THistManager::FillTHnSparse(const char *name, const double *x, double weight, Option_t *opt) {
+	TString dirname(basename(name)), hname(histname(name));
+	THashList *parent(FindGroup(dirname));
+	if(!parent){
+		Fatal("THistManager::FillTHnSparse", "Parent group %s does not exist", dirname.Data());
+		return;
+	}
+	THnSparseD *hist = dynamic_cast<THnSparseD *>(parent->FindObject(hname));
+	if(!hist){
+		Fatal("THistManager::FillTHnSparse", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		return;
+	}
+	FillTHnSparse(THnSparseHandle(hist), x, weight, opt);
+}
+
+void THistManager::FillProfile(const char* name, double x, double y, double weight){
+  TString dirname(basename(name)), hname(histname(name));
+  THashList *parent(FindGroup(dirname));
+  if(!parent)
+		Fatal("THistManager::FillTProfile", "Parent group %s does not exist", dirname.Data());
+  TProfile *hist = dynamic_cast<TProfile *>(parent->FindObject(hname));
+  if(!hist)
+		Fatal("THistManager::FillTProfile", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+  FillProfile(TProfileHandle(hist), x, y, weight);
+}
+
+template<typename T>
+T *THistManager::FindHistogramForHandle(const char *name) const {
+  TString dirname(basename(name)), hname(histname(name));
+  THashList *parent(FindGroup(dirname));
+  if(!parent) return nullptr;
+  return dynamic_cast<T *>(parent->FindObject(hname));
+}
+
+THistManager::TH1Handle THistManager::GetTH1Handle(const char *name) const {
+  return TH1Handle(FindHistogramForHandle<TH1>(name));
+}
+
+THistManager::TH2Handle THistManager::GetTH2Handle(const char *name) const {
+  return TH2Handle(FindHistogramForHandle<TH2>(name));
+}
+
+THistManager::TH3Handle THistManager::GetTH3Handle(const char *name) const {
+  return TH3Handle(FindHistogramForHandle<TH3>(name));
+}
+
+THistManager::THnSparseHandle THistManager::GetTHnSparseHandle(const char *name) const {
+  return THnSparseHandle(FindHistogramForHandle<THnSparse>(name));
+}
+
+THistManager::TProfileHandle THistManager::GetTProfileHandle(const char *name) const {
+  return TProfileHandle(FindHistogramForHandle<TProfile>(name));
+}
+
+void THistManager::FillTH1(const TH1Handle &handle, double x, double weight, Option_t *opt) {
+	TH1 *hist = handle.GetHistogram();
+	if(!hist){
+		Fatal("THistManager::FillTH1", "Invalid histogram handle");
+		return;
+	}
+	TString optionstring(opt);
+	if(optionstring.Contains("w")){
+	  // use bin width as weight
+	  Int_t bin = hist->GetXaxis()->FindBin(x);
+	  // check if not overflow or underflow bin
+	  if(bin != 0 && bin != hist->GetXaxis()->GetNbins())
+	    weight = 1./hist->GetXaxis()->GetBinWidth(bin);
+	}
+	hist->Fill(x, weight);
+}
+
+void THistManager::FillTH1(const TH1Handle &handle, const char *label, double weight, Option_t *opt) {
+  TH1 *hist = handle.GetHistogram();
+  if(!hist){
+    Fatal("THistManager::FillTH1", "Invalid histogram handle");
+    return;
   }
 	TString optionstring(opt);
 	if(optionstring.Contains("w")){
@@ -455,16 +587,10 @@ void THistManager::FillTH1(const char *name, const char *label, double weight, O
   hist->Fill(label, weight);
 }
 
-void THistManager::FillTH2(const char *name, double x, double y, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
+void THistManager::FillTH2(const TH2Handle &handle, double x, double y, double weight, Option_t *opt) {
+	TH2 *hist = handle.GetHistogram();
 	if(!hist){
-		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		Fatal("THistManager::FillTH2", "Invalid histogram handle");
 		return;
 	}
 	TString optstring(opt);
@@ -480,16 +606,10 @@ void THistManager::FillTH2(const char *name, double x, double y, double weight,
 	hist->Fill(x, y, myweight);
 }
 
-void THistManager::FillTH2(const char *name, double *point, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
+void THistManager::FillTH2(const TH2Handle &handle, double *point, double weight, Option_t *opt) {
+	TH2 *hist = handle.GetHistogram();
 	if(!hist){
-		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		Fatal("THistManager::FillTH2", "Invalid histogram handle");
 		return;
 	}
 	TString optstring(opt);
@@ -505,16 +625,10 @@ void THistManager::FillTH2(const char *name, double *point, double weight, Optio
 	hist->Fill(point[0], point[1], weight);
 }
 
-void THistManager::FillTH3(const char* name, double x, double y, double z, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH3", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH3 *hist = dynamic_cast<TH3 *>(parent->FindObject(hname));
+void THistManager::FillTH3(const TH3Handle &handle, double x, double y, double z, double weight, Option_t *opt) {
+	TH3 *hist = handle.GetHistogram();
 	if(!hist){
-		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		Fatal("THistManager::FillTH3", "Invalid histogram handle");
 		return;
 	}
 	TString optstring(opt);
@@ -534,16 +648,10 @@ void THistManager::FillTH3(const char* name, double x, double y, double z, doubl
 	hist->Fill(x, y, z, weight);
 }
 
-void THistManager::FillTH3(const char* name, const double* point, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTH3", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	TH3 *hist = dynamic_cast<TH3 *>(parent->FindObject(hname));
+void THistManager::FillTH3(const TH3Handle &handle, const double* point, double weight, Option_t *opt) {
+	TH3 *hist = handle.GetHistogram();
 	if(!hist){
-		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		Fatal("THistManager::FillTH3", "Invalid histogram handle");
 		return;
 	}
 	TString optstring(opt);
@@ -563,16 +671,10 @@ void THistManager::FillTH3(const char* name, const double* point, double weight,
 	hist->Fill(point[0], point[1], point[2], weight);
 }
 
-void THistManager::FillTHnSparse(const char *name, const double *x, double weight, Option_t *opt) {
-	TString dirname(basename(name)), hname(histname(name));
-	THashList *parent(FindGroup(dirname));
-	if(!parent){
-		Fatal("THistManager::FillTHnSparse", "Parent group %s does not exist", dirname.Data());
-		return;
-	}
-	THnSparseD *hist = dynamic_cast<THnSparseD *>(parent->FindObject(hname));
+void THistManager::FillTHnSparse(const THnSparseHandle &handle, const double *x, double weight, Option_t *opt) {
+	THnSparse *hist = handle.GetHistogram();
 	if(!hist){
-		Fatal("THistManager::FillTHnSparse", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		Fatal("THistManager::FillTHnSparse", "Invalid histogram handle");
 		return;
 	}
 	TString optstring(opt);
@@ -589,14 +691,10 @@ void THistManager::FillTHnSparse(const char *name, const double *x, double weigh
 	hist->Fill(x, weight);
 }
 
-void THistManager::FillProfile(const char* name, double x, double y, double weight){
-  TString dirname(basename(name)), hname(histname(name));
-  THashList *parent(FindGroup(dirname));
-  if(!parent)
-		Fatal("THistManager::FillTProfile", "Parent group %s does not exist", dirname.Data());
-  TProfile *hist = dynamic_cast<TProfile *>(parent->FindObject(hname));
+void THistManager::FillProfile(const TProfileHandle &handle, double x, double y, double weight){
+  TProfile *hist = handle.GetHistogram();
   if(!hist)
-		Fatal("THistManager::FillTProfile", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+		Fatal("THistManager::FillTProfile", "Invalid histogram handle");
   hist->Fill(x, y, weight);
 }
 
@@ -1005,6 +1103,70 @@ namespace TestTHistManager {
     return success ? 0 : 1;
   }
 
+  int THistManagerTestSuite::TestFillHandleHistograms(){
+    THistManager testmgr("testmgr");
+
+    testmgr.CreateTH1("Group1/Test1", "Test fill 1D histogram via handle", 1, 0., 1.);
+    testmgr.CreateTH2("Group1/Test2", "Test fill 2D histogram via handle", 1, 0., 1., 1, 0., 1.);
+    testmgr.CreateTH3("Group2/Test3", "Test fill 3D histogram via handle", 1, 0., 1., 1, 0., 1., 1, 0., 1.);
+    int nbins[4] = {1,1,1,1}; double min[4] = {0.,0.,0.,0.}, max[4] = {1.,1.,1.,1.};
+    testmgr.CreateTHnSparse("Group2/TestN", "Test fill THnSparse via handle", 4, nbins, min, max);
+    testmgr.CreateTProfile("Group3/Subgroup1/TestProfile", "Test fill profile via handle", 1, 0., 1.);
+
+    bool success(true);
+
+    THistManager::TH1Handle h1 = testmgr.GetTH1Handle("Group1/Test1");
+    THistManager::TH2Handle h2 = testmgr.GetTH2Handle("Group1/Test2");
+    THistManager::TH3Handle h3 = testmgr.GetTH3Handle("Group2/Test3");
+    THistManager::THnSparseHandle hN = testmgr.GetTHnSparseHandle("Group2/TestN");
+    THistManager::TProfileHandle hP = testmgr.GetTProfileHandle("Group3/Subgroup1/TestProfile");
+    if(!(h1.IsValid() && h2.IsValid() && h3.IsValid() && hN.IsValid() && hP.IsValid())){
+      std::cout << "Handle not valid for an existing histogram" << std::endl;
+      return 1;
+    }
+    if(testmgr.GetTH1Handle("Group1/NotExisting").IsValid() || testmgr.GetTH1Handle("NotExisting/Test1").IsValid()){
+      std::cout << "Valid handle for a non-existing histogram" << std::endl;
+      success = false;
+    }
+    if(testmgr.GetTH3Handle("Group1/Test2").IsValid()){
+      std::cout << "Valid handle for a histogram of a different type" << std::endl;
+      success = false;
+    }
+
+    double point[4] = {0.5, 0.5, 0.5, 0.5};
+    for(int i = 0; i < 100; i++){
+      testmgr.FillTH1(h1, 0.5);
+      testmgr.FillTH2(h2, 0.5, 0.5);
+      testmgr.FillTH3(h3, 0.5, 0.5, 0.5);
+      testmgr.FillTHnSparse(hN, point);
+      testmgr.FillProfile(hP, 0.5, 1.);
+    }
+
+    // Evaluate test
+    if(TMath::Abs(h1.GetHistogram()->GetBinContent(1) - 100) > DBL_EPSILON){
+      std::cout << "Group1/Test1: Value mismatch: expected 100, found " << h1.GetHistogram()->GetBinContent(1) << std::endl;
+      success = false;
+    }
+    if(TMath::Abs(h2.GetHistogram()->GetBinContent(1,1) - 100) > DBL_EPSILON){
+      std::cout << "Group1/Test2: Value mismatch: expected 100, found " << h2.GetHistogram()->GetBinContent(1,1) << std::endl;
+      success = false;
+    }
+    if(TMath::Abs(h3.GetHistogram()->GetBinContent(1,1,1) - 100) > DBL_EPSILON){
+      std::cout << "Group2/Test3: Value mismatch: expected 100, found " << h3.GetHistogram()->GetBinContent(1,1,1) << std::endl;
+      success = false;
+    }
+    int index[4] = {1,1,1,1};
+    if(TMath::Abs(hN.GetHistogram()->GetBinContent(index) - 100) > DBL_EPSILON){
+      std::cout << "Group2/TestN: Value mismatch: expected 100, found " << hN.GetHistogram()->GetBinContent(index) << std::endl;
+      success = false;
+    }
+    if(TMath::Abs(hP.GetHistogram()->GetBinContent(1) - 1) > DBL_EPSILON){
+      std::cout << "Group3/Subgroup1/TestProfile: Value mismatch: expected 1, found " << hP.GetHistogram()->GetBinContent(1) << std::endl;
+      success = false;
+    }
+    return success ? 0 : 1;
+  }
+
   int TestRunAll(){
     int testresult(0);
     THistManagerTestSuite testsuite;
@@ -1025,6 +1187,10 @@ namespace TestTHistManager {
     testresult += testsuite.TestFillGroupedHistograms();
     std::cout << "Result after test: " << testresult << std::endl;
 
+    std::cout << "Running test: Fill Handles" << std::endl;
+    testresult += testsuite.TestFillHandleHistograms();
+    std::cout << "Result after test: " << testresult << std::endl;
+
     return testresult;
   }
 
@@ -1047,4 +1213,9 @@ namespace TestTHistManager {
     THistManagerTestSuite testsuite;
     return testsuite.TestFillGroupedHistograms();
   }
+
+  int TestRunFillHandles(){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillHandleHistograms();
+  }
 }
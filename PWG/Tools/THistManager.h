@@ -82,8 +82,8 @@ class TProfile;
  * with random values of an exponential distribution.
  *
  * ~~~{.cxx}
- * for(auto en : ROOT::TSeqI(0, 10000) {
- *   double pt = gRandom->Exp(-1);
+ * for(auto en : ROOT::TSeqI(0, 10000)) {
+ *   double pt = gRandom->Exp(1);
  *   mgr.FillTH1("hPt", pt);
  * }
  * ~~~
@@ -229,6 +229,64 @@ public:
     iterator();
   };
 
+  /**
+   * @class THMHandle
+   * @brief Pre-resolved handle to a histogram in the histogram manager
+   * @ingroup Histmanager
+   *
+   * Filling histograms via their name requires the lookup of the parent
+   * group(s) and of the histogram inside the group for each fill. A handle
+   * resolves the path once (e.g. in UserCreateOutputObjects) and can then be
+   * passed to the Fill functions instead of the name:
+   *
+   * ~~~{.cxx}
+   * THistManager::TH1Handle hPt = mgr.GetTH1Handle("tracks/hPt");
+   * for(auto en : ROOT::TSeqI(0, 10000)) {
+   *   mgr.FillTH1(hPt, gRandom->Exp(1));
+   * }
+   * ~~~
+   *
+   * The handle does not own the histogram and stays valid as long as the
+   * histogram belongs to the histogram manager.
+   */
+  template<typename T>
+  class THMHandle {
+  public:
+    /**
+     * @brief Default constructor, creating an invalid handle.
+     */
+    THMHandle(): fHist(nullptr) {}
+
+    /**
+     * @brief Destructor
+     */
+    ~THMHandle() {}
+
+    /**
+     * @brief Check whether the handle is connected to a histogram
+     * @return True if the histogram was found when creating the handle
+     */
+    Bool_t IsValid() const { return fHist != nullptr; }
+
+    /**
+     * @brief Access to the histogram connected to the handle
+     * @return Histogram (NULL if the handle is invalid)
+     */
+    T *GetHistogram() const { return fHist; }
+
+  private:
+    friend class THistManager;
+    explicit THMHandle(T *hist): fHist(hist) {}
+
+    T                           *fHist;               ///< Histogram connected to the handle (not owned)
+  };
+
+  typedef THMHandle<TH1> TH1Handle;                   ///< Handle to a 1D histogram
+  typedef THMHandle<TH2> TH2Handle;                   ///< Handle to a 2D histogram
+  typedef THMHandle<TH3> TH3Handle;                   ///< Handle to a 3D histogram
+  typedef THMHandle<THnSparse> THnSparseHandle;       ///< Handle to a THnSparse
+  typedef THMHandle<TProfile> TProfileHandle;         ///< Handle to a profile histogram
+
   /**
    * @brief Default constructor.
    *
@@ -621,6 +679,121 @@ public:
 	 */
   void FillProfile(const char *name, double x, double y, double weight = 1.);
 
+  /**
+   * @brief Resolve the path of a 1D histogram into a handle for filling.
+   *
+   * The histogram name also contains the parent group(s)
+   * according to the common group notation.
+   * @param[in] name Name of the histogram
+   * @return Handle to the histogram (invalid if not found or not a TH1)
+   */
+  TH1Handle GetTH1Handle(const char *name) const;
+
+  /**
+   * @brief Resolve the path of a 2D histogram into a handle for filling.
+   * @param[in] name Name of the histogram
+   * @return Handle to the histogram (invalid if not found or not a TH2)
+   */
+  TH2Handle GetTH2Handle(const char *name) const;
+
+  /**
+   * @brief Resolve the path of a 3D histogram into a handle for filling.
+   * @param[in] name Name of the histogram
+   * @return Handle to the histogram (invalid if not found or not a TH3)
+   */
+  TH3Handle GetTH3Handle(const char *name) const;
+
+  /**
+   * @brief Resolve the path of a THnSparse into a handle for filling.
+   * @param[in] name Name of the histogram
+   * @return Handle to the histogram (invalid if not found or not a THnSparse)
+   */
+  THnSparseHandle GetTHnSparseHandle(const char *name) const;
+
+  /**
+   * @brief Resolve the path of a profile histogram into a handle for filling.
+   * @param[in] name Name of the profile histogram
+   * @return Handle to the histogram (invalid if not found or not a TProfile)
+   */
+  TProfileHandle GetTProfileHandle(const char *name) const;
+
+  /**
+   * @brief Fill a 1D histogram via its handle.
+   *
+   * Same as FillTH1 with the histogram name, without the lookup.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH1(const TH1Handle &handle, double x, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 1D histogram via its handle, using a bin label.
+   * @param[in] handle Handle to the histogram
+   * @param[in] label Label of the bin to fill
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH1(const TH1Handle &handle, const char *label, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 2D histogram via its handle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH2(const TH2Handle &handle, double x, double y, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 2D histogram via its handle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] point coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH2(const TH2Handle &handle, double *point, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 3D histogram via its handle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH3(const TH3Handle &handle, double x, double y, double z, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 3D histogram via its handle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] point 3D-coordinate (x,y,z) of the point to be filled
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH3(const TH3Handle &handle, const double *point, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a nD histogram via its handle.
+   * @param[in] handle Handle to the histogram
+   * @param[in] x coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTHnSparse(const THnSparseHandle &handle, const double *x, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a profile histogram via its handle.
+   * @param[in] handle Handle to the profile histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillProfile(const TProfileHandle &handle, double x, double y, double weight = 1.);
+
   /**
    * @brief Create forward iterator starting at the beginning of the
    * container
@@ -706,6 +879,14 @@ private:
 	 */
 	TString histname(const TString &path) const;
 
+	/**
+	 * @brief Find a histogram of a given type for a handle.
+	 * @param[in] name Name of the histogram (common notation)
+	 * @return Histogram (NULL if not found or of a different type)
+	 */
+	template<typename T>
+	T *FindHistogramForHandle(const char *name) const;
+
 	THashList *fHistos;                   ///< List of histograms
 	bool fIsOwner;                        ///< Set the ownership
 
@@ -832,6 +1013,21 @@ public:
    * @return 0 if test is passed, 1 if it failed
    */
   int TestFillGroupedHistograms();
+
+  /**
+   * Purpose of the test: Check whether histograms are filled correctly via pre-resolved handles
+   * Relies on: TestFillSimpleHistograms, TestFillGroupedHistograms
+   *
+   * Creating histograms of all types in groups, with 1 bin per dimension, resolving handles
+   * for them and filling each 100 times the same value via the handle. In addition a handle
+   * is requested for a non-existing histogram and for a histogram of a different type.
+   *
+   * Test passed:
+   * - All handles for existing histograms are valid and the handles with wrong name or type are invalid
+   * - All Histograms have the expected value (100 for histograms, 1 for profile)
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillHandleHistograms();
 };
 
 /**
@@ -869,5 +1065,12 @@ int TestRunFillSimple();
  */
 int TestRunFillGrouped();
 
+/**
+ * Run the test for filling histograms via handles. See @ref THistManagerTestSuite
+ * for details.
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillHandles();
+
 }
 #endif
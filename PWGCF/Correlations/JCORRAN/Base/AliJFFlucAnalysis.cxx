@@ -405,9 +405,14 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 				QnB_star[ih] = TComplex(0,0);			
 		}
 		//--------------- Calculate Qn--------------------
+		// all harmonics of both subevents (and of the pt bins for SC pt dep) in one loop over the tracks
+		Double_t ptbin_borders[N_ptbins+1] = {0.2, 0.4, 0.6, 0.8, 1.0, 1.25, 1.5, 2.0, 5.0};
+		TComplex QnSub[kNSub][kNH];
+		TComplex QnSub_pt[kNSub][kNH][N_ptbins];
+		CalculateQnSPAll( Eta_config, IsSCptdep == kTRUE ? ptbin_borders : 0, QnSub, QnSub_pt );
 		for(int ih=0; ih<kNH; ih++){
-				QnA[ih] = CalculateQnSP( Eta_config[kSubA][kMin], Eta_config[kSubA][kMax], ih);
-				QnB[ih] = CalculateQnSP( Eta_config[kSubB][kMin], Eta_config[kSubB][kMax], ih);
+				QnA[ih] = QnSub[kSubA][ih];
+				QnB[ih] = QnSub[kSubB][ih];
 //				fh_Qvector[fCBin][0][ih]->Fill( QnA[ih].Theta() );
 //				fh_Qvector[fCBin][1][ih]->Fill( QnB[ih].Theta() );	
 				QnB_star[ih] = TComplex::Conjugate ( QnB[ih] ) ;
@@ -540,32 +545,14 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 
 		if(IsSCptdep == kTRUE){
 				const int SCNH =6; // 0, 1, 2(v2), 3(v3), 4(v4), 5(v5)
-				Double_t ptbin_borders[N_ptbins+1] = {0.2, 0.4, 0.6, 0.8, 1.0, 1.25, 1.5, 2.0, 5.0};
-				//init
-				TComplex QnA_pt[SCNH][N_ptbins];
-				TComplex QnB_pt[SCNH][N_ptbins];
-				TComplex QnB_pt_star[SCNH][N_ptbins];
-				for(int ih=2; ih<SCNH; ih++){
-						for(int ipt=0; ipt<N_ptbins; ipt++){
-								QnA_pt[ih][ipt] = TComplex(0,0);
-								QnB_pt[ih][ipt] = TComplex(0,0);
-								QnB_pt_star[ih][ipt] = TComplex(0,0);
-						}
-				}	
-
-				// calculate Qn for each pt bins	
-				for(int ih=2; ih<SCNH; ih++){
+				// Qn for each pt bins (all harmonics, up to 8 for the correction terms)
+				TComplex QnA_pt[kNH][N_ptbins];
+				TComplex QnB_pt[kNH][N_ptbins];
+				TComplex QnB_pt_star[kNH][N_ptbins];
+				for(int ih=0; ih<kNH; ih++){
 						for(int ipt=0; ipt<N_ptbins; ipt++){
-								Double_t pt_bin_min = ptbin_borders[ipt];
-								Double_t pt_bin_max = ptbin_borders[ipt+1]; 
-								Double_t QAReal=Get_Qn_Real_pt( Eta_config[kSubA][0], Eta_config[kSubA][1], ih, ipt, pt_bin_min, pt_bin_max);
-								Double_t QAImag=Get_Qn_Img_pt(  Eta_config[kSubA][0], Eta_config[kSubA][1], ih, ipt, pt_bin_min, pt_bin_max);
-
-								Double_t QBReal=Get_Qn_Real_pt( Eta_config[kSubB][0], Eta_config[kSubB][1], ih, ipt, pt_bin_min, pt_bin_max);
-								Double_t QBImag=Get_Qn_Img_pt(  Eta_config[kSubB][0], Eta_config[kSubB][1], ih, ipt, pt_bin_min, pt_bin_max);
-
-								QnA_pt[ih][ipt]= TComplex(QAReal, QAImag);
-								QnB_pt[ih][ipt]= TComplex(QBReal, QBImag);
+								QnA_pt[ih][ipt] = QnSub_pt[kSubA][ih][ipt];
+								QnB_pt[ih][ipt] = QnSub_pt[kSubB][ih][ipt];
 								QnB_pt_star[ih][ipt] = TComplex::Conjugate( QnB_pt[ih][ipt] ) ; 
 						}
 				}		
@@ -756,6 +743,100 @@ TComplex AliJFFlucAnalysis::CalculateQnSP( Double_t eta1, Double_t eta2, int har
 		if( ih !=0) Qn /= Sub_Ntrk; // Use Qn[0] as total number of tracks(*eff)
 		return Qn;
 }
+//________________________________________________________________________
+void AliJFFlucAnalysis::CalculateQnSPAll( const Double_t eta_config[2][2], const Double_t *ptbin_borders, TComplex QnSub[2][kNH], TComplex QnSub_pt[2][kNH][N_ptbins] )
+{
+		// Q-vectors of CalculateQnSP for all harmonics of the subevents eta_config[isub][min,max] and,
+		// if ptbin_borders is given, the ones of Get_Qn_Real_pt / Get_Qn_Img_pt for all pt bins, in a single track loop.
+		// The weight of each track is evaluated once, exp(i*n*phi) is obtained recursively from exp(i*phi).
+		Double_t Qn_real[2][kNH], Qn_img[2][kNH];
+		Double_t Qn_real_pt[2][kNH][N_ptbins], Qn_img_pt[2][kNH][N_ptbins];
+		Double_t Sub_Ntrk_pt[2][N_ptbins];
+		for(int isub=0; isub<2; isub++){
+				for(int ih=0; ih<kNH; ih++){
+						Qn_real[isub][ih] = 0;
+						Qn_img[isub][ih] = 0;
+						for(int ipt=0; ipt<N_ptbins; ipt++){
+								Qn_real_pt[isub][ih][ipt] = 0;
+								Qn_img_pt[isub][ih][ipt] = 0;
+						}
+				}
+				for(int ipt=0; ipt<N_ptbins; ipt++) Sub_Ntrk_pt[isub][ipt] = 0;
+		}
+		Double_t cos_nphi[kNH], sin_nphi[kNH];
+		cos_nphi[0] = 1;
+		sin_nphi[0] = 0;
+
+		Long64_t ntracks = fInputList->GetEntriesFast();
+		for(Long64_t it=0; it< ntracks; it++){
+				AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
+				Double_t pt = itrack->Pt();
+				Double_t eta = itrack->Eta();
+				// eta range inclusive for the integrated Qn, exclusive for the pt bins (as in the single functions)
+				Bool_t inSub[2], inSub_pt[2];
+				int ipt = -1;
+				if( ptbin_borders ){
+						for(int ib=0; ib<N_ptbins; ib++){
+								if( pt > ptbin_borders[ib] && pt < ptbin_borders[ib+1] ){ ipt = ib; break; }
+						}
+				}
+				Bool_t used = kFALSE;
+				for(int isub=0; isub<2; isub++){
+						inSub[isub] = !( eta < eta_config[isub][0] || eta > eta_config[isub][1] );
+						inSub_pt[isub] = ipt >= 0 && eta > eta_config[isub][0] && eta < eta_config[isub][1];
+						if( inSub[isub] || inSub_pt[isub] ) used = kTRUE;
+				}
+				if( !used ) continue;
+
+				Double_t phi = itrack->Phi();
+				Double_t phi_module_corr = 1;
+				int isub = -1;
+				if( eta < 0 ) isub = 0;
+				if( eta > 0 ) isub = 1;
+				if( IsPhiModule == kTRUE){ phi_module_corr = h_phi_module[fCBin][isub]->GetBinContent( (h_phi_module[fCBin][isub]->GetXaxis()->FindBin( phi ) )  );}
+				Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent );
+				Double_t weight = 1./effCorr * phi_module_corr;
+
+				cos_nphi[1] = TMath::Cos(phi);
+				sin_nphi[1] = TMath::Sin(phi);
+				for(int ih=2; ih<kNH; ih++){
+						cos_nphi[ih] = cos_nphi[ih-1]*cos_nphi[1] - sin_nphi[ih-1]*sin_nphi[1];
+						sin_nphi[ih] = sin_nphi[ih-1]*cos_nphi[1] + cos_nphi[ih-1]*sin_nphi[1];
+				}
+				for(int is=0; is<2; is++){
+						if( inSub[is] ){
+								for(int ih=0; ih<kNH; ih++){
+										Qn_real[is][ih] += weight * cos_nphi[ih];
+										Qn_img[is][ih] += weight * sin_nphi[ih];
+								}
+						}
+						if( inSub_pt[is] ){
+								for(int ih=0; ih<kNH; ih++){
+										Qn_real_pt[is][ih][ipt] += weight * cos_nphi[ih];
+										Qn_img_pt[is][ih][ipt] += weight * sin_nphi[ih];
+								}
+								Sub_Ntrk_pt[is][ipt] += weight;
+						}
+				}
+		}
+
+		for(int is=0; is<2; is++){
+				Double_t Sub_Ntrk = Qn_real[is][0]; // number of Tracks * effCorr * phi modulation factor
+				for(int ih=0; ih<kNH; ih++){
+						QnSub[is][ih] = TComplex( Qn_real[is][ih], Qn_img[is][ih] );
+						if( ih !=0) QnSub[is][ih] /= Sub_Ntrk; // Use Qn[0] as total number of tracks(*eff)
+				}
+				if( !ptbin_borders ) continue;
+				int iside = 0; // eta - 
+				if( eta_config[is][0] > 0 ) iside = 1; // eta +
+				for(int ipt=0; ipt<N_ptbins; ipt++){
+						for(int ih=0; ih<kNH; ih++){
+								QnSub_pt[is][ih][ipt] = TComplex( Qn_real_pt[is][ih][ipt] / Sub_Ntrk_pt[is][ipt], Qn_img_pt[is][ih][ipt] / Sub_Ntrk_pt[is][ipt] );
+						}
+						NSubTracks_pt[iside][ipt] = Sub_Ntrk_pt[is][ipt];
+				}
+		}
+}
 ///________________________________________________________________________
 Double_t AliJFFlucAnalysis::Get_QC_Vn(Double_t QnA_real, Double_t QnA_img, Double_t QnB_real, Double_t QnB_img )
 {
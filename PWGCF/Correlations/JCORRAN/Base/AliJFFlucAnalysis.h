@@ -149,6 +149,7 @@ class AliJFFlucAnalysis : public AliAnalysisTaskSE {
 		// addtinal variables for ptbins(Standard Candles only)
 		enum{kPt0, kPt1, kPt2, kPt3, kPt4, kPt5, kPt6, kPt7, N_ptbins};
 		double NSubTracks_pt[2][N_ptbins];
+		void CalculateQnSPAll( const double eta_config[2][2], const double *ptbin_borders, TComplex QnSub[2][kNH], TComplex QnSub_pt[2][kNH][N_ptbins] );
 		AliJBin fBin_Nptbins;//!
 		AliJTH1D fh_SC_ptdep_4corr;//! // for < vn^2 vm^2 >
 		AliJTH1D fh_SC_ptdep_2corr;//!  // for < vn^2 >
@@ -114,7 +114,10 @@ AliFemtoModelWeightGeneratorLednicky::AliFemtoModelWeightGeneratorLednicky() :
   fSphereApp(false),fT0App(false) ,
   fLL(0), fNuclChargeSign(1), fSwap(0), fLLMax(30), fLLName(0), 
   fNumProcessPair(0), fNumbNonId(0),
-  fKpKmModel(14),fPhi_OffOn(1)
+  fKpKmModel(14),fPhi_OffOn(1),
+  fTabulate(false), fTabNKStar(100), fTabKStarMax(0.2), fTabNRStar(100), fTabRStarMax(20.),
+  fTabNCosTheta(40), fTabCheckEvery(0), fTables(),
+  fTabNPairs(0), fTabNChecks(0), fTabMaxDev(0), fTabSumDev2(0)
 {
   // default constructor
   fLLName=new char*[fLLMax+1];
@@ -163,7 +166,10 @@ AliFemtoModelWeightGeneratorLednicky::AliFemtoModelWeightGeneratorLednicky(const
   fSphereApp(false),fT0App(false) ,
   fLL(0), fNuclChargeSign(1), fSwap(0), fLLMax(30), fLLName(0), 
   fNumProcessPair(0), fNumbNonId(0),
-  fKpKmModel(14),fPhi_OffOn(1)
+  fKpKmModel(14),fPhi_OffOn(1),
+  fTabulate(false), fTabNKStar(100), fTabKStarMax(0.2), fTabNRStar(100), fTabRStarMax(20.),
+  fTabNCosTheta(40), fTabCheckEvery(0), fTables(),
+  fTabNPairs(0), fTabNChecks(0), fTabMaxDev(0), fTabSumDev2(0)
 {
   // copy constructor
   fWei = aWeight.fWei; 
@@ -190,6 +196,13 @@ AliFemtoModelWeightGeneratorLednicky::AliFemtoModelWeightGeneratorLednicky(const
   fNumProcessPair=new int[fLLMax+1];
   fKpKmModel = aWeight.fKpKmModel;
   fPhi_OffOn = aWeight.fPhi_OffOn;
+  fTabulate = aWeight.fTabulate;
+  fTabNKStar = aWeight.fTabNKStar;
+  fTabKStarMax = aWeight.fTabKStarMax;
+  fTabNRStar = aWeight.fTabNRStar;
+  fTabRStarMax = aWeight.fTabRStarMax;
+  fTabNCosTheta = aWeight.fTabNCosTheta;
+  fTabCheckEvery = aWeight.fTabCheckEvery;
   int i;
   for (i=1;i<=fLLMax;i++) {fLLName[i]=new char[40];fNumProcessPair[i]=0;}
   strncpy( fLLName[1],"neutron neutron",40);
@@ -258,6 +271,13 @@ AliFemtoModelWeightGeneratorLednicky& AliFemtoModelWeightGeneratorLednicky::oper
   fNumProcessPair=new int[fLLMax+1];
   fKpKmModel = aWeight.fKpKmModel;
   fPhi_OffOn = aWeight.fPhi_OffOn;
+  fTabulate = aWeight.fTabulate;
+  fTabNKStar = aWeight.fTabNKStar;
+  fTabKStarMax = aWeight.fTabKStarMax;
+  fTabNRStar = aWeight.fTabNRStar;
+  fTabRStarMax = aWeight.fTabRStarMax;
+  fTabNCosTheta = aWeight.fTabNCosTheta;
+  fTabCheckEvery = aWeight.fTabCheckEvery;
   int i;
   for (i=1;i<=fLLMax;i++) {fLLName[i]=new char[40];fNumProcessPair[i]=0;}
   strncpy( fLLName[1],"neutron neutron",40);
@@ -412,6 +432,10 @@ Double_t tDTime =inf1->GetEmissionPoint()->t()  - inf2->GetEmissionPoint()->t();
   } 
   else { // Good Pid
 //    cout<<" good PID weight generator pdg1 "<<((AliFemtoModelHiddenInfo*)inf1->GetHiddenInfo())->GetPDGPid()<<" pdg2 "<<((AliFemtoModelHiddenInfo*)inf1->GetHiddenInfo())->GetPDGPid()<<endl;
+    // tables are built (with fsiw) before the momenta and positions of this pair are set
+    const std::vector<double> *tTable = 0;
+    if (fTabulate && (fI3c==0) && (fKStar<fTabKStarMax) && (fRStar<fTabRStarMax)) tTable = &GetTable();
+
     AliFemtoThreeVector*  p;
     p=((AliFemtoModelHiddenInfo*)inf1->GetHiddenInfo())->GetTrueMomentum();
     double p1[]={p->x(),p->y(),p->z()};
@@ -449,6 +473,21 @@ Double_t tDTime =inf1->GetEmissionPoint()->t()  - inf2->GetEmissionPoint()->t();
     } else {
       fsiposition(*x1,*x2);
     }
+    if (tTable && (fKStar>0) && (fRStar>0)) {
+      double tCosTheta = (fKStarOut*fRStarOut + fKStarSide*fRStarSide + fKStarLong*fRStarLong)/(fKStar*fRStar);
+      double tWeight = InterpolateTable(*tTable, fKStar, fRStar, tCosTheta);
+      fTabNPairs++;
+      if ((fTabCheckEvery>0) && (fTabNPairs%fTabCheckEvery==0)) {
+        FsiSetLL();
+        ltran12();
+        fsiw(1,fWeif,fWei,fWein);
+        double tDev = fabs(tWeight-fWein);
+        fTabNChecks++;
+        fTabSumDev2 += tDev*tDev;
+        if (tDev>fTabMaxDev) fTabMaxDev = tDev;
+      }
+      return tWeight;
+    }
     FsiSetLL();
     ltran12();
     fsiw(1,fWeif,fWei,fWein);
@@ -483,12 +522,22 @@ AliFemtoString AliFemtoModelWeightGeneratorLednicky::Report() {
   }
   if (fNumbNonId)
     tStr << "         "<< fNumbNonId << " Non Identified" << endl;
+  if (fTabulate) {
+    tStr << "    Tabulated weights : k* < " << fTabKStarMax << " (" << fTabNKStar << " bins)"
+         << " - r* < " << fTabRStarMax << " (" << fTabNRStar << " bins)"
+         << " - cos(theta*) (" << fTabNCosTheta << " bins)" << endl;
+    tStr << "         " << fTabNPairs << " Pairs with tabulated weight" << endl;
+    if (fTabNChecks)
+      tStr << "         " << fTabNChecks << " Compared with fsiw : max |dw| = " << fTabMaxDev
+           << " - rms dw = " << sqrt(fTabSumDev2/fTabNChecks) << endl;
+  }
   AliFemtoString returnThis = tStr.str();
   return returnThis;
 }
 
 void AliFemtoModelWeightGeneratorLednicky::FsiInit(){
   // Initialize weight generation module
+  ClearTables();
    cout << "*******************AliFemtoModelWeightGeneratorLednicky check FsiInit ************" << endl;
    cout <<"mItest dans FsiInit() = " << fItest << endl;
    cout <<"mIch dans FsiInit() = " << fIch << endl;
@@ -502,6 +551,7 @@ void AliFemtoModelWeightGeneratorLednicky::FsiSetKpKmModelType(){
   // initialize K+K- model type
   cout<<"******************* AliFemtoModelWeightGeneratorLednicky check FsiInit initialize K+K- model type with FsiSetKpKmModelType(), type= "<<fKpKmModel<<" PhiOffON= "<<fPhi_OffOn<<" *************"<< endl;
    setkpkmmodel(fKpKmModel,fPhi_OffOn);
+   ClearTables();
    cout<<"-----------------END FsiSetKpKmModelType-------"<<endl;
 }
 
@@ -715,13 +765,13 @@ void     AliFemtoModelWeightGeneratorLednicky::SetPairTypeFromPair(AliFemtoPair
 //K+K- model type
 void AliFemtoModelWeightGeneratorLednicky::SetKpKmModelType(const int aModelType, const int aPhi_OffOn) {fKpKmModel=aModelType; fPhi_OffOn=aPhi_OffOn; FsiSetKpKmModelType();}
 
-void AliFemtoModelWeightGeneratorLednicky::SetNuclCharge(const double aNuclCharge) {fNuclCharge=aNuclCharge;FsiNucl();}
-void AliFemtoModelWeightGeneratorLednicky::SetNuclMass(const double aNuclMass){fNuclMass=aNuclMass;FsiNucl();}
+void AliFemtoModelWeightGeneratorLednicky::SetNuclCharge(const double aNuclCharge) {fNuclCharge=aNuclCharge;FsiNucl();ClearTables();}
+void AliFemtoModelWeightGeneratorLednicky::SetNuclMass(const double aNuclMass){fNuclMass=aNuclMass;FsiNucl();ClearTables();}
 
-void AliFemtoModelWeightGeneratorLednicky::SetSphere(){fSphereApp=true;}
-void AliFemtoModelWeightGeneratorLednicky::SetSquare(){fSphereApp=false;}
-void AliFemtoModelWeightGeneratorLednicky::SetT0ApproxOn(){ fT0App=true;}
-void AliFemtoModelWeightGeneratorLednicky::SetT0ApproxOff(){ fT0App=false;}
+void AliFemtoModelWeightGeneratorLednicky::SetSphere(){fSphereApp=true;ClearTables();}
+void AliFemtoModelWeightGeneratorLednicky::SetSquare(){fSphereApp=false;ClearTables();}
+void AliFemtoModelWeightGeneratorLednicky::SetT0ApproxOn(){ fT0App=true;ClearTables();}
+void AliFemtoModelWeightGeneratorLednicky::SetT0ApproxOff(){ fT0App=false;ClearTables();}
 void AliFemtoModelWeightGeneratorLednicky::SetDefaultCalcPar(){
   fItest=1;fIqs=1;fIsi=1;fI3c=0;fIch=1;FsiInit();
   fSphereApp=false;fT0App=false;}
@@ -735,6 +785,101 @@ void AliFemtoModelWeightGeneratorLednicky::SetStrongOff() {fItest=1;fIsi=0;FsiIn
 void AliFemtoModelWeightGeneratorLednicky::Set3BodyOn()   {fItest=1;fI3c=1;FsiInit();FsiNucl();}
 void AliFemtoModelWeightGeneratorLednicky::Set3BodyOff()  {fItest=1;fI3c=0;FsiInit();fWeightDen=1.;FsiNucl();}
 
+//_____________________________________________
+void AliFemtoModelWeightGeneratorLednicky::SetTabulatedWeights(const bool aTabulate, const int aNKStar, const double aKStarMax,
+                                                               const int aNRStar, const double aRStarMax, const int aNCosTheta)
+{
+  // switch the tabulated weights on/off and set the binning of the tables
+  fTabulate = aTabulate;
+  fTabNKStar = (aNKStar>0) ? aNKStar : 1;
+  fTabKStarMax = aKStarMax;
+  fTabNRStar = (aNRStar>0) ? aNRStar : 1;
+  fTabRStarMax = aRStarMax;
+  fTabNCosTheta = (aNCosTheta>0) ? aNCosTheta : 1;
+  ClearTables();
+}
+
+//_____________________________________________
+void AliFemtoModelWeightGeneratorLednicky::ClearTables()
+{
+  // remove the tables, they are rebuilt when needed with the current settings
+  fTables.clear();
+  fTabNPairs = 0;
+  fTabNChecks = 0;
+  fTabMaxDev = 0;
+  fTabSumDev2 = 0;
+}
+
+//_____________________________________________
+const std::vector<double>& AliFemtoModelWeightGeneratorLednicky::GetTable()
+{
+  // table of the weights of the current pair type, built at its first use.
+  // The weights are calculated with fsiw at the bin centers of (k*, r*, cos theta*)
+  // in the pair rest frame, for emission at the same time (t* = 0)
+  std::map<int, std::vector<double> >::iterator tIt = fTables.find(fLL);
+  if (tIt != fTables.end()) return tIt->second;
+
+  std::vector<double> &tTable = fTables[fLL];
+  tTable.resize(fTabNKStar*fTabNRStar*fTabNCosTheta);
+
+  const double tDK = fTabKStarMax/fTabNKStar;
+  const double tDR = fTabRStarMax/fTabNRStar;
+  const double tDC = 2./fTabNCosTheta;
+
+  cout << "AliFemtoModelWeightGeneratorLednicky: building the weight table of " << fLLName[fLL] << endl;
+  FsiSetLL();
+  for (int ik=0; ik<fTabNKStar; ik++) {
+    double tK = (ik+0.5)*tDK;
+    double p1[]={0.,0.,tK};
+    double p2[]={0.,0.,-tK};
+    for (int ir=0; ir<fTabNRStar; ir++) {
+      double tR = (ir+0.5)*tDR;
+      for (int ic=0; ic<fTabNCosTheta; ic++) {
+        double tCos = -1.+(ic+0.5)*tDC;
+        double tSin = sqrt(1.-tCos*tCos);
+        double x1[]={tR*tSin,0.,tR*tCos,0.};
+        double x2[]={0.,0.,0.,0.};
+        fsimomentum(*p1,*p2);
+        fsiposition(*x1,*x2);
+        ltran12();
+        fsiw(1,fWeif,fWei,fWein);
+        tTable[(ik*fTabNRStar+ir)*fTabNCosTheta+ic] = fWein;
+      }
+    }
+  }
+
+  return tTable;
+}
+
+//_____________________________________________
+double AliFemtoModelWeightGeneratorLednicky::InterpolateTable(const std::vector<double>& aTable, double aKStar, double aRStar, double aCosTheta) const
+{
+  // trilinear interpolation between the bin centers of the table
+  // (constant extrapolation up to the edges)
+  double tX[3]={aKStar*fTabNKStar/fTabKStarMax-0.5, aRStar*fTabNRStar/fTabRStarMax-0.5, (aCosTheta+1.)*fTabNCosTheta/2.-0.5};
+  const int tN[3]={fTabNKStar, fTabNRStar, fTabNCosTheta};
+  int tI[3];
+  double tF[3];
+  for (int i=0; i<3; i++) {
+    if (tX[i]<0.) tX[i]=0.;
+    if (tX[i]>tN[i]-1) tX[i]=tN[i]-1;
+    tI[i] = (int) tX[i];
+    if (tI[i]>tN[i]-2) tI[i] = (tN[i]>1) ? tN[i]-2 : 0;
+    tF[i] = (tN[i]>1) ? tX[i]-tI[i] : 0.;
+  }
+
+  double tWeight = 0.;
+  for (int j=0; j<8; j++) {
+    int ik = tI[0] + (j&1);
+    int ir = tI[1] + ((j>>1)&1);
+    int ic = tI[2] + ((j>>2)&1);
+    double tW = ((j&1) ? tF[0] : 1.-tF[0]) * (((j>>1)&1) ? tF[1] : 1.-tF[1]) * (((j>>2)&1) ? tF[2] : 1.-tF[2]);
+    if (tW==0.) continue;
+    tWeight += tW*aTable[(ik*fTabNRStar+ir)*fTabNCosTheta+ic];
+  }
+  return tWeight;
+}
+
 Double_t AliFemtoModelWeightGeneratorLednicky::GetKStar() const {return AliFemtoModelWeightGenerator::GetKStar();}
 Double_t AliFemtoModelWeightGeneratorLednicky::GetKStarOut() const { return AliFemtoModelWeightGenerator::GetKStarOut(); }
 Double_t AliFemtoModelWeightGeneratorLednicky::GetKStarSide() const { return AliFemtoModelWeightGenerator::GetKStarSide(); }
@@ -11,6 +11,9 @@
 #ifndef ALIFEMTOMODELWEIGHTGENERATORLEDNICKY_H
 #define ALIFEMTOMODELWEIGHTGENERATORLEDNICKY_H
 
+#include <map>
+#include <vector>
+
 #include "AliFemtoTypes.h"
 #include "AliFemtoModelWeightGenerator.h"
 
@@ -66,6 +69,14 @@ class AliFemtoModelWeightGeneratorLednicky : public  AliFemtoModelWeightGenerato
 
   void SetKpKmModelType(const int aModelType, const int aPhi_OffOn);  // K+K- model type,Phi off/on
 
+// Tabulated weights: interpolate the weight in (k*, r*, cos theta*) from a table
+// built with fsiw for each pair type, instead of calling fsiw for every pair.
+// Pairs outside the table range and 3-body calculations use fsiw.
+  void SetTabulatedWeights(const bool aTabulate=true, const int aNKStar=100, const double aKStarMax=0.2,
+                           const int aNRStar=100, const double aRStarMax=20., const int aNCosTheta=40);
+  void SetTabulationCheck(const int aCheckEvery) {fTabCheckEvery=aCheckEvery;} // compare 1 pair out of aCheckEvery with fsiw (0: never)
+  void ClearTables();
+
   virtual AliFemtoString Report();
 
 protected:
@@ -102,15 +113,31 @@ protected:
   int       fKpKmModel;      //ij (i=1..4, j=1..4; see AliFemtoFsiWeightLednicky.F)
   int       fPhi_OffOn;      //0->Phi Off,1->Phi On
 
+  // Tabulated weights
+  bool      fTabulate;       // interpolate the weights from the tables
+  int       fTabNKStar;      // number of k* bins of the tables
+  double    fTabKStarMax;    // maximum k* of the tables (GeV/c)
+  int       fTabNRStar;      // number of r* bins of the tables
+  double    fTabRStarMax;    // maximum r* of the tables (fm)
+  int       fTabNCosTheta;   // number of cos(theta*) bins of the tables
+  int       fTabCheckEvery;  // compare one tabulated pair out of fTabCheckEvery with fsiw
+  std::map<int, std::vector<double> > fTables; //! weight tables per pair type (fLL)
+  long long fTabNPairs;      //! number of pairs with tabulated weight
+  long long fTabNChecks;     //! number of tabulated pairs compared with fsiw
+  double    fTabMaxDev;      //! maximum absolute deviation from fsiw
+  double    fTabSumDev2;     //! sum of the squared deviations from fsiw
+
   // Interface to the fortran functions
   void FsiSetKpKmModelType();  //// initialize K+K- model type
   void FsiInit();
   void FsiSetLL();
   void FsiNucl();
   bool SetPid(const int aPid1,const int aPid2);
+  const std::vector<double>& GetTable();
+  double InterpolateTable(const std::vector<double>& aTable, double aKStar, double aRStar, double aCosTheta) const;
 
 #ifdef __ROOT__
-  ClassDef(AliFemtoModelWeightGeneratorLednicky,1)
+  ClassDef(AliFemtoModelWeightGeneratorLednicky,2)
 #endif
 };
 
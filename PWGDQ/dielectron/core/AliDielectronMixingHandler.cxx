@@ -36,6 +36,10 @@ Detailed description
 #include "AliDielectronHelper.h"
 #include "AliDielectronHistos.h"
 #include "AliDielectronEvent.h"
+#include "AliDielectronPair.h"
+#include "AliDielectronMC.h"
+#include "AliDielectronCF.h"
+#include "AliDielectronHF.h"
 
 #include "AliDielectronMixingHandler.h"
 
@@ -50,6 +54,7 @@ AliDielectronMixingHandler::AliDielectronMixingHandler() :
   fMixIncomplete(kTRUE),
   fMoveToSameVertex(kFALSE),
   fSkipFirstEvt(kFALSE),
+  fFastMixing(kFALSE),
   fPID(0x0)
 {
   //
@@ -71,6 +76,7 @@ AliDielectronMixingHandler::AliDielectronMixingHandler(const char* name, const c
   fMixIncomplete(kTRUE),
   fMoveToSameVertex(kFALSE),
   fSkipFirstEvt(kFALSE),
+  fFastMixing(kFALSE),
   fPID(0x0)
 {
   //
@@ -175,7 +181,8 @@ void AliDielectronMixingHandler::Fill(const AliVEvent *ev, AliDielectron *diele)
   // do mixing
   if (poolp) {
     TClonesArray &pool=*poolp;
-    DoMixing(pool,diele);
+    if (fFastMixing && IsFastMixingPossible(diele)) DoFastMixing(pool,diele);
+    else DoMixing(pool,diele);
   }
 
   Int_t index1=0;
@@ -297,28 +304,7 @@ void AliDielectronMixingHandler::DoMixing(TClonesArray &pool, AliDielectron *die
     //move tracks to the same vertex (vertex of the first event), if requested
     //
     if (fMoveToSameVertex){
-      const Double_t *varsFirst=values;
-      const Double_t *varsMix=ev2->GetEventData();
-
-      const Double_t vFirst[3]={varsFirst[AliDielectronVarManager::kXvPrim],
-                                varsFirst[AliDielectronVarManager::kYvPrim],
-                                varsFirst[AliDielectronVarManager::kZvPrim]};
-
-      const Double_t vMix[3]  ={varsMix[AliDielectronVarManager::kXvPrim],
-                                varsMix[AliDielectronVarManager::kYvPrim],
-                                varsMix[AliDielectronVarManager::kZvPrim]};
-
-      //loop over all tracks from the second event and move them to the vertex of the first
-      AliVTrack *vtrack=0x0;
-      while ( ( vtrack=(AliVTrack*)ev2P() ) ){
-        MoveToSameVertex(vtrack, vFirst, vMix);
-      }
-
-      while ( ( vtrack=(AliVTrack*)ev2N() ) ){
-        MoveToSameVertex(vtrack, vFirst, vMix);
-      }
-
-
+      MoveEventToSameVertex(ev2, values);
       ev2P.Reset();
       ev2N.Reset();
     }
@@ -357,6 +343,218 @@ void AliDielectronMixingHandler::DoMixing(TClonesArray &pool, AliDielectron *die
   AliDielectronVarManager::SetEventData(values);
 }
 
+//______________________________________________
+Bool_t AliDielectronMixingHandler::IsFastMixingPossible(const AliDielectron *diele) const
+{
+  //
+  // the fast mixing does not apply the pair pre filters of AliDielectron::FillPairArrays
+  //
+  if ((!diele->fPreFilterAllSigns1) && (!diele->fPreFilterUnlikeOnly1) && (!diele->fPreFilterLikeOnly1) &&
+      ( diele->fPairPreFilter1.GetCuts()->GetEntries()>0 )) return kFALSE;
+  if ((!diele->fPreFilterAllSigns2) && (!diele->fPreFilterUnlikeOnly2) && (!diele->fPreFilterLikeOnly2) &&
+      ( diele->fPairPreFilter2.GetCuts()->GetEntries()>0 )) return kFALSE;
+  return kTRUE;
+}
+
+//______________________________________________
+void AliDielectronMixingHandler::DoFastMixing(TClonesArray &pool, AliDielectron *diele)
+{
+  //
+  // perform the mixing without the pair arrays:
+  // the KF particles of the legs are built once per track and the selected
+  // pairs are filled directly into the pair and leg histogram classes.
+  // The mixed pairs are selected and histogrammed as in DoMixing,
+  // but they are not available in the pair arrays afterwards
+  //
+
+  // we need at least one event for mixing
+  if (pool.GetEntriesFast()<1) return;
+
+  // the variables of the histograms, the fill map might still be the one of the debug tree
+  AliDielectronVarManager::SetFillMap(diele->fUsedVars);
+
+  // the pairs are histogrammed with the candidate variables of the current event,
+  // as they would be in AliDielectron::FillHistograms after the mixing
+  Double_t ntracks = diele->fTracks[0].GetEntriesFast() + diele->fTracks[1].GetEntriesFast();
+  Double_t npairs  = diele->PairArray(AliDielectron::kEv1PM)->GetEntriesFast();
+  AliDielectronVarManager::SetValue(AliDielectronVarManager::kTracks, ntracks);
+  AliDielectronVarManager::SetValue(AliDielectronVarManager::kPairs,  npairs);
+
+  //buffer global event data
+  Double_t values[AliDielectronVarManager::kNMaxValues]={0};
+  for (Int_t i=AliDielectronVarManager::kPairMax; i<AliDielectronVarManager::kNMaxValues; ++i)
+    values[i]=AliDielectronVarManager::GetValue((AliDielectronVarManager::ValueTypes)i);
+
+  //legs of the current event
+  FillLegBuffer(0, diele->fTracks[0], diele->fPdgLeg1);
+  FillLegBuffer(1, diele->fTracks[1], diele->fPdgLeg1);
+
+  AliDielectronPair candidate;
+  candidate.SetKFUsage(diele->fUseKF);
+
+  //legs already filled, per pair type
+  std::set<const TObject*> legsFilled[10];
+
+  for (Int_t i1=0; i1<pool.GetEntriesFast(); ++i1){
+    const AliDielectronEvent *ev2=static_cast<AliDielectronEvent*>(pool.At(i1));
+    if (!ev2) continue;
+
+    //move tracks to the same vertex (vertex of the first event), if requested
+    if (fMoveToSameVertex) MoveEventToSameVertex(ev2, values);
+
+    FillLegBuffer(2, *ev2->GetTrackArrayP(), diele->fPdgLeg2);
+    FillLegBuffer(3, *ev2->GetTrackArrayN(), diele->fPdgLeg2);
+
+    //mixing of ev1- ev2+. This is common for all mixing types
+    FillMixedPairs(diele, candidate, 1, 2, AliDielectron::kEv1MEv2P, legsFilled[AliDielectron::kEv1MEv2P]);
+
+    if (fMixType==kAll || fMixType==kOSandLS){
+      FillMixedPairs(diele, candidate, 0, 2, AliDielectron::kEv1PEv2P, legsFilled[AliDielectron::kEv1PEv2P]);
+      FillMixedPairs(diele, candidate, 1, 3, AliDielectron::kEv1MEv2M, legsFilled[AliDielectron::kEv1MEv2M]);
+      if (fMixType==kAll) FillMixedPairs(diele, candidate, 0, 3, AliDielectron::kEv1PEv2M, legsFilled[AliDielectron::kEv1PEv2M]);
+    }
+
+    //ev1+ ev2- in the pair type of ev1- ev2+
+    //(as in DoMixing, where the track iterators are already exhausted for kOSandLS)
+    if (fMixType==kOSonly){
+      FillMixedPairs(diele, candidate, 0, 3, AliDielectron::kEv1MEv2P, legsFilled[AliDielectron::kEv1MEv2P]);
+    }
+  }
+
+  //set back global event values
+  AliDielectronVarManager::SetEventData(values);
+}
+
+//______________________________________________
+void AliDielectronMixingHandler::MoveEventToSameVertex(const AliDielectronEvent *ev2, const Double_t varsFirst[]) const
+{
+  //
+  // move all tracks of the mixed event ev2 to the vertex of the first event
+  //
+  const Double_t *varsMix=ev2->GetEventData();
+
+  const Double_t vFirst[3]={varsFirst[AliDielectronVarManager::kXvPrim],
+                            varsFirst[AliDielectronVarManager::kYvPrim],
+                            varsFirst[AliDielectronVarManager::kZvPrim]};
+
+  const Double_t vMix[3]  ={varsMix[AliDielectronVarManager::kXvPrim],
+                            varsMix[AliDielectronVarManager::kYvPrim],
+                            varsMix[AliDielectronVarManager::kZvPrim]};
+
+  TIter ev2P(ev2->GetTrackArrayP());
+  TIter ev2N(ev2->GetTrackArrayN());
+  AliVTrack *vtrack=0x0;
+  while ( ( vtrack=(AliVTrack*)ev2P() ) ){
+    MoveToSameVertex(vtrack, vFirst, vMix);
+  }
+
+  while ( ( vtrack=(AliVTrack*)ev2N() ) ){
+    MoveToSameVertex(vtrack, vFirst, vMix);
+  }
+}
+
+//______________________________________________
+void AliDielectronMixingHandler::FillLegBuffer(Int_t leg, const TObjArray &arr, Int_t pdg)
+{
+  //
+  // buffer the tracks of arr and their KF particles
+  //
+  std::vector<AliVTrack*> &tracks=fLegTracks[leg];
+  std::vector<AliKFParticle> &kf=fLegKF[leg];
+  tracks.clear();
+  kf.clear();
+
+  const Int_t ntracks=arr.GetEntriesFast();
+  for (Int_t itrack=0; itrack<ntracks; ++itrack){
+    AliVTrack *track=static_cast<AliVTrack*>(arr.UncheckedAt(itrack));
+    tracks.push_back(track);
+    kf.push_back(AliKFParticle(*track,pdg));
+  }
+}
+
+//______________________________________________
+void AliDielectronMixingHandler::FillMixedPairs(AliDielectron *diele, AliDielectronPair &candidate, Int_t leg1, Int_t leg2,
+                                                Int_t pairIndex, std::set<const TObject*> &legsFilled)
+{
+  //
+  // select the pairs of the buffered legs leg1 (first event) and leg2 (mixed event)
+  // as in AliDielectron::FillPairArrays and fill the histograms
+  // as in AliDielectron::FillHistograms
+  //
+  const Int_t ntrack1=fLegTracks[leg1].size();
+  const Int_t ntrack2=fLegTracks[leg2].size();
+  if (ntrack1==0 || ntrack2==0) return;
+
+  AliDielectronHistos *histos=diele->fHistos;
+  TString className, className2;
+  Bool_t pairClass=kFALSE, legClass=kFALSE;
+  if (histos){
+    className.Form("Pair_%s",AliDielectron::PairClassName(pairIndex));
+    className2.Form("Track_Legs_%s",AliDielectron::PairClassName(pairIndex));
+    pairClass=histos->GetHistogramList()->FindObject(className.Data())!=0x0;
+    legClass=histos->GetHistogramList()->FindObject(className2.Data())!=0x0;
+  }
+
+  Double_t values[AliDielectronVarManager::kNMaxValues]={0.};
+  const UInt_t selectedMask=(1<<diele->fPairFilter.GetCuts()->GetEntries())-1;
+
+  for (Int_t itrack1=0; itrack1<ntrack1; ++itrack1){
+    AliVTrack *track1=fLegTracks[leg1][itrack1];
+    const AliKFParticle &kf1=fLegKF[leg1][itrack1];
+    for (Int_t itrack2=0; itrack2<ntrack2; ++itrack2){
+      AliVTrack *track2=fLegTracks[leg2][itrack2];
+      candidate.SetTracks(track1, kf1, track2, fLegKF[leg2][itrack2]);
+      candidate.SetType(pairIndex);
+
+      Int_t label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(&candidate,diele->fPdgMother);
+      candidate.SetLabel(label);
+      if (label>-1) candidate.SetPdgCode(diele->fPdgMother);
+      else candidate.SetPdgCode(0);
+
+      // check for gamma kf particle
+      label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(&candidate,22);
+      if (label>-1 && diele->fUseGammaTracks) {
+        candidate.SetGammaTracks(track1, diele->fPdgLeg1, track2, diele->fPdgLeg2);
+      }
+
+      //pair cuts
+      UInt_t cutMask=diele->fPairFilter.IsSelected(&candidate);
+
+      //CF manager for the pair
+      if (diele->fCfManagerPair) diele->fCfManagerPair->Fill(cutMask,&candidate);
+
+      //apply cut
+      if (cutMask!=selectedMask) continue;
+
+      //histogram array for the pair
+      if (diele->fHistoArray) diele->fHistoArray->Fill(pairIndex,&candidate);
+
+      //the cuts, CF and HF managers set their own fill map
+      if (pairClass || legClass) AliDielectronVarManager::SetFillMap(diele->fUsedVars);
+
+      //fill pair information
+      if (pairClass){
+        AliDielectronVarManager::Fill(&candidate, values);
+        histos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+      }
+
+      //fill leg information, don't fill the information twice
+      if (legClass){
+        AliVParticle *d1=candidate.GetFirstDaughterP();
+        AliVParticle *d2=candidate.GetSecondDaughterP();
+        if (legsFilled.insert(d1).second){
+          AliDielectronVarManager::Fill(d1, values);
+          histos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+        }
+        if (legsFilled.insert(d2).second){
+          AliDielectronVarManager::Fill(d2, values);
+          histos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+        }
+      }
+    }
+  }
+}
+
 //______________________________________________
 Bool_t AliDielectronMixingHandler::MixRemaining(AliDielectron */*diele*/, Int_t /*ipool*/)
 {
@@ -442,6 +640,10 @@ void AliDielectronMixingHandler::Init(const AliDielectron *diele)
     fPID=TProcessID::AddProcessID();
   }
 
+  if (fFastMixing && diele && !IsFastMixingPossible(diele)){
+    AliWarning("Fast mixing is not possible with pair pre filters in the pairing, the standard mixing is used");
+  }
+
   AliDebug(10,values.Data());
 }
 
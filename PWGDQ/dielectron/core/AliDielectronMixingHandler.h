@@ -13,13 +13,20 @@
 //#                                                           #
 //#############################################################
 
+#include <set>
+#include <vector>
+
 #include <TNamed.h>
 #include <TObjArray.h>
 #include <TClonesArray.h>
 
+#include <AliKFParticle.h>
+
 #include "AliDielectronVarManager.h"
 
 class AliDielectron;
+class AliDielectronEvent;
+class AliDielectronPair;
 class AliVTrack;
 class AliVEvent;
 
@@ -55,6 +62,9 @@ public:
 
   void SetSkipFirstEvent(Bool_t skip) { fSkipFirstEvt=skip; }
 
+  void SetFastMixing(Bool_t fast=kTRUE) { fFastMixing=fast; }
+  Bool_t GetFastMixing() const { return fFastMixing; }
+
   Int_t GetNumberOfBins() const;
   Int_t FindBin(const Double_t values[], TString *dim=0x0);
   void Fill(const AliVEvent *ev, AliDielectron *diele);
@@ -76,16 +86,26 @@ private:
   Bool_t fMixIncomplete;  // whether to mix uncomplete bins at the end of the processing
   Bool_t fMoveToSameVertex; //whether to move the mixed tracks to the same vertex position
   Bool_t fSkipFirstEvt;   //whether to skip the first event in the pool
+  Bool_t fFastMixing;     //fill the mixed pairs directly into the histograms instead of the pair arrays
 
   TProcessID *fPID;             //! internal PID for references to buffered objects
+
+  std::vector<AliVTrack*>    fLegTracks[4]; //! legs of the mixing: ev1+, ev1-, ev2+, ev2- (as the track arrays)
+  std::vector<AliKFParticle> fLegKF[4];     //! KF particles of the legs, built once per track
   
   void DoMixing(TClonesArray &pool, AliDielectron *diele);
+  void DoFastMixing(TClonesArray &pool, AliDielectron *diele);
+  Bool_t IsFastMixingPossible(const AliDielectron *diele) const;
+  void MoveEventToSameVertex(const AliDielectronEvent *ev2, const Double_t varsFirst[]) const;
+  void FillLegBuffer(Int_t leg, const TObjArray &arr, Int_t pdg);
+  void FillMixedPairs(AliDielectron *diele, AliDielectronPair &candidate, Int_t leg1, Int_t leg2,
+                      Int_t pairIndex, std::set<const TObject*> &legsFilled);
 
   AliDielectronMixingHandler(const AliDielectronMixingHandler &c);
   AliDielectronMixingHandler &operator=(const AliDielectronMixingHandler &c);
 
   
-  ClassDef(AliDielectronMixingHandler,1)         // Dielectron MixingHandler
+  ClassDef(AliDielectronMixingHandler,2)         // Dielectron MixingHandler
 };
 
 
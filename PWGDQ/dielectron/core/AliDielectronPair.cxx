@@ -111,13 +111,24 @@ void AliDielectronPair::SetTracks(AliVTrack * const particle1, Int_t pid1,
   // refParticle1 and 2 are the original tracks. In the case of track rotation
   // they are needed in the framework
   //
+  AliKFParticle kf1(*particle1,pid1);
+  AliKFParticle kf2(*particle2,pid2);
+
+  SetTracks(particle1, kf1, particle2, kf2);
+}
+
+//______________________________________________
+void AliDielectronPair::SetTracks(AliVTrack * const particle1, const AliKFParticle &kf1,
+                                  AliVTrack * const particle2, const AliKFParticle &kf2)
+{
+  //
+  // Same as above, with the KF particles of the tracks already built
+  // (e.g. once per track instead of once per pair in the event mixing)
+  //
   fPair.Initialize();
   fD1.Initialize();
   fD2.Initialize();
 
-  AliKFParticle kf1(*particle1,pid1);
-  AliKFParticle kf2(*particle2,pid2);
-
   fPair.AddDaughter(kf1);
   fPair.AddDaughter(kf2);
 
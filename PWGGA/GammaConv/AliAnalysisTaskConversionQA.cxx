@@ -932,58 +932,34 @@ void AliAnalysisTaskConversionQA::RelabelAODPhotonCandidates(Bool_t mode){
     fMCStackPos[iGamma] =  PhotonCandidate->GetMCLabelPositive();
     fMCStackNeg[iGamma] =  PhotonCandidate->GetMCLabelNegative();
 
-    Bool_t AODLabelPos = kFALSE;
-    Bool_t AODLabelNeg = kFALSE;
-
-    for(Int_t i = 0; i<fInputEvent->GetNumberOfTracks();i++){
-      AliAODTrack *tempDaughter = static_cast<AliAODTrack*>(fInputEvent->GetTrack(i));
-      if(!AODLabelPos){
-        if( tempDaughter->GetID() == PhotonCandidate->GetTrackLabelPositive() ){
-        PhotonCandidate->SetMCLabelPositive(TMath::Abs(tempDaughter->GetLabel()));
-        AODLabelPos = kTRUE;
-        }
-      }
-      if(!AODLabelNeg){
-        if( tempDaughter->GetID() == PhotonCandidate->GetTrackLabelNegative()){
-        PhotonCandidate->SetMCLabelNegative(TMath::Abs(tempDaughter->GetLabel()));
-        AODLabelNeg = kTRUE;
-        }
-      }
-      if(AODLabelNeg && AODLabelPos){
-        break;
-      }
-    } // Both ESD Tracks have AOD Tracks with Positive IDs
+    // AOD tracks of the daughters from the ID lookup table of the V0 reader:
+    // positive IDs first, then the tracks stored with negative IDs (-(ESD ID+1))
+    Int_t indexPos = fV0Reader->GetAODTrackIndexFromID(PhotonCandidate->GetTrackLabelPositive());
+    Int_t indexNeg = fV0Reader->GetAODTrackIndexFromID(PhotonCandidate->GetTrackLabelNegative());
+    if(indexPos < 0 && PhotonCandidate->GetTrackLabelPositive() >= 0)
+      indexPos = fV0Reader->GetAODTrackIndexFromID(-(PhotonCandidate->GetTrackLabelPositive()+1));
+    if(indexNeg < 0 && PhotonCandidate->GetTrackLabelNegative() >= 0)
+      indexNeg = fV0Reader->GetAODTrackIndexFromID(-(PhotonCandidate->GetTrackLabelNegative()+1));
+    Bool_t AODLabelPos = indexPos >= 0;
+    Bool_t AODLabelNeg = indexNeg >= 0;
+
+    if(AODLabelPos){
+      AliAODTrack *tempDaughter = static_cast<AliAODTrack*>(fInputEvent->GetTrack(indexPos));
+      PhotonCandidate->SetMCLabelPositive(TMath::Abs(tempDaughter->GetLabel()));
+    }
+    if(AODLabelNeg){
+      AliAODTrack *tempDaughter = static_cast<AliAODTrack*>(fInputEvent->GetTrack(indexNeg));
+      PhotonCandidate->SetMCLabelNegative(TMath::Abs(tempDaughter->GetLabel()));
+    }
     if(!AODLabelPos || !AODLabelNeg){
-      for(Int_t i = 0; i<fInputEvent->GetNumberOfTracks();i++){
-        AliAODTrack *tempDaughter = static_cast<AliAODTrack*>(fInputEvent->GetTrack(i));
-        if(tempDaughter->GetID()<0){
-        if(!AODLabelPos){
-          if( (TMath::Abs(tempDaughter->GetID())-1) == PhotonCandidate->GetTrackLabelPositive()){
-            PhotonCandidate->SetMCLabelPositive(TMath::Abs(tempDaughter->GetLabel()));
-            AODLabelPos = kTRUE;
-          }
-        }
-        if(!AODLabelNeg){
-          if( (TMath::Abs(tempDaughter->GetID())-1) == PhotonCandidate->GetTrackLabelNegative()){
-            PhotonCandidate->SetMCLabelNegative(TMath::Abs(tempDaughter->GetLabel()));
-            AODLabelNeg = kTRUE;
-          }
-        }
-        }
-        if(AODLabelNeg && AODLabelPos){
-        break;
-        }
+      cout<<"WARNING!!! AOD TRACKS NOT FOUND FOR"<<endl;
+      if(!AODLabelNeg){
+        PhotonCandidate->SetMCLabelNegative(-999999);
+        PhotonCandidate->SetLabelNegative(-999999);
       }
-      if(!AODLabelPos || !AODLabelNeg){
-        cout<<"WARNING!!! AOD TRACKS NOT FOUND FOR"<<endl;
-        if(!AODLabelNeg){
-          PhotonCandidate->SetMCLabelNegative(-999999);
-          PhotonCandidate->SetLabelNegative(-999999);
-        }
-        if(!AODLabelPos){
-          PhotonCandidate->SetMCLabelPositive(-999999);
-          PhotonCandidate->SetLabelPositive(-999999);
-        }
+      if(!AODLabelPos){
+        PhotonCandidate->SetMCLabelPositive(-999999);
+        PhotonCandidate->SetLabelPositive(-999999);
       }
     }
   }
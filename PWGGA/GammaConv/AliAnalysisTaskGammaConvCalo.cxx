@@ -4906,28 +4906,21 @@ void AliAnalysisTaskGammaConvCalo::RelabelAODPhotonCandidates(Bool_t mode){
     fESDArrayPos[iGamma] = PhotonCandidate->GetTrackLabelPositive();
     fESDArrayNeg[iGamma] = PhotonCandidate->GetTrackLabelNegative();
     
-    Bool_t AODLabelPos = kFALSE;
-    Bool_t AODLabelNeg = kFALSE;
+    // AOD tracks of the daughters from the ID lookup table of the V0 reader
+    Int_t indexPos = fV0Reader->GetAODTrackIndexFromID(PhotonCandidate->GetTrackLabelPositive());
+    Int_t indexNeg = fV0Reader->GetAODTrackIndexFromID(PhotonCandidate->GetTrackLabelNegative());
+    Bool_t AODLabelPos = indexPos >= 0;
+    Bool_t AODLabelNeg = indexNeg >= 0;
     
-    for(Int_t i = 0; i<fInputEvent->GetNumberOfTracks();i++){
-      AliAODTrack *tempDaughter = static_cast<AliAODTrack*>(fInputEvent->GetTrack(i));
-      if(!AODLabelPos){
-        if( tempDaughter->GetID() == PhotonCandidate->GetTrackLabelPositive() ){
-        PhotonCandidate->SetMCLabelPositive(TMath::Abs(tempDaughter->GetLabel()));
-        PhotonCandidate->SetLabelPositive(i);
-        AODLabelPos = kTRUE;
-        }
-      }
-      if(!AODLabelNeg){
-        if( tempDaughter->GetID() == PhotonCandidate->GetTrackLabelNegative()){
-        PhotonCandidate->SetMCLabelNegative(TMath::Abs(tempDaughter->GetLabel()));
-        PhotonCandidate->SetLabelNegative(i);
-        AODLabelNeg = kTRUE;
-        }
-      }
-      if(AODLabelNeg && AODLabelPos){
-        break;
-      }
+    if(AODLabelPos){
+      AliAODTrack *tempDaughter = static_cast<AliAODTrack*>(fInputEvent->GetTrack(indexPos));
+      PhotonCandidate->SetMCLabelPositive(TMath::Abs(tempDaughter->GetLabel()));
+      PhotonCandidate->SetLabelPositive(indexPos);
+    }
+    if(AODLabelNeg){
+      AliAODTrack *tempDaughter = static_cast<AliAODTrack*>(fInputEvent->GetTrack(indexNeg));
+      PhotonCandidate->SetMCLabelNegative(TMath::Abs(tempDaughter->GetLabel()));
+      PhotonCandidate->SetLabelNegative(indexNeg);
     }
     if(!AODLabelPos || !AODLabelNeg){
       cout<<"WARNING!!! AOD TRACKS NOT FOUND FOR"<<endl;
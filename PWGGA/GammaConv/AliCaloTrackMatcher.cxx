@@ -56,11 +56,23 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType) :
   fRunNumber(-1),
   fGeomEMCAL(NULL),
   fGeomPHOS(NULL),
-  fMapTrackToCluster(),
-  fMapClusterToTrack(),
   fNEntries(1),
   fVectorDeltaEtaDeltaPhi(0),
   fMap_TrID_ClID_ToIndex(),
+  fMatchTrackKey(0),
+  fMatchTrackID(0),
+  fMatchClusterID(0),
+  fClusterMatchMinID(0),
+  fClusterMatchOffset(0),
+  fClusterMatchTrack(0),
+  fClusterMatchResidual(0),
+  fTrackMatchMinID(0),
+  fTrackMatchOffset(0),
+  fTrackMatchCluster(0),
+  fTrackMatchResidual(0),
+  fTrackPosEvent(NULL),
+  fTrackPosFromID(0),
+  fTrackPosFromNegID(0),
   fSecMapTrackToCluster(),
   fSecMapClusterToTrack(),
   fSecNEntries(1),
@@ -78,10 +90,9 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType) :
 //________________________________________________________________________
 AliCaloTrackMatcher::~AliCaloTrackMatcher(){
     // default deconstructor
-    fMapTrackToCluster.clear();
-    fMapClusterToTrack.clear();
     fVectorDeltaEtaDeltaPhi.clear();
     fMap_TrID_ClID_ToIndex.clear();
+    ClearMatchTables();
 
     fSecMapTrackToCluster.clear();
     fSecMapClusterToTrack.clear();
@@ -98,10 +109,9 @@ AliCaloTrackMatcher::~AliCaloTrackMatcher(){
 
 //________________________________________________________________________
 void AliCaloTrackMatcher::Terminate(Option_t *){
-  fMapTrackToCluster.clear();
-  fMapClusterToTrack.clear();
   fVectorDeltaEtaDeltaPhi.clear();
   fMap_TrID_ClID_ToIndex.clear();
+  ClearMatchTables();
 
   fSecMapTrackToCluster.clear();
   fSecMapClusterToTrack.clear();
@@ -151,11 +161,10 @@ void AliCaloTrackMatcher::UserCreateOutputObjects(){
 //________________________________________________________________________
 void AliCaloTrackMatcher::Initialize(Int_t runNumber){
   // Initialize function to be called once before analysis
-  fMapTrackToCluster.clear();
-  fMapClusterToTrack.clear();
   fNEntries = 1;
   fVectorDeltaEtaDeltaPhi.clear();
   fMap_TrID_ClID_ToIndex.clear();
+  ClearMatchTables();
 
   fSecMapTrackToCluster.clear();
   fSecMapClusterToTrack.clear();
@@ -183,6 +192,9 @@ void AliCaloTrackMatcher::UserExec(Option_t *){
 
   //DebugV0Matching();
 
+  // track ID -> position tables are rebuilt for the new event on first use
+  fTrackPosEvent = NULL;
+
   // do processing only for EMCal (1), DCal (3) or PHOS (2) clusters, otherwise do nothing
   if(fClusterType == 1 || fClusterType == 2 || fClusterType == 3){
     Initialize(fInputEvent->GetRunNumber());
@@ -322,13 +334,10 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
       if(dR2 > fMatchingResidual) continue;
 //cout << "MATCHED!!!!!!!" << endl;
       nClusterMatchesToTrack++;
-      if(aodev){
-        fMapTrackToCluster.insert(make_pair(itr,cluster->GetID()));
-        fMapClusterToTrack.insert(make_pair(cluster->GetID(),itr));
-      }else{
-        fMapTrackToCluster.insert(make_pair(inTrack->GetID(),cluster->GetID()));
-        fMapClusterToTrack.insert(make_pair(cluster->GetID(),inTrack->GetID()));
-      }
+      if(aodev) fMatchTrackKey.push_back(itr);
+      else fMatchTrackKey.push_back(inTrack->GetID());
+      fMatchTrackID.push_back(inTrack->GetID());
+      fMatchClusterID.push_back(cluster->GetID());
       fVectorDeltaEtaDeltaPhi.push_back(make_pair(dEta,dPhi));
       fMap_TrID_ClID_ToIndex[make_pair(inTrack->GetID(),cluster->GetID())] = fNEntries++;
       if( (Int_t)fVectorDeltaEtaDeltaPhi.size() != (fNEntries-1)) AliFatal("Fatal error in AliCaloTrackMatcher, vector and map are not in sync!");
@@ -338,9 +347,118 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     delete trackParam;
   }
 
+  BuildMatchTables();
+
   return;
 }
 
+//________________________________________________________________________
+void AliCaloTrackMatcher::ClearMatchTables(){
+  fMatchTrackKey.clear();
+  fMatchTrackID.clear();
+  fMatchClusterID.clear();
+  fClusterMatchMinID = 0;
+  fClusterMatchOffset.clear();
+  fClusterMatchTrack.clear();
+  fClusterMatchResidual.clear();
+  fTrackMatchMinID = 0;
+  fTrackMatchOffset.clear();
+  fTrackMatchCluster.clear();
+  fTrackMatchResidual.clear();
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::BuildMatchTables(){
+  // Group the matches of the current event by cluster ID and by track (position for AOD, ID for ESD),
+  // so that the queries only run over the matches of the requested cluster/track.
+  // The matches of a cluster/track keep the order in which they were found. Each entry holds the
+  // residual stored for its (trackID,clusterID) tuple, as returned by GetTrackClusterMatchingResidual.
+  Int_t nMatches = fMatchTrackKey.size();
+  vector<pairFloat> residuals(nMatches);
+  for(Int_t i=0; i<nMatches; i++){
+    mapT::iterator iter = fMap_TrID_ClID_ToIndex.find(make_pair(fMatchTrackID[i],fMatchClusterID[i]));
+    if(iter == fMap_TrID_ClID_ToIndex.end() || iter->second == 0) AliFatal("Fatal error in AliCaloTrackMatcher, match tables and map are not in sync!");
+    residuals[i] = fVectorDeltaEtaDeltaPhi.at(iter->second-1);
+  }
+  BuildMatchTable(fMatchClusterID,fMatchTrackKey,residuals,fClusterMatchMinID,fClusterMatchOffset,fClusterMatchTrack,fClusterMatchResidual);
+  BuildMatchTable(fMatchTrackKey,fMatchClusterID,residuals,fTrackMatchMinID,fTrackMatchOffset,fTrackMatchCluster,fTrackMatchResidual);
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::BuildMatchTable(const vector<Int_t> &keys, const vector<Int_t> &values, const vector<pairFloat> &residuals,
+                                          Int_t &minKey, vector<Int_t> &offset, vector<Int_t> &tableValues, vector<pairFloat> &tableResiduals){
+  // Counting sort of the matches by key: the matches of key k are stored in
+  // tableValues/tableResiduals from offset[k-minKey] to offset[k-minKey+1]
+  Int_t nMatches = keys.size();
+  minKey = 0;
+  offset.clear();
+  tableValues.resize(nMatches);
+  tableResiduals.resize(nMatches);
+  if(nMatches == 0) return;
+
+  minKey = keys[0];
+  Int_t maxKey = keys[0];
+  for(Int_t i=1; i<nMatches; i++){
+    if(keys[i] < minKey) minKey = keys[i];
+    if(keys[i] > maxKey) maxKey = keys[i];
+  }
+  offset.assign(maxKey-minKey+2,0);
+  for(Int_t i=0; i<nMatches; i++) offset[keys[i]-minKey+1]++;
+  for(Int_t k=1; k<(Int_t)offset.size(); k++) offset[k] += offset[k-1];
+
+  vector<Int_t> fill(offset.begin(),offset.end()-1);
+  for(Int_t i=0; i<nMatches; i++){
+    Int_t pos = fill[keys[i]-minKey]++;
+    tableValues[pos] = values[i];
+    tableResiduals[pos] = residuals[i];
+  }
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::GetMatchRange(const vector<Int_t> &offset, Int_t minKey, Int_t key, Int_t &first, Int_t &last) const{
+  // Range [first,last) of the entries of key in a match table, empty if key has no matches
+  first = 0;
+  last = 0;
+  Int_t slot = key - minKey;
+  if(slot < 0 || slot+1 >= (Int_t)offset.size()) return;
+  first = offset[slot];
+  last = offset[slot+1];
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::FindTrackPosition(AliVEvent *event, Int_t trackID){
+  // Position in the event of the first track with the given ID, -1 if there is none
+  // The ID -> position tables are filled once per event on first use
+  if(event != fTrackPosEvent){
+    fTrackPosFromID.clear();
+    fTrackPosFromNegID.clear();
+    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
+      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
+      if(!currTrack) continue;
+      Int_t id = currTrack->GetID();
+      vector<Int_t> &table = (id >= 0) ? fTrackPosFromID : fTrackPosFromNegID;
+      Int_t slot = (id >= 0) ? id : -id-1;
+      if(slot >= (Int_t)table.size()) table.resize(slot+1,-1);
+      if(table[slot] < 0) table[slot] = iTrack;
+    }
+    fTrackPosEvent = event;
+  }
+  const vector<Int_t> &table = (trackID >= 0) ? fTrackPosFromID : fTrackPosFromNegID;
+  Int_t slot = (trackID >= 0) ? trackID : -trackID-1;
+  if(slot >= (Int_t)table.size()) return -1;
+  return table[slot];
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetTrackPosition(AliVEvent *event, Int_t trackID){
+  if(event->IsA()!=AliAODEvent::Class()) return trackID; // for ESD just take trackID
+
+  // for AOD, we have to look for position of track in the event
+  Int_t TrackPos = FindTrackPosition(event,trackID);
+  if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
+  return TrackPos;
+}
+
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliVTrack* inSecTrack, AliVCluster* cluster, AliVEvent* event, Float_t &dEta, Float_t &dPhi){
 
@@ -482,14 +600,7 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
 
     if(aodev){
       //need to search for position in case of AOD
-      Int_t TrackPos = -1;
-      for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-        AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-        if(currTrack->GetID() == inSecTrack->GetID()){
-          TrackPos = iTrack;
-          break;
-        }
-      }
+      Int_t TrackPos = FindTrackPosition(event,inSecTrack->GetID());
       if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: PropagateV0TrackToClusterAndGetMatchingResidual - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",inSecTrack->GetID()));
       fSecMapTrackToCluster.insert(make_pair(TrackPos,cluster->GetID()));
       fSecMapClusterToTrack.insert(make_pair(cluster->GetID(),TrackPos));
@@ -519,7 +630,9 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
 //________________________________________________________________________
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::GetTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi){
-  Int_t position = fMap_TrID_ClID_ToIndex[make_pair(trackID,clusterID)];
+  mapT::iterator iter = fMap_TrID_ClID_ToIndex.find(make_pair(trackID,clusterID));
+  if(iter == fMap_TrID_ClID_ToIndex.end()) return kFALSE;
+  Int_t position = iter->second;
   if(position == 0) return kFALSE;
 
   pairFloat tempEtaPhi = fVectorDeltaEtaDeltaPhi.at(position-1);
@@ -530,21 +643,19 @@ Bool_t AliCaloTrackMatcher::GetTrackClusterMatchingResidual(Int_t trackID, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
-      }
+  Int_t first, last;
+  GetMatchRange(fClusterMatchOffset,fClusterMatchMinID,clusterID,first,last);
+  for (Int_t i=first; i<last; i++){
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fClusterMatchTrack[i]));
+    if(!tempTrack) continue;
+    Float_t tempDEta = fClusterMatchResidual[i].first;
+    Float_t tempDPhi = fClusterMatchResidual[i].second;
+    if(tempTrack->Charge()>0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+    }else if(tempTrack->Charge()<0){
+      dPhiMin*=-1;
+      dPhiMax*=-1;
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
     }
   }
 
@@ -554,24 +665,22 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-        
-        if (match_dPhi && match_dEta )matched++;
-      }
-    }
+  Int_t first, last;
+  GetMatchRange(fClusterMatchOffset,fClusterMatchMinID,clusterID,first,last);
+  for (Int_t i=first; i<last; i++){
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fClusterMatchTrack[i]));
+    if(!tempTrack) continue;
+    Float_t tempDEta = fClusterMatchResidual[i].first;
+    Float_t tempDPhi = fClusterMatchResidual[i].second;
+    Bool_t match_dEta = kFALSE;
+    Bool_t match_dPhi = kFALSE;
+    if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+    else match_dEta = kFALSE;
+
+    if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+    else match_dPhi = kFALSE;
+    
+    if (match_dPhi && match_dEta )matched++;
   }
   return matched;
 }
@@ -579,16 +688,14 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
-    }
+  Int_t first, last;
+  GetMatchRange(fClusterMatchOffset,fClusterMatchMinID,clusterID,first,last);
+  for (Int_t i=first; i<last; i++){
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fClusterMatchTrack[i]));
+    if(!tempTrack) continue;
+    Float_t tempDEta = fClusterMatchResidual[i].first;
+    Float_t tempDPhi = fClusterMatchResidual[i].second;
+    if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
   }
   return matched;
 }
@@ -596,34 +703,22 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
 
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t TrackPos = GetTrackPosition(event,trackID);
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
-      }
+  Int_t first, last;
+  GetMatchRange(fTrackMatchOffset,fTrackMatchMinID,TrackPos,first,last);
+  for (Int_t i=first; i<last; i++){
+    Float_t tempDEta = fTrackMatchResidual[i].first;
+    Float_t tempDPhi = fTrackMatchResidual[i].second;
+    if(tempTrack->Charge()>0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+    }else if(tempTrack->Charge()<0){
+      dPhiMin*=-1;
+      dPhiMax*=-1;
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
     }
   }
   return matched;
@@ -631,67 +726,43 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t TrackPos = GetTrackPosition(event,trackID);
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-        
-        if (match_dPhi && match_dEta )matched++;
+  Int_t first, last;
+  GetMatchRange(fTrackMatchOffset,fTrackMatchMinID,TrackPos,first,last);
+  for (Int_t i=first; i<last; i++){
+    Float_t tempDEta = fTrackMatchResidual[i].first;
+    Float_t tempDPhi = fTrackMatchResidual[i].second;
+    Bool_t match_dEta = kFALSE;
+    Bool_t match_dPhi = kFALSE;
+    if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+    else match_dEta = kFALSE;
+
+    if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+    else match_dPhi = kFALSE;
+    
+    if (match_dPhi && match_dEta )matched++;
 
-      }
-    }
   }
   return matched;
 }
 
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t TrackPos = GetTrackPosition(event,trackID);
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
-    }
+  Int_t first, last;
+  GetMatchRange(fTrackMatchOffset,fTrackMatchMinID,TrackPos,first,last);
+  for (Int_t i=first; i<last; i++){
+    Float_t tempDEta = fTrackMatchResidual[i].first;
+    Float_t tempDPhi = fTrackMatchResidual[i].second;
+    if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
   }
   return matched;
 }
@@ -699,21 +770,19 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }
-      }
+  Int_t first, last;
+  GetMatchRange(fClusterMatchOffset,fClusterMatchMinID,clusterID,first,last);
+  for (Int_t i=first; i<last; i++){
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fClusterMatchTrack[i]));
+    if(!tempTrack) continue;
+    Float_t tempDEta = fClusterMatchResidual[i].first;
+    Float_t tempDPhi = fClusterMatchResidual[i].second;
+    if(tempTrack->Charge()>0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(fClusterMatchTrack[i]);
+    }else if(tempTrack->Charge()<0){
+      dPhiMin*=-1;
+      dPhiMax*=-1;
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(fClusterMatchTrack[i]);
     }
   }
   return tempMatchedTracks;
@@ -722,25 +791,23 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
+  Int_t first, last;
+  GetMatchRange(fClusterMatchOffset,fClusterMatchMinID,clusterID,first,last);
+  for (Int_t i=first; i<last; i++){
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fClusterMatchTrack[i]));
+    if(!tempTrack) continue;
+    Float_t tempDEta = fClusterMatchResidual[i].first;
+    Float_t tempDPhi = fClusterMatchResidual[i].second;
+    Bool_t match_dEta = kFALSE;
+    Bool_t match_dPhi = kFALSE;
+    if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+    else match_dEta = kFALSE;
+
+    if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+    else match_dPhi = kFALSE;
+    
+    if (match_dPhi && match_dEta )tempMatchedTracks.push_back(fClusterMatchTrack[i]);
 
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-        
-        if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
-
-      }
-    }
   }
   return tempMatchedTracks;
 }
@@ -748,50 +815,36 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  Float_t dR){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
-      }
-    }
+  Int_t first, last;
+  GetMatchRange(fClusterMatchOffset,fClusterMatchMinID,clusterID,first,last);
+  for (Int_t i=first; i<last; i++){
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(fClusterMatchTrack[i]));
+    if(!tempTrack) continue;
+    Float_t tempDEta = fClusterMatchResidual[i].first;
+    Float_t tempDPhi = fClusterMatchResidual[i].second;
+    if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(fClusterMatchTrack[i]);
   }
   return tempMatchedTracks;
 }
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t TrackPos = GetTrackPosition(event,trackID);
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }
-      }
+  Int_t first, last;
+  GetMatchRange(fTrackMatchOffset,fTrackMatchMinID,TrackPos,first,last);
+  for (Int_t i=first; i<last; i++){
+    Float_t tempDEta = fTrackMatchResidual[i].first;
+    Float_t tempDPhi = fTrackMatchResidual[i].second;
+    if(tempTrack->Charge()>0){
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(fTrackMatchCluster[i]);
+    }else if(tempTrack->Charge()<0){
+      dPhiMin*=-1;
+      dPhiMax*=-1;
+      if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(fTrackMatchCluster[i]);
     }
   }
 
@@ -800,66 +853,42 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t TrackPos = GetTrackPosition(event,trackID);
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-        
-        if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
-      }
-    }
+  Int_t first, last;
+  GetMatchRange(fTrackMatchOffset,fTrackMatchMinID,TrackPos,first,last);
+  for (Int_t i=first; i<last; i++){
+    Float_t tempDEta = fTrackMatchResidual[i].first;
+    Float_t tempDPhi = fTrackMatchResidual[i].second;
+    Bool_t match_dEta = kFALSE;
+    Bool_t match_dPhi = kFALSE;
+    if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+    else match_dEta = kFALSE;
+
+    if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+    else match_dPhi = kFALSE;
+    
+    if (match_dPhi && match_dEta )tempMatchedClusters.push_back(fTrackMatchCluster[i]);
   }
   return tempMatchedClusters;
 }
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event, Int_t trackID, Float_t dR){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t TrackPos = GetTrackPosition(event,trackID);
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
-      }
-    }
+  Int_t first, last;
+  GetMatchRange(fTrackMatchOffset,fTrackMatchMinID,TrackPos,first,last);
+  for (Int_t i=first; i<last; i++){
+    Float_t tempDEta = fTrackMatchResidual[i].first;
+    Float_t tempDPhi = fTrackMatchResidual[i].second;
+    if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(fTrackMatchCluster[i]);
   }
   return tempMatchedClusters;
 }
@@ -870,7 +899,9 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
 //________________________________________________________________________
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::GetSecTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi){
-  Int_t position = fSecMap_TrID_ClID_ToIndex[make_pair(trackID,clusterID)];
+  mapT::iterator iter = fSecMap_TrID_ClID_ToIndex.find(make_pair(trackID,clusterID));
+  if(iter == fSecMap_TrID_ClID_ToIndex.end()) return kFALSE;
+  Int_t position = iter->second;
   if(position == 0) return kFALSE;
 
   pairFloat tempEtaPhi = fSecVectorDeltaEtaDeltaPhi.at(position-1);
@@ -880,7 +911,9 @@ Bool_t AliCaloTrackMatcher::GetSecTrackClusterMatchingResidual(Int_t trackID, In
 }
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::IsSecTrackClusterAlreadyTried(Int_t trackID, Int_t clusterID){
-  Int_t position = fSecMap_TrID_ClID_AlreadyTried[make_pair(trackID,clusterID)];
+  mapT::iterator iter = fSecMap_TrID_ClID_AlreadyTried.find(make_pair(trackID,clusterID));
+  if(iter == fSecMap_TrID_ClID_AlreadyTried.end()) return kFALSE;
+  Int_t position = iter->second;
   if(position == 0) return kFALSE;
   else return kTRUE;
 }
@@ -888,7 +921,8 @@ Bool_t AliCaloTrackMatcher::IsSecTrackClusterAlreadyTried(Int_t trackID, Int_t c
 Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   Int_t matched = 0;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapClusterToTrack.equal_range(clusterID);
+  for (it=range.first; it!=range.second; ++it){
     if(it->first == clusterID){
       Float_t tempDEta, tempDPhi;
       AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
@@ -912,7 +946,8 @@ Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, In
 Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t matched = 0;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapClusterToTrack.equal_range(clusterID);
+  for (it=range.first; it!=range.second; ++it){
     if(it->first == clusterID){
       Float_t tempDEta, tempDPhi;
       AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
@@ -938,7 +973,8 @@ Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, In
 Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   Int_t matched = 0;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapClusterToTrack.equal_range(clusterID);
+  for (it=range.first; it!=range.second; ++it){
     if(it->first == clusterID){
       Float_t tempDEta, tempDPhi;
       AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
@@ -954,23 +990,14 @@ Int_t AliCaloTrackMatcher::GetNMatchedSecTrackIDsForCluster(AliVEvent *event, In
 
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t TrackPos = GetTrackPosition(event,trackID);
 
   Int_t matched = 0;
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapTrackToCluster.equal_range(TrackPos);
+  for (it=range.first; it!=range.second; ++it){
     if(it->first == TrackPos){
       Float_t tempDEta, tempDPhi;
       if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
@@ -990,23 +1017,14 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
 
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t TrackPos = GetTrackPosition(event,trackID);
 
   Int_t matched = 0;
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapTrackToCluster.equal_range(TrackPos);
+  for (it=range.first; it!=range.second; ++it){
     if(it->first == TrackPos){
       Float_t tempDEta, tempDPhi;
       if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
@@ -1029,23 +1047,14 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
 
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t trackID, Float_t dR){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t TrackPos = GetTrackPosition(event,trackID);
 
   Int_t matched = 0;
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapTrackToCluster.equal_range(TrackPos);
+  for (it=range.first; it!=range.second; ++it){
     if(it->first == TrackPos){
       Float_t tempDEta, tempDPhi;
       if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
@@ -1061,7 +1070,8 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForSecTrack(AliVEvent *event, In
 vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   vector<Int_t> tempMatchedTracks;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapClusterToTrack.equal_range(clusterID);
+  for (it=range.first; it!=range.second; ++it){
     if(it->first == clusterID){
       Float_t tempDEta, tempDPhi;
       AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
@@ -1085,7 +1095,8 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *ev
 vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   vector<Int_t> tempMatchedTracks;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapClusterToTrack.equal_range(clusterID);
+  for (it=range.first; it!=range.second; ++it){
     if(it->first == clusterID){
       Float_t tempDEta, tempDPhi;
       AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
@@ -1111,7 +1122,8 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *ev
 vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   vector<Int_t> tempMatchedTracks;
   multimap<Int_t,Int_t>::iterator it;
-  for (it=fSecMapClusterToTrack.begin(); it!=fSecMapClusterToTrack.end(); ++it){
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapClusterToTrack.equal_range(clusterID);
+  for (it=range.first; it!=range.second; ++it){
     if(it->first == clusterID){
       Float_t tempDEta, tempDPhi;
       AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
@@ -1127,23 +1139,14 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedSecTrackIDsForCluster(AliVEvent *ev
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t trackID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t TrackPos = GetTrackPosition(event,trackID);
 
   vector<Int_t> tempMatchedClusters;
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapTrackToCluster.equal_range(TrackPos);
+  for (it=range.first; it!=range.second; ++it){
     if(it->first == TrackPos){
       Float_t tempDEta, tempDPhi;
       if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
@@ -1163,23 +1166,14 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t trackID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t TrackPos = GetTrackPosition(event,trackID);
 
   vector<Int_t> tempMatchedClusters;
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapTrackToCluster.equal_range(TrackPos);
+  for (it=range.first; it!=range.second; ++it){
     if(it->first == TrackPos){
       Float_t tempDEta, tempDPhi;
       if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
@@ -1201,23 +1195,14 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *ev
 
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t trackID, Float_t dR){
-  Int_t TrackPos = -1;
-  if(event->IsA()==AliAODEvent::Class()){ // for AOD, we have to look for position of track in the event
-    for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++){
-      AliVTrack* currTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(iTrack));
-      if(currTrack->GetID() == trackID){
-        TrackPos = iTrack;
-        break;
-      }
-    }
-    if(TrackPos == -1) AliFatal(Form("AliCaloTrackMatcher: GetNMatchedClusterIDsForTrack - track (ID: '%i') cannot be retrieved from event, should be impossible as it has been used in maim task before!",trackID));
-  }else TrackPos = trackID; // for ESD just take trackID
+  Int_t TrackPos = GetTrackPosition(event,trackID);
 
   vector<Int_t> tempMatchedClusters;
   multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fSecMapTrackToCluster.begin(); it!=fSecMapTrackToCluster.end(); ++it){
+  pair<multimap<Int_t,Int_t>::iterator,multimap<Int_t,Int_t>::iterator> range = fSecMapTrackToCluster.equal_range(TrackPos);
+  for (it=range.first; it!=range.second; ++it){
     if(it->first == TrackPos){
       Float_t tempDEta, tempDPhi;
       if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
@@ -1326,11 +1311,12 @@ void AliCaloTrackMatcher::DebugMatching(){
       cout << itr << " (" << tCharge << ") - " << GetNMatchedClusterIDsForTrack(fInputEvent,inTrack->GetID(),5,-5,0.2,-0.4) << "\t\t";
     }
     cout << endl;
-    multimap<Int_t,Int_t>::iterator it;
-    for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it) cout << it->first << " => " << it->second << '\n';
+    for (Int_t k=0; k+1<(Int_t)fTrackMatchOffset.size(); k++)
+      for (Int_t i=fTrackMatchOffset[k]; i<fTrackMatchOffset[k+1]; i++) cout << k+fTrackMatchMinID << " => " << fTrackMatchCluster[i] << '\n';
     cout << "mapClusterToTrack" << endl;
-    Int_t tempClus = it->second;
-    for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it) cout << it->first << " => " << it->second << '\n';
+    Int_t tempClus = fTrackMatchCluster.back();
+    for (Int_t k=0; k+1<(Int_t)fClusterMatchOffset.size(); k++)
+      for (Int_t i=fClusterMatchOffset[k]; i<fClusterMatchOffset[k+1]; i++) cout << k+fClusterMatchMinID << " => " << fClusterMatchTrack[i] << '\n';
     vector<Int_t> tempTracks = GetMatchedTrackIDsForCluster(fInputEvent,tempClus, 5, -5, 0.2, -0.4);
     for(Int_t iJ=0; iJ<tempTracks.size();iJ++){
       cout << tempClus << " - " << tempTracks.at(iJ) << endl;
@@ -85,6 +85,13 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     // private methods
     void Initialize(Int_t runNumber);
     void ProcessEvent(AliVEvent *event);
+    void ClearMatchTables();
+    void BuildMatchTables();
+    void BuildMatchTable(const vector<Int_t> &keys, const vector<Int_t> &values, const vector<pairFloat> &residuals,
+                         Int_t &minKey, vector<Int_t> &offset, vector<Int_t> &tableValues, vector<pairFloat> &tableResiduals);
+    void GetMatchRange(const vector<Int_t> &offset, Int_t minKey, Int_t key, Int_t &first, Int_t &last) const;
+    Int_t FindTrackPosition(AliVEvent *event, Int_t trackID);
+    Int_t GetTrackPosition(AliVEvent *event, Int_t trackID);
     void SetLogBinningYTH2(TH2* histoRebin);
 
     // debug methods
@@ -101,13 +108,26 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     AliEMCALGeometry*     fGeomEMCAL;              // pointer to EMCAL geometry
     AliPHOSGeometry*      fGeomPHOS;               // pointer to PHOS geometry
 
-    multimap<Int_t,Int_t> fMapTrackToCluster;      // connects a given track ID with all associated cluster IDs
-    multimap<Int_t,Int_t> fMapClusterToTrack;      // connects a given cluster ID with all associated track IDs
-
     Int_t                 fNEntries;               // number of current TrackID/ClusterID -> Eta/Phi connections
     vector<pairFloat>     fVectorDeltaEtaDeltaPhi; // vector of all matching residuals for a specific TrackID/ClusterID
     mapT                  fMap_TrID_ClID_ToIndex;  // map tuple of (trackID,clusterID) to index in vector fVectorDeltaEtaDeltaPhi
 
+    // track <-> cluster associations of the current event, grouped by cluster and by track (position in AOD, ID in ESD)
+    vector<Int_t>         fMatchTrackKey;          //! track (position in AOD, ID in ESD) of each association, in the order found
+    vector<Int_t>         fMatchTrackID;           //! track ID of each association
+    vector<Int_t>         fMatchClusterID;         //! cluster ID of each association
+    Int_t                 fClusterMatchMinID;      //! smallest cluster ID with associations
+    vector<Int_t>         fClusterMatchOffset;     //! first entry of each cluster ID (from fClusterMatchMinID) in the tables below
+    vector<Int_t>         fClusterMatchTrack;      //! associated tracks, grouped by cluster
+    vector<pairFloat>     fClusterMatchResidual;   //! matching residuals next to fClusterMatchTrack
+    Int_t                 fTrackMatchMinID;        //! smallest track with associations
+    vector<Int_t>         fTrackMatchOffset;       //! first entry of each track (from fTrackMatchMinID) in the tables below
+    vector<Int_t>         fTrackMatchCluster;      //! associated cluster IDs, grouped by track
+    vector<pairFloat>     fTrackMatchResidual;     //! matching residuals next to fTrackMatchCluster
+    AliVEvent*            fTrackPosEvent;          //! event of the track ID -> position tables
+    vector<Int_t>         fTrackPosFromID;         //! position of the first track with each non-negative ID, -1 if none
+    vector<Int_t>         fTrackPosFromNegID;      //! same for the negative IDs, stored at -ID-1
+
     // for cluster <-> V0-track matching (running with different mass hypthesis)
     multimap<Int_t,Int_t> fSecMapTrackToCluster;      // connects a given secondary track ID with all associated cluster IDs
     multimap<Int_t,Int_t> fSecMapClusterToTrack;      // connects a given cluster ID with all associated secondary track IDs
@@ -122,7 +142,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     TH2F*                 fHistControlMatches;     // bookkeeping for processed tracks/clusters and succesful matches
     TH2F*                 fSecHistControlMatches;  // bookkeeping for processed V0-tracks/clusters and succesful matches
 
-    ClassDef(AliCaloTrackMatcher,2)
+    ClassDef(AliCaloTrackMatcher,3)
 };
 
 #endif
@@ -146,7 +146,10 @@ AliV0ReaderV1::AliV0ReaderV1(const char *name) : AliAnalysisTaskSE(name),
   fImpactParamTree(NULL),
   fVectorFoundGammas(0),
   fCurrentFileName(""),
-  fMCFileChecked(kFALSE)
+  fMCFileChecked(kFALSE),
+  fAODTrackIndexPos(0),
+  fAODTrackIndexNeg(0),
+  fAODTrackIndexBuilt(kFALSE)
 {
   // Default constructor
 
@@ -577,6 +580,7 @@ Bool_t AliV0ReaderV1::ProcessEvent(AliVEvent *inputEvent,AliMCEvent *mcEvent)
 
   fInputEvent = inputEvent;
   fMCEvent    = mcEvent;
+  fAODTrackIndexBuilt = kFALSE;
 
   if(!fInputEvent){
     AliError("No Input event");
@@ -1259,28 +1263,20 @@ void AliV0ReaderV1::RelabelAODPhotonCandidates(AliAODConversionPhoton *PhotonCan
   // Relabeling For AOD Event
   // ESDiD -> AODiD
   // MCLabel -> AODMCLabel
-  Bool_t AODLabelPos = kFALSE;
-  Bool_t AODLabelNeg = kFALSE;
-
-  for(Int_t i = 0; i<fInputEvent->GetNumberOfTracks();i++){
-    AliAODTrack *tempDaughter = static_cast<AliAODTrack*>(fInputEvent->GetTrack(i));
-    if(!AODLabelPos){
-      if( tempDaughter->GetID() == PhotonCandidate->GetTrackLabelPositive() ){
-        PhotonCandidate->SetMCLabelPositive(TMath::Abs(tempDaughter->GetLabel()));
-        PhotonCandidate->SetLabelPositive(i);
-        AODLabelPos = kTRUE;
-      }
-    }
-    if(!AODLabelNeg){
-      if( tempDaughter->GetID() == PhotonCandidate->GetTrackLabelNegative()){
-        PhotonCandidate->SetMCLabelNegative(TMath::Abs(tempDaughter->GetLabel()));
-        PhotonCandidate->SetLabelNegative(i);
-        AODLabelNeg = kTRUE;
-      }
-    }
-    if(AODLabelNeg && AODLabelPos){
-      return;
-    }
+  Int_t indexPos = GetAODTrackIndexFromID(PhotonCandidate->GetTrackLabelPositive());
+  Int_t indexNeg = GetAODTrackIndexFromID(PhotonCandidate->GetTrackLabelNegative());
+  Bool_t AODLabelPos = indexPos >= 0;
+  Bool_t AODLabelNeg = indexNeg >= 0;
+
+  if(AODLabelPos){
+    AliAODTrack *tempDaughter = static_cast<AliAODTrack*>(fInputEvent->GetTrack(indexPos));
+    PhotonCandidate->SetMCLabelPositive(TMath::Abs(tempDaughter->GetLabel()));
+    PhotonCandidate->SetLabelPositive(indexPos);
+  }
+  if(AODLabelNeg){
+    AliAODTrack *tempDaughter = static_cast<AliAODTrack*>(fInputEvent->GetTrack(indexNeg));
+    PhotonCandidate->SetMCLabelNegative(TMath::Abs(tempDaughter->GetLabel()));
+    PhotonCandidate->SetLabelNegative(indexNeg);
   }
   if(!AODLabelPos || !AODLabelNeg){
     AliError(Form("NO AOD Daughters Found Pos: %i %i Neg: %i %i, setting all labels to -999999",AODLabelPos,PhotonCandidate->GetTrackLabelPositive(),AODLabelNeg,PhotonCandidate->GetTrackLabelNegative()));
@@ -1296,6 +1292,40 @@ void AliV0ReaderV1::RelabelAODPhotonCandidates(AliAODConversionPhoton *PhotonCan
 
 }
 
+//________________________________________________________________________
+void AliV0ReaderV1::BuildAODTrackIndexTable(){
+
+  // Fill the lookup tables AOD track ID -> position in the AOD track array for the current event.
+  // Several AOD tracks can share a (negative) ID, the first one is kept as in a linear search.
+  fAODTrackIndexPos.clear();
+  fAODTrackIndexNeg.clear();
+  fAODTrackIndexBuilt = kTRUE;
+  if(!fInputEvent) return;
+
+  for(Int_t i = 0; i<fInputEvent->GetNumberOfTracks();i++){
+    AliVTrack *track = static_cast<AliVTrack*>(fInputEvent->GetTrack(i));
+    if(!track) continue;
+    Int_t id = track->GetID();
+    vector<Int_t> &table = (id >= 0) ? fAODTrackIndexPos : fAODTrackIndexNeg;
+    Int_t slot = (id >= 0) ? id : -id-1;
+    if(slot >= (Int_t)table.size()) table.resize(slot+1,-1);
+    if(table[slot] < 0) table[slot] = i;
+  }
+}
+
+//________________________________________________________________________
+Int_t AliV0ReaderV1::GetAODTrackIndexFromID(Int_t id){
+
+  // Position in the AOD track array of the first track with GetID() == id, -1 if there is none.
+  // The lookup tables are built once per event on first use, so that all photon candidates of this
+  // reader and the tasks using it share them instead of scanning the track array for each daughter.
+  if(!fAODTrackIndexBuilt) BuildAODTrackIndexTable();
+  const vector<Int_t> &table = (id >= 0) ? fAODTrackIndexPos : fAODTrackIndexNeg;
+  Int_t slot = (id >= 0) ? id : -id-1;
+  if(slot >= (Int_t)table.size()) return -1;
+  return table[slot];
+}
+
 //************************************************************************
 // This function counts the number of primary tracks in the event, the 
 // implementation for ESD and AOD had to be different due to the different
@@ -82,6 +82,7 @@ class AliV0ReaderV1 : public AliAnalysisTaskSE {
     Bool_t             AreAODsRelabeled()                               {return fRelabelAODs;}
     Int_t              IsReaderPerformingRelabeling()                   {return fPreviousV0ReaderPerformsAODRelabeling;}
     void               RelabelAODPhotonCandidates(AliAODConversionPhoton *PhotonCandidate);
+    Int_t              GetAODTrackIndexFromID(Int_t id);                // position in the AOD track array of the first track with GetID()==id, -1 if none
     void               SetPeriodName(TString name)                      {fPeriodName = name;
                                                                          AliInfo(Form("Set PeriodName to: %s",fPeriodName.Data()));
                                                                          return;}
@@ -122,6 +123,7 @@ class AliV0ReaderV1 : public AliAnalysisTaskSE {
     AliKFConversionPhoton*  ReconstructV0(AliESDv0* fCurrentV0,Int_t currentV0Index);
     void                    FillAODOutput();
     void                    FindDeltaAODBranchName();
+    void                    BuildAODTrackIndexTable();
     Bool_t                  GetAODConversionGammas();
 
     // Getter Functions
@@ -205,12 +207,15 @@ class AliV0ReaderV1 : public AliAnalysisTaskSE {
     vector<Int_t>  fVectorFoundGammas;            // vector with found MC labels of gammas
     TString       fCurrentFileName;               // current file name
     Bool_t        fMCFileChecked;                 // vector with MC file names which are broken
+    vector<Int_t> fAODTrackIndexPos;              //! position of the first AOD track with each non-negative ID in the current event, -1 if none
+    vector<Int_t> fAODTrackIndexNeg;              //! same for the negative IDs, stored at -ID-1
+    Bool_t        fAODTrackIndexBuilt;            //! lookup tables filled for the current event
     
   private:
     AliV0ReaderV1(AliV0ReaderV1 &original);
     AliV0ReaderV1 &operator=(const AliV0ReaderV1 &ref);
 
-    ClassDef(AliV0ReaderV1, 14)
+    ClassDef(AliV0ReaderV1, 15)
 
 };
 
@@ -26,6 +26,7 @@
 /////////////////////////////////////////////////////////////
 
 #include <Riostream.h>
+#include <vector>
 #include <TClonesArray.h>
 #include <TCanvas.h>
 #include <TList.h>
@@ -79,6 +80,7 @@ AliAnalysisTaskSESignificance::AliAnalysisTaskSESignificance():
   fAODProtection(1),
   fReadMC(kFALSE),
   fUseSelBit(kFALSE),
+  fFillSingleCell(kFALSE),
   fBFeedDown(kBoth),
   fDecChannel(0),
   fPDGmother(0),
@@ -119,6 +121,7 @@ AliAnalysisTaskSESignificance::AliAnalysisTaskSESignificance(const char *name, T
   fAODProtection(1),
   fReadMC(kFALSE),
   fUseSelBit(kFALSE),
+  fFillSingleCell(kFALSE),
   fBFeedDown(kBoth),
   fDecChannel(decaychannel),
   fPDGmother(0),
@@ -425,7 +428,7 @@ void AliAnalysisTaskSESignificance::UserCreateOutputObjects()
     }
   }
 
-  fHistNEvents=new TH1F("fHistNEvents","Number of AODs scanned",8,-0.5,7.5);
+  fHistNEvents=new TH1F("fHistNEvents","Number of AODs scanned",10,-0.5,9.5);
   fHistNEvents->GetXaxis()->SetBinLabel(1,"nEventsAnal");
   fHistNEvents->GetXaxis()->SetBinLabel(2,"nEvSelected (vtx)");
   fHistNEvents->GetXaxis()->SetBinLabel(3,"nCandidatesSelected");
@@ -438,6 +441,8 @@ void AliAnalysisTaskSESignificance::UserCreateOutputObjects()
   } else{
     fHistNEvents->GetXaxis()->SetBinLabel(7,"N candidates");
   }
+  fHistNEvents->GetXaxis()->SetBinLabel(9,"nTotEntries Mass hists (single cell)");
+  fHistNEvents->GetXaxis()->SetBinLabel(10,"Mass hists integrated");
   fHistNEvents->GetXaxis()->SetNdivisions(1,kFALSE);
   fOutput->Add(fHistNEvents);
 
@@ -608,7 +613,8 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
       TString mdvname=Form("multiDimVectorPtBin%d",ptbin);
       AliMultiDimVector* muvec=(AliMultiDimVector*)fCutList->FindObject(mdvname.Data());
 
-      ULong64_t *addresses = muvec->GetGlobalAddressesAboveCuts(fVars,(Float_t)d->Pt(),nVals);
+      ULong64_t *addresses = fFillSingleCell ? muvec->GetGlobalAddressOfCell(fVars,(Float_t)d->Pt(),nVals) :
+                                               muvec->GetGlobalAddressesAboveCuts(fVars,(Float_t)d->Pt(),nVals);
       if(fDebug>1)printf("nvals = %d\n",nVals);
       for(Int_t ivals=0;ivals<nVals;ivals++){
 	if(addresses[ivals]>=muvec->GetNTotCells()){
@@ -617,7 +623,8 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
 	  return;
 	}
 	
-	fHistNEvents->Fill(3);
+	// with single-cell filling the entries are counted separately, as they are not those of the final histograms
+	fHistNEvents->Fill(fFillSingleCell ? 8 : 3);
 	
 	//fill the histograms with the appropriate method
 	switch (fDecChannel){
@@ -652,7 +659,8 @@ void AliAnalysisTaskSESignificance::UserExec(Option_t */*option*/)
 	nVals=0;
 	fRDCuts->GetCutVarsForOpt(d,fVars,fNVars,fPDGdaughters,aod);
 	delete [] addresses;
-	addresses = muvec->GetGlobalAddressesAboveCuts(fVars,(Float_t)d->Pt(),nVals);
+	addresses = fFillSingleCell ? muvec->GetGlobalAddressOfCell(fVars,(Float_t)d->Pt(),nVals) :
+	                              muvec->GetGlobalAddressesAboveCuts(fVars,(Float_t)d->Pt(),nVals);
 	if(fDebug>1)printf("nvals = %d\n",nVals);
 	for(Int_t ivals=0;ivals<nVals;ivals++){
 	  if(addresses[ivals]>=muvec->GetNTotCells()){
@@ -980,6 +988,8 @@ void AliAnalysisTaskSESignificance::Terminate(Option_t */*option*/)
     fCutList->ls();
     return;
   }
+  if(fFillSingleCell) IntegrateCellHistos();
+
   Int_t nHist=mdvtmp->GetNTotCells();
   TCanvas *c1=new TCanvas("c1","Invariant mass distribution - loose cuts",500,500);
   Bool_t drawn=kFALSE;
@@ -1017,6 +1027,67 @@ void AliAnalysisTaskSESignificance::Terminate(Option_t */*option*/)
   return;
 }
 //_________________________________________________________________________________________________
+void AliAnalysisTaskSESignificance::IntegrateCellHistos(){
+  //
+  // When the candidates are filled only in the histograms of their own cell 
+  // (SetFillSingleCell), sum to each histogram those of the cells with tighter
+  // cuts, so that each of them contains the candidates passing its cuts as with
+  // the default filling. The sum is done as a sequence of cumulative sums, one per
+  // cut variable (see AliMultiDimVector::Integrate)
+  //
+  // The integration is done only once: the last bin of fHistNEvents marks integrated
+  // histograms, e.g. if Terminate is run again on the output
+  TH1F* hNEvents=dynamic_cast<TH1F*>(fOutput->FindObject("fHistNEvents"));
+  if(!hNEvents || hNEvents->GetNbinsX()<10){
+    printf("ERROR: fHistNEvents not available, cannot check if the mass histograms are already integrated\n");
+    return;
+  }
+  if(hNEvents->GetBinContent(10)>0){
+    printf("Mass histograms already integrated, skipping\n");
+    return;
+  }
+
+  Int_t nHistpermv=((AliMultiDimVector*)fCutList->FindObject("multiDimVectorPtBin0"))->GetNTotCells();
+  Int_t nHist=nHistpermv*fNPtBins;
+  const Int_t nTypes=4;
+  const char* prefix[nTypes]={"hMass_","hSig_","hBkg_","hRfl_"};
+  std::vector<TH1F*> histos[nTypes];
+  for(Int_t itype=0;itype<nTypes;itype++) histos[itype].assign(nHist,(TH1F*)0x0);
+
+  // look up the histograms in one pass over the output list
+  TIter next(fOutput);
+  TObject* obj=0x0;
+  while((obj=next())){
+    TString name=obj->GetName();
+    for(Int_t itype=0;itype<nTypes;itype++){
+      if(!name.BeginsWith(prefix[itype])) continue;
+      TString num=name(strlen(prefix[itype]),name.Length());
+      if(!num.IsDigit()) continue;
+      Int_t ih=num.Atoi();
+      if(ih<nHist) histos[itype][ih]=dynamic_cast<TH1F*>(obj);
+    }
+  }
+
+  for(Int_t ptbin=0;ptbin<fNPtBins;ptbin++){
+    TString mdvname=Form("multiDimVectorPtBin%d",ptbin);
+    AliMultiDimVector* muvec=(AliMultiDimVector*)fCutList->FindObject(mdvname.Data());
+    if(!muvec) continue;
+    for(Int_t iVar=0;iVar<muvec->GetNVariables();iVar++){
+      for(ULong64_t i=muvec->GetNTotCells();i>0;i--){
+	ULong64_t nextCell=muvec->GetNextCellAddress(i-1,iVar);
+	if(nextCell>=muvec->GetNTotCells()) continue;
+	Int_t ih=(Int_t)(ptbin*nHistpermv+i-1);
+	Int_t ihNext=(Int_t)(ptbin*nHistpermv+nextCell);
+	if(ihNext>=nHist) continue;
+	for(Int_t itype=0;itype<nTypes;itype++){
+	  if(histos[itype][ih] && histos[itype][ihNext]) histos[itype][ih]->Add(histos[itype][ihNext]);
+	}
+      }
+    }
+  }
+  hNEvents->SetBinContent(10,1);
+}
+//_________________________________________________________________________________________________
 Int_t AliAnalysisTaskSESignificance::CheckOrigin(const AliAODMCParticle* mcPart, const TClonesArray* mcArray)const{
 
 	//
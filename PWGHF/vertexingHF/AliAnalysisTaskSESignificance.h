@@ -46,6 +46,7 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   void SetDsChannel(Int_t chan){fDsChannel=chan;}
   void SetUseSelBit(Bool_t selBit=kTRUE){fUseSelBit=selBit;}
   void SetAODMismatchProtection(Int_t opt=1) {fAODProtection=opt;}
+  void SetFillSingleCell(Bool_t opt=kTRUE) {fFillSingleCell=opt;}
 
   //void SetMultiVector(const AliMultiDimVector *MultiDimVec){fMultiDimVec->CopyStructure(MultiDimVec);}
   Float_t GetUpperMassLimit()const {return fUpmasslimit;}
@@ -55,6 +56,7 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   Int_t GetBFeedDown()const {return fBFeedDown;}
   Int_t GetDsChannel()const {return fDsChannel;}
   Bool_t GetUseSelBit()const {return fUseSelBit;}
+  Bool_t GetFillSingleCell()const {return fFillSingleCell;}
 
   /// Implementation of interface methods
   virtual void UserCreateOutputObjects();
@@ -85,6 +87,7 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   Int_t GetBackgroundHistoIndex(Int_t iPtBin) const { return iPtBin*3+2;}
   Int_t GetLSHistoIndex(Int_t iPtBin)const { return iPtBin*5;}
   Int_t CheckOrigin(const AliAODMCParticle* mcPart, const TClonesArray* mcArray) const;
+  void IntegrateCellHistos();
 
   void FillDplus(AliAODRecoDecayHF* d,TClonesArray *arrayMC,Int_t index,Int_t isSel);
   void FillD02p(AliAODRecoDecayHF* d,TClonesArray *arrayMC,Int_t index, Int_t isSel);
@@ -115,6 +118,7 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
                          /// -1: no protection,  0: check AOD/dAOD nEvents only,  1: check AOD/dAOD nEvents + TProcessID names
   Bool_t fReadMC;    /// flag for access to MC
   Bool_t fUseSelBit;    /// flag to use selection bit (speed up candidates selection)
+  Bool_t fFillSingleCell; /// flag to fill only the cell of the candidate and integrate the histograms in Terminate
   FeedDownEnum fBFeedDown; /// flag to search for D from B decays
   Int_t fDecChannel; /// decay channel identifier
   Int_t fPDGmother;  /// PDG code of D meson
@@ -131,7 +135,7 @@ class AliAnalysisTaskSESignificance : public AliAnalysisTaskSE
   Int_t fPDGD0ToKpi[2];    /// PDG codes for the particles in the D0 -> K + pi decay
 
   /// \cond CLASSIMP    
-  ClassDef(AliAnalysisTaskSESignificance,6); /// AliAnalysisTaskSE for the MC association of heavy-flavour decay candidates
+  ClassDef(AliAnalysisTaskSESignificance,7); /// AliAnalysisTaskSE for the MC association of heavy-flavour decay candidates
   /// \endcond
 };
 
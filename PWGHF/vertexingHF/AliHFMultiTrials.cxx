@@ -65,6 +65,9 @@ AliHFMultiTrials::AliHFMultiTrials() :
   fUseFixSigFixMean(kTRUE),
   fSaveBkgVal(kFALSE),
   fDrawIndividualFits(kFALSE),
+  fUseWarmStart(kFALSE),
+  fTrialPart(0),
+  fNumOfTrialParts(1),
   fHistoRawYieldDistAll(0x0),
   fHistoRawYieldTrialAll(0x0),
   fHistoSigmaTrialAll(0x0),
@@ -199,9 +202,33 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
   fMaxYieldGlob=0.;
   Float_t xnt[15];
 
+  // mean and sigma of the fit with the previous mass range of the same histogram,
+  // for each background/signal configuration (-1 if that fit failed),
+  // used as starting values of the next fit
+  const Int_t nCases=kNBkgFuncCases*kNFitConfCases;
+  Double_t warmMean[nCases];
+  Double_t warmSigma[nCases];
+  Int_t trialsPerHisto=fNumOfLowLimFitSteps*fNumOfUpLimFitSteps;
+  // the subsets of trials are contiguous blocks of rebinned histograms, so that all
+  // the fits of a histogram are done in the same job (and warm-started the same way
+  // for any number of subsets) and the merged ntuple keeps the order of the trials
+  Int_t nHistos=fNumOfRebinSteps*fNumOfFirstBinSteps;
+  Int_t firstHisto=fTrialPart*nHistos/fNumOfTrialParts;
+  Int_t lastHisto=(fTrialPart+1)*nHistos/fNumOfTrialParts;
+
   for(Int_t ir=0; ir<fNumOfRebinSteps; ir++){
     Int_t rebin=fRebinSteps[ir];
     for(Int_t iFirstBin=1; iFirstBin<=fNumOfFirstBinSteps; iFirstBin++) {
+      // skip the rebinning if the histogram is not in the requested subset
+      Int_t iHisto=ir*fNumOfFirstBinSteps+iFirstBin-1;
+      if(iHisto<firstHisto || iHisto>=lastHisto){
+        itrial+=trialsPerHisto;
+        continue;
+      }
+      for(Int_t ic=0; ic<nCases; ic++){
+        warmMean[ic]=-1.;
+        warmSigma[ic]=-1.;
+      }
       TH1F* hRebinned=0x0;
       if(fNumOfFirstBinSteps==1) hRebinned=RebinHisto(hInvMassHisto,rebin,-1);
       else hRebinned=RebinHisto(hInvMassHisto,rebin,iFirstBin);
@@ -248,13 +275,19 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
 	      fitter->SetReflectionSigmaFactor(0);
 	      //if D0 Reflection
 	      if(fhTemplRefl){
+		delete fitter;
 		fitter=new AliHFMassFitterVAR(hRebinned,hmin,hmax,1,typeb,2);
 		fitter->SetTemplateReflections((TH1*)fhTemplRefl);
 		fitter->SetFixReflOverS(fFixRefloS,kTRUE);
 	      }
 	      if(fFitOption==1) fitter->SetUseChi2Fit();
-	      fitter->SetInitialGaussianMean(fMassD);
-	      fitter->SetInitialGaussianSigma(fSigmaGausMC);
+	      if(fUseWarmStart && warmSigma[theCase]>0.){
+		fitter->SetInitialGaussianMean(warmMean[theCase]);
+		fitter->SetInitialGaussianSigma(warmSigma[theCase]);
+	      }else{
+		fitter->SetInitialGaussianMean(fMassD);
+		fitter->SetInitialGaussianSigma(fSigmaGausMC);
+	      }
 	      xnt[0]=rebin;
 	      xnt[1]=iFirstBin;
 	      xnt[2]=minMassForFit;
@@ -376,6 +409,8 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
 
 		if(ry<fMinYieldGlob) fMinYieldGlob=ry;
 		if(ry>fMaxYieldGlob) fMaxYieldGlob=ry;
+		warmMean[theCase]=pos;
+		warmSigma[theCase]=sigma;
 		fHistoRawYieldDist[theCase]->Fill(ry);
 		fHistoRawYieldTrial[theCase]->SetBinContent(itrial,ry);
 		fHistoRawYieldTrial[theCase]->SetBinError(itrial,ery);
@@ -412,6 +447,10 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
 		    fHistoRawYieldDistBinC[theCase]->Fill(cnts);
 		  }
 		}
+	      }else{
+		// the next mass range starts from the default values
+		warmMean[theCase]=-1.;
+		warmSigma[theCase]=-1.;
 	      }
 	      delete fitter;
 	      //	    if(typeb>4) delete fB1;
@@ -84,6 +84,20 @@ class AliHFMultiTrials : public TNamed {
 
   void SetDrawIndividualFits(Bool_t opt=kTRUE){fDrawIndividualFits=opt;}
 
+  /// use mean and sigma of the fit with the previous mass range of the same
+  /// histogram, background function and sigma/mean configuration, if it
+  /// succeeded, as initial values of the next one
+  void SetUseWarmStart(Bool_t opt=kTRUE){fUseWarmStart=opt;}
+
+  /// run only the iPart-th of nParts contiguous blocks of rebinned histograms,
+  /// so that the trials can be split among independent jobs and the outputs
+  /// merged with hadd in the order of iPart (trial numbering, histogram binning
+  /// and order of the ntuple rows are the same as for a single job)
+  void SetTrialPartition(Int_t iPart, Int_t nParts){
+    fNumOfTrialParts=nParts>0 ? nParts : 1;
+    fTrialPart=(iPart>=0 && iPart<fNumOfTrialParts) ? iPart : 0;
+  }
+
   Bool_t DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad=0x0);
   void SaveToRoot(TString fileName, TString option="recreate") const;
   void DrawHistos(TCanvas* cry) const;
@@ -144,6 +158,9 @@ class AliHFMultiTrials : public TNamed {
   Bool_t fSaveBkgVal;		/// switch for saving bkg values in nsigma
 
   Bool_t fDrawIndividualFits; /// flag for drawing fits
+  Bool_t fUseWarmStart;       /// flag for initialising each fit from the previous one
+  Int_t fTrialPart;           /// index of the subset of trials to be run
+  Int_t fNumOfTrialParts;     /// number of subsets in which trials are split
 
   TH1F* fHistoRawYieldDistAll;  /// histo with yield from all trials
   TH1F* fHistoRawYieldTrialAll; /// histo with yield from all trials
@@ -176,7 +193,7 @@ class AliHFMultiTrials : public TNamed {
   Double_t fMaxYieldGlob;   /// maximum yield
 
   /// \cond CLASSIMP
-  ClassDef(AliHFMultiTrials,5); /// class for multiple trials of invariant mass fit
+  ClassDef(AliHFMultiTrials,6); /// class for multiple trials of invariant mass fit
   /// \endcond
 };
 
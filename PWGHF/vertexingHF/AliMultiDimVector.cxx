@@ -541,16 +541,51 @@ void  AliMultiDimVector::GetFillRange(Int_t iVar, Int_t iCell, Int_t& minbin, In
 }
 //_____________________________________________________________________________ 
 void AliMultiDimVector::Integrate(){
-  // integrates the matrix
+  // integrates the matrix: each cell gets the sum of the cells with 
+  // tighter or equal cuts (see CountsAboveCell).
+  // The N-dimensional sum is done as a sequence of cumulative sums,
+  // one per variable, starting from the tightest cut step, so that
+  // the matrix is integrated in fNVariables sweeps over the cells
   if(fIsIntegrated){
     AliError("MultiDimVector already integrated");
     return;
   }
-  TArrayF integral(fNTotCells);
-  for(ULong64_t i=0;i<fNTotCells;i++) integral[i]=CountsAboveCell(i);
-  for(ULong64_t i=0;i<fNTotCells;i++) fVett[i]= integral[i];
+  for(Int_t iVar=0;iVar<fNVariables;iVar++){
+    for(ULong64_t i=fNTotCells;i>0;i--){
+      ULong64_t next=GetNextCellAddress(i-1,iVar);
+      if(next<fNTotCells) fVett[i-1]+=fVett[next];
+    }
+  }
   fIsIntegrated=kTRUE;
-}//_____________________________________________________________________________ 
+}
+//_____________________________________________________________________________ 
+ULong64_t AliMultiDimVector::GetNextCellAddress(ULong64_t globadd, Int_t iVar) const{
+  // returns the global address of the cell with the next (tighter) cut step 
+  // for variable iVar and the same indices for the other variables,
+  // fNTotCells if globadd is already at the tightest step
+  if(globadd>=fNTotCells || iVar<0 || iVar>=fNVariables) return fNTotCells;
+  ULong64_t stride=fNPtBins;
+  for(Int_t j=iVar+1;j<fNVariables;j++) stride*=fNCutSteps[j];
+  if((Int_t)((globadd/stride)%fNCutSteps[iVar])>=fNCutSteps[iVar]-1) return fNTotCells;
+  return globadd+stride;
+}
+//_____________________________________________________________________________ 
+ULong64_t* AliMultiDimVector::GetGlobalAddressOfCell(const Float_t *values, Int_t ptbin, Int_t& nVals) const{
+  // same as GetGlobalAddressesAboveCuts, but returns only the address of the cell
+  // corresponding to values: to be used when the matrix (or the histograms
+  // associated to its cells) is filled cell by cell and integrated at the end
+  Int_t ind[fgkMaxNVariables];
+  Bool_t retcode=GetIndicesFromValues(values,ind);
+  if(!retcode){ 
+    nVals=0;
+    return 0x0;
+  }
+  ULong64_t* indexes=new ULong64_t[1];
+  indexes[0]=GetGlobalAddressFromIndices(ind,ptbin);
+  nVals=1;
+  return indexes;
+}
+//_____________________________________________________________________________ 
 ULong64_t* AliMultiDimVector::GetGlobalAddressesAboveCuts(const Float_t *values, Int_t ptbin, Int_t& nVals) const{
   // fills an array with global addresses of cells passing the cuts
 
@@ -78,6 +78,13 @@ class AliMultiDimVector :  public TNamed{
     else return 0x0;
   }
   ULong64_t* GetGlobalAddressesAboveCuts(const Float_t *values, Int_t ptbin, Int_t& nVals) const;
+  ULong64_t* GetGlobalAddressOfCell(const Float_t *values, Float_t pt, Int_t& nVals) const{
+    Int_t theBin=GetPtBin(pt);
+    if(theBin>=0) return GetGlobalAddressOfCell(values,theBin,nVals);
+    else return 0x0;
+  }
+  ULong64_t* GetGlobalAddressOfCell(const Float_t *values, Int_t ptbin, Int_t& nVals) const;
+  ULong64_t GetNextCellAddress(ULong64_t globadd, Int_t iVar) const;
   Bool_t    GetGreaterThan(Int_t iVar) const {return fGreaterThan[iVar];}
 
   void SetElement(ULong64_t globadd,Float_t val) {fVett[globadd]=val;}
@@ -38,6 +38,7 @@
 #include <TObjArray.h>
 #include <TString.h>
 #include <TCanvas.h>
+#include <TBuffer.h>
 #include <AliPhysicsSelection.h>
 #include <AliMultiplicity.h>
 
@@ -45,6 +46,11 @@
 ClassImp(AliNormalizationCounter);
 /// \endcond
 
+const char *AliNormalizationCounter::fgkCandleNames[AliNormalizationCounter::kNCandles]={
+  "triggered","V0AND","PileUp","PbPbC0SMH-B-NOPF-ALLNOTRD","Candles0.3","PrimaryV","countForNorm","noPrimaryV",
+  "zvtxGT10","!V0A&Candle03","!V0A&PrimaryV","Candid(Filter)","Candid(Analysis)","NCandid(Filter)","NCandid(Analysis)"
+};
+
 //____________________________________________
 AliNormalizationCounter::AliNormalizationCounter(): 
 TNamed(),
@@ -57,7 +63,15 @@ fSpherocitySteps(100.),
 fHistTrackFilterEvMult(0),
 fHistTrackAnaEvMult(0),
 fHistTrackFilterSpdMult(0),
-fHistTrackAnaSpdMult(0)
+fHistTrackAnaSpdMult(0),
+fFastCounting(kFALSE),
+fBufferRun(-1),
+fBufferNSphSlots(1),
+fBufferSlotIndex(),
+fBufferMult(),
+fBufferSph(),
+fBufferHasSph(),
+fBufferCounts()
 {
   // empty constructor
 }
@@ -74,7 +88,15 @@ fSpherocitySteps(100.),
 fHistTrackFilterEvMult(0),
 fHistTrackAnaEvMult(0),
 fHistTrackFilterSpdMult(0),
-fHistTrackAnaSpdMult(0)
+fHistTrackAnaSpdMult(0),
+fFastCounting(kFALSE),
+fBufferRun(-1),
+fBufferNSphSlots(1),
+fBufferSlotIndex(),
+fBufferMult(),
+fBufferSph(),
+fBufferHasSph(),
+fBufferCounts()
 {
   ;
 }
@@ -148,6 +170,8 @@ Long64_t AliNormalizationCounter::Merge(TCollection* list){
 }
 //_______________________________________
 void AliNormalizationCounter::Add(const AliNormalizationCounter *norm){
+  FlushCounters();
+  const_cast<AliNormalizationCounter*>(norm)->FlushCounters();
   fCounters.Add(&(norm->fCounters));
   fHistTrackFilterEvMult->Add(norm->fHistTrackFilterEvMult);
   fHistTrackAnaEvMult->Add(norm->fHistTrackAnaEvMult);
@@ -186,7 +210,7 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   //event must be either physics or MC
   if(!(event->GetEventType() == 7||event->GetEventType() == 0))return;
   
-  FillCounters("triggered",runNumber,multiplicity,spherocity);
+  FillCounters(kTriggered,runNumber,multiplicity,spherocity);
 
   //Find V0AND
   AliTriggerAnalysis trAn; /// Trigger Analysis
@@ -197,7 +221,7 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
     v0B = trAn.IsOfflineTriggerFired(eventESD , AliTriggerAnalysis::kV0C);
     v0A = trAn.IsOfflineTriggerFired(eventESD , AliTriggerAnalysis::kV0A);
   }
-  if(v0A&&v0B) FillCounters("V0AND",runNumber,multiplicity,spherocity);
+  if(v0A&&v0B) FillCounters(kV0AND,runNumber,multiplicity,spherocity);
   
   //FindPrimary vertex  
   // AliVVertex *vtrc =  (AliVVertex*)event->GetPrimaryVertex();
@@ -210,30 +234,30 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   AliAODEvent *eventAOD = (AliAODEvent*)event;
   TString trigclass=eventAOD->GetFiredTriggerClasses();
   if(trigclass.Contains("C0SMH-B-NOPF-ALLNOTRD")||trigclass.Contains("C0SMH-B-NOPF-ALL")){
-    FillCounters("PbPbC0SMH-B-NOPF-ALLNOTRD",runNumber,multiplicity,spherocity);
+    FillCounters(kPbPbC0SMH,runNumber,multiplicity,spherocity);
   }
 
   //FindPrimary vertex  
   if(isEventSelected){
-    FillCounters("PrimaryV",runNumber,multiplicity,spherocity);
+    FillCounters(kPrimaryV,runNumber,multiplicity,spherocity);
     flagPV=kTRUE;
   }else{
     if(rdCut->GetWhyRejection()==0){
-      FillCounters("noPrimaryV",runNumber,multiplicity,spherocity);
+      FillCounters(kNoPrimaryV,runNumber,multiplicity,spherocity);
     }
     //find good vtx outside range
     if(rdCut->GetWhyRejection()==6){
-      FillCounters("zvtxGT10",runNumber,multiplicity,spherocity);
-      FillCounters("PrimaryV",runNumber,multiplicity,spherocity);
+      FillCounters(kZvtxGT10,runNumber,multiplicity,spherocity);
+      FillCounters(kPrimaryV,runNumber,multiplicity,spherocity);
       flagPV=kTRUE;
     }
     if(rdCut->GetWhyRejection()==1){
-      FillCounters("PileUp",runNumber,multiplicity,spherocity);
+      FillCounters(kPileUp,runNumber,multiplicity,spherocity);
     }
   }
   //to be counted for normalization
   if(rdCut->CountEventForNormalization()){
-    FillCounters("countForNorm",runNumber,multiplicity,spherocity);
+    FillCounters(kCountForNorm,runNumber,multiplicity,spherocity);
   }
 
 
@@ -242,17 +266,17 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   for(Int_t i=0;i<trkEntries&&!flag03;i++){
     AliAODTrack *track=(AliAODTrack*)event->GetTrack(i);
     if((track->Pt()>0.3)&&(!flag03)){
-      FillCounters("Candles0.3",runNumber,multiplicity,spherocity);
+      FillCounters(kCandles03,runNumber,multiplicity,spherocity);
       flag03=kTRUE;
       break;
     }
   }
   
   if(!(v0A&&v0B)&&(flag03)){ 
-    FillCounters("!V0A&Candle03",runNumber,multiplicity,spherocity);
+    FillCounters(kNoV0ACandle03,runNumber,multiplicity,spherocity);
   }
   if(!(v0A&&v0B)&&flagPV){
-    FillCounters("!V0A&PrimaryV",runNumber,multiplicity,spherocity);
+    FillCounters(kNoV0APrimaryV,runNumber,multiplicity,spherocity);
   }
   
   return;
@@ -280,6 +304,15 @@ void AliNormalizationCounter::StoreCandidates(AliVEvent *event,Int_t nCand,Bool_
   Int_t runNumber = event->GetRunNumber();
   Int_t multiplicity = Multiplicity(event);
   if(nCand==0)return;
+  if(fFastCounting){
+    // same keys as below (multiplicity only, no spherocity)
+    Int_t slot=GetBufferSlot(runNumber,multiplicity,kFALSE,0);
+    if(slot>=0){
+      fBufferCounts[slot*kNCandles+(flagFilter ? kCandidFilter : kCandidAnalysis)]++;
+      fBufferCounts[slot*kNCandles+(flagFilter ? kNCandidFilter : kNCandidAnalysis)]+=nCand;
+      return;
+    }
+  }
   if(flagFilter){
     if(fMultiplicity) 
       fCounters.Count(Form("Event:Candid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
@@ -308,6 +341,7 @@ void AliNormalizationCounter::StoreCandidates(AliVEvent *event,Int_t nCand,Bool_
 //_______________________________________________________________________
 TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
   //
+  FlushCounters();
   fCounters.SortRubric("Run");
   TString selection;
   selection.Form("event:%s",candle.Data());
@@ -320,6 +354,7 @@ TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
   //
+  FlushCounters();
   fCounters.SortRubric("Run");
   TString name;
 
@@ -337,10 +372,12 @@ TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
 }
 //___________________________________________________________________________
 void AliNormalizationCounter::PrintRubrics(){
+  FlushCounters();
   fCounters.PrintKeyWords();
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetSum(TString candle){
+  FlushCounters();
   TString selection="event:";
   selection.Append(candle);
   return fCounters.GetSum(selection.Data());
@@ -372,6 +409,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(){
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t runnumber){
+  FlushCounters();
   TString listofruns = fCounters.GetKeyWords("RUN");
   if(!listofruns.Contains(Form("%d",runnumber))){
     printf("WARNING: %d is not a valid run number\n",runnumber);
@@ -389,6 +427,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t runnumber){
 
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t maxmultiplicity){
+  FlushCounters();
 
   if(!fMultiplicity) {
     AliInfo("Sorry, you didn't activate the multiplicity in the counter!");
@@ -420,6 +459,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t maxmultiplicity, Double_t minspherocity, Double_t maxspherocity){
+  FlushCounters();
 
   if(!fMultiplicity || !fSpherocity) {
     AliInfo("You must activate both multiplicity and spherocity in the counters to use this method!");
@@ -461,6 +501,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
 
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNormSpheroOnly(Double_t minspherocity, Double_t maxspherocity){
+  FlushCounters();
 
   if(!fSpherocity) {
     AliInfo("Sorry, you didn't activate the sphericity in the counter!");
@@ -497,6 +538,7 @@ Double_t AliNormalizationCounter::GetNEventsForNormSpheroOnly(Double_t minsphero
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, Int_t maxmultiplicity){
   // counts events of given type in a given multiplicity range
+  FlushCounters();
 
   if(!fMultiplicity) {
     AliInfo("Sorry, you didn't activate the multiplicity in the counter!");
@@ -521,6 +563,7 @@ Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, I
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawNEventsForNorm(Bool_t drawRatio){
   //usare algebra histos
+  FlushCounters();
   fCounters.SortRubric("Run");
   TString selection;
 
@@ -575,17 +618,95 @@ Int_t AliNormalizationCounter::Multiplicity(AliVEvent* event){
 }
 
 //___________________________________________________________________________
-void AliNormalizationCounter::FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity){
+void AliNormalizationCounter::FillCounters(Int_t candle, Int_t runNumber, Int_t multiplicity, Double_t spherocity){
 
 
   Int_t sphToInteger=spherocity*fSpherocitySteps;
+  if(fFastCounting){
+    Int_t slot=GetBufferSlot(runNumber,multiplicity,fSpherocity,sphToInteger);
+    if(slot>=0){
+      fBufferCounts[slot*kNCandles+candle]++;
+      return;
+    }
+  }
+  const char *name=fgkCandleNames[candle];
   if(fMultiplicity  && !fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d",name.Data(),runNumber,multiplicity));
+    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d",name,runNumber,multiplicity));
   else if(fMultiplicity  && fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d/Spherocity:%d",name.Data(),runNumber,multiplicity,sphToInteger));
+    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d/Spherocity:%d",name,runNumber,multiplicity,sphToInteger));
   else if(!fMultiplicity  && fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Spherocity:%d",name.Data(),runNumber,sphToInteger));
+    fCounters.Count(Form("Event:%s/Run:%d/Spherocity:%d",name,runNumber,sphToInteger));
   else 
-    fCounters.Count(Form("Event:%s/Run:%d",name.Data(),runNumber));
+    fCounters.Count(Form("Event:%s/Run:%d",name,runNumber));
   return;
 }
+
+//___________________________________________________________________________
+Int_t AliNormalizationCounter::GetBufferSlot(Int_t runNumber, Int_t multiplicity, Bool_t withSpherocity, Int_t spherocity){
+  // slot of the (multiplicity, spherocity) combination in the counts of the current run,
+  // looked up in a flat array indexed by multiplicity and spherocity;
+  // -1 for a multiplicity outside [0, kMaxBufferMultiplicity) or a spherocity outside
+  // [0, fSpherocitySteps], which are counted in fCounters directly
+  // the counts of the previous run are moved to fCounters when the run changes
+  if(runNumber!=fBufferRun){
+    FlushCounters();
+    fBufferRun=runNumber;
+    fBufferNSphSlots=fSpherocity ? (Int_t)fSpherocitySteps+2 : 1;
+  }
+  // the conversion to unsigned maps negative values above the limits
+  UInt_t mult=fMultiplicity ? (UInt_t)multiplicity : 0;
+  if(mult>=(UInt_t)kMaxBufferMultiplicity) return -1;
+  UInt_t sph=0;
+  if(withSpherocity){
+    sph=(UInt_t)spherocity;
+    if(sph>=(UInt_t)(fBufferNSphSlots-1)) return -1;
+    sph++;
+  }
+  UInt_t index=mult*fBufferNSphSlots+sph;
+  if(index>=fBufferSlotIndex.size()) fBufferSlotIndex.resize((mult+1)*fBufferNSphSlots,-1);
+  Int_t slot=fBufferSlotIndex[index];
+  if(slot<0){
+    slot=fBufferMult.size();
+    fBufferSlotIndex[index]=slot;
+    fBufferMult.push_back(multiplicity);
+    fBufferSph.push_back(spherocity);
+    fBufferHasSph.push_back(withSpherocity);
+    fBufferCounts.resize(fBufferCounts.size()+kNCandles,0);
+  }
+  return slot;
+}
+
+//___________________________________________________________________________
+void AliNormalizationCounter::FlushCounters(){
+  // move the counts of the current run to fCounters, with one Count per key
+  // combinations in order of first use, to add the integer keys to the rubrics in the same order
+  if(fBufferRun<0) return;
+  for(UInt_t slot=0; slot<fBufferMult.size(); slot++){
+    for(Int_t candle=0; candle<kNCandles; candle++){
+      Long64_t n=fBufferCounts[slot*kNCandles+candle];
+      if(n<=0) continue;
+      TString key=Form("Event:%s/Run:%d",fgkCandleNames[candle],fBufferRun);
+      if(fMultiplicity) key+=Form("/Multiplicity:%d",fBufferMult[slot]);
+      if(fBufferHasSph[slot]) key+=Form("/Spherocity:%d",fBufferSph[slot]);
+      fCounters.Count(key,(Int_t)n);
+    }
+  }
+  fBufferRun=-1;
+  fBufferSlotIndex.clear();
+  fBufferMult.clear();
+  fBufferSph.clear();
+  fBufferHasSph.clear();
+  fBufferCounts.clear();
+}
+
+//___________________________________________________________________________
+void AliNormalizationCounter::Streamer(TBuffer &R__b){
+  // Stream an object of class AliNormalizationCounter,
+  // counts buffered by the fast counting are moved to fCounters before writing
+  if(R__b.IsReading()){
+    AliNormalizationCounter::Class()->ReadBuffer(R__b,this);
+  }else{
+    FlushCounters();
+    AliNormalizationCounter::Class()->WriteBuffer(R__b,this);
+  }
+}
@@ -27,6 +27,7 @@
 /// with many thanks to P. Pillot
 /////////////////////////////////////////////////////////////
 
+#include <vector>
 #include <TROOT.h>
 #include <TSystem.h>
 #include <TNtuple.h>
@@ -54,13 +55,17 @@ class AliNormalizationCounter : public TNamed
   virtual ~AliNormalizationCounter();
   Long64_t Merge(TCollection* list);
 
-  AliCounterCollection* GetCounter(){return &fCounters;}
+  AliCounterCollection* GetCounter(){FlushCounters(); return &fCounters;}
   void Init();
   void Add(const AliNormalizationCounter*);
   void SetESD(Bool_t flag){fESD=flag;}
   void SetStudyMultiplicity(Bool_t flag, Float_t etaRange){ fMultiplicity=flag; fMultiplicityEtaRange=etaRange; }
   void SetStudySpherocity(Bool_t flag, Double_t nsteps=100.){fSpherocity=flag;
     fSpherocitySteps=nsteps;}
+  /// count in integer-keyed buffers of the current run, moved to the AliCounterCollection
+  /// (one Count per key combination) when the run changes and before reading/writing the counters
+  void SetFastCounting(Bool_t flag=kTRUE){fFastCounting=flag;}
+  void FlushCounters();
   void StoreEvent(AliVEvent*,AliRDHFCuts *,Bool_t mc=kFALSE, Int_t multiplicity=-9999, Double_t spherocity=-99.);
   void StoreCandidates(AliVEvent*, Int_t nCand=0,Bool_t flagFilter=kTRUE);
   TH1D* DrawAgainstRuns(TString candle="candid(filter)",Bool_t drawHist=kTRUE);
@@ -83,7 +88,13 @@ class AliNormalizationCounter : public TNamed
   AliNormalizationCounter(const AliNormalizationCounter &source);
   AliNormalizationCounter& operator=(const AliNormalizationCounter& source);
   Int_t Multiplicity(AliVEvent* event);
-  void FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity);
+  /// keys of the Event rubric
+  enum ECandle {kTriggered, kV0AND, kPileUp, kPbPbC0SMH, kCandles03, kPrimaryV, kCountForNorm, kNoPrimaryV,
+		kZvtxGT10, kNoV0ACandle03, kNoV0APrimaryV, kCandidFilter, kCandidAnalysis, kNCandidFilter, kNCandidAnalysis, kNCandles};
+  static const char *fgkCandleNames[kNCandles]; /// names of the Event rubric keys
+  enum {kMaxBufferMultiplicity=20000}; /// multiplicities counted in the buffers: [0, kMaxBufferMultiplicity)
+  void FillCounters(Int_t candle, Int_t runNumber, Int_t multiplicity, Double_t spherocity);
+  Int_t GetBufferSlot(Int_t runNumber, Int_t multiplicity, Bool_t withSpherocity, Int_t spherocity);
 
 
   AliCounterCollection fCounters; /// internal counter
@@ -96,9 +107,17 @@ class AliNormalizationCounter : public TNamed
   TH2F *fHistTrackAnaEvMult;/// hist to store no of analysis candidates vs no of tracks in the event
   TH2F *fHistTrackFilterSpdMult; /// hist to store no of filter candidates vs  SPD multiplicity
   TH2F *fHistTrackAnaSpdMult;/// hist to store no of analysis candidates vs SPD multiplicity 
+  Bool_t fFastCounting; /// flag for counting in the integer-keyed buffers
+  Int_t fBufferRun; //! run of the buffered counts (-1: none)
+  Int_t fBufferNSphSlots; //! spherocity slots per multiplicity in fBufferSlotIndex (slot 0: no spherocity)
+  std::vector<Int_t> fBufferSlotIndex; //! slot of each (multiplicity, spherocity slot) of the run (-1: none)
+  std::vector<Int_t> fBufferMult; //! multiplicity of each slot
+  std::vector<Int_t> fBufferSph; //! spherocity (integer) of each slot
+  std::vector<Bool_t> fBufferHasSph; //! spherocity included in the key of each slot
+  std::vector<Long64_t> fBufferCounts; //! counts per slot and Event key
 
   /// \cond CLASSIMP    
-  ClassDef(AliNormalizationCounter,7);
+  ClassDef(AliNormalizationCounter,8);
   /// \endcond
 };
 #endif
@@ -22,6 +22,7 @@
 // Author: A.Dainese, andrea.dainese@pd.infn.it
 /////////////////////////////////////////////////////////////
 #include <Riostream.h>
+#include <algorithm>
 
 #include "AliVEvent.h"
 #include "AliESDEvent.h"
@@ -1258,16 +1259,15 @@ void AliRDHFCuts::GetVarPtIndex(Int_t iGlob, Int_t& iVar, Int_t& iPtBin) const {
 Int_t AliRDHFCuts::PtBin(Double_t pt) const {
   //
   //give the pt bin where the pt lies.
+  //the limits are sorted, so the bin is found with a binary search:
+  //upper_bound returns the first limit above pt, i.e. limit i+1 of bin i
   //
-  Int_t ptbin=-1;
-  if(pt<fPtBinLimits[0])return ptbin;
-  for (Int_t i=0;i<fnPtBins;i++){
-    if(pt<fPtBinLimits[i+1]) {
-      ptbin=i;
-      break;
-    }
-  }
-  return ptbin;
+  if(fnPtBins<=0 || !fPtBinLimits) return -1;
+  const Float_t *first=fPtBinLimits;
+  const Float_t *last=fPtBinLimits+fnPtBins+1;
+  Int_t idx=std::upper_bound(first,last,pt)-first;
+  if(idx==0 || idx>fnPtBins) return -1; // below the first, above the last limit, or NaN
+  return idx-1;
 }
 //-------------------------------------------------------------------
 Float_t AliRDHFCuts::GetCutValue(Int_t iVar,Int_t iPtBin) const {
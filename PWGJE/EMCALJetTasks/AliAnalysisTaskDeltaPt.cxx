@@ -21,6 +21,7 @@
 #include "AliJetContainer.h"
 #include "AliParticleContainer.h"
 #include "AliClusterContainer.h"
+#include "AliJetConeSumGrid.h"
 
 #include "AliAnalysisTaskDeltaPt.h"
 
@@ -37,6 +38,7 @@ AliAnalysisTaskDeltaPt::AliAnalysisTaskDeltaPt() :
   fConeMaxEta(0.9),
   fConeMinPhi(0),
   fConeMaxPhi(TMath::Pi()*2),
+  fUseConeSumGrid(kFALSE),
   fJetsCont(0),
   fTracksCont(0),
   fCaloClustersCont(0),
@@ -45,6 +47,8 @@ AliAnalysisTaskDeltaPt::AliAnalysisTaskDeltaPt() :
   fEmbCaloClustersCont(0),
   fRandTracksCont(0),
   fRandCaloClustersCont(0),
+  fConeSumGrid(0),
+  fRandConeSumGrid(0),
   fHistRhovsCent(0),
   fHistRCPhiEta(0), 
   fHistRCPt(0),
@@ -107,6 +111,7 @@ AliAnalysisTaskDeltaPt::AliAnalysisTaskDeltaPt(const char *name) :
   fConeMaxEta(0.9),
   fConeMinPhi(0),
   fConeMaxPhi(TMath::Pi()*2),
+  fUseConeSumGrid(kFALSE),
   fJetsCont(0),
   fTracksCont(0),
   fCaloClustersCont(0),
@@ -115,6 +120,8 @@ AliAnalysisTaskDeltaPt::AliAnalysisTaskDeltaPt(const char *name) :
   fEmbCaloClustersCont(0),
   fRandTracksCont(0),
   fRandCaloClustersCont(0),
+  fConeSumGrid(0),
+  fRandConeSumGrid(0),
   fHistRhovsCent(0),
   fHistRCPhiEta(0), 
   fHistRCPt(0),
@@ -166,6 +173,15 @@ AliAnalysisTaskDeltaPt::AliAnalysisTaskDeltaPt(const char *name) :
   SetMakeGeneralHistograms(kTRUE);
 }
 
+//________________________________________________________________________
+AliAnalysisTaskDeltaPt::~AliAnalysisTaskDeltaPt()
+{
+  // Destructor.
+
+  delete fConeSumGrid;
+  delete fRandConeSumGrid;
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskDeltaPt::AllocateHistogramArrays()
 {
@@ -450,6 +466,20 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
   Float_t RCeta = 0;
   Float_t RCphi = 0;
 
+  // Eta-phi grids filled once per event, used for all random cones
+  if (fConeSumGrid) {
+    fConeSumGrid->Reset();
+    fConeSumGrid->AddParticles(fTracksCont);
+    fConeSumGrid->AddClusters(fCaloClustersCont, fVertex);
+    fConeSumGrid->Build();
+  }
+  if (fRandConeSumGrid) {
+    fRandConeSumGrid->Reset();
+    fRandConeSumGrid->AddParticles(fRandTracksCont);
+    fRandConeSumGrid->AddClusters(fRandCaloClustersCont, fVertex);
+    fRandConeSumGrid->Build();
+  }
+
   if (fTracksCont || fCaloClustersCont) {
 
     for (Int_t i = 0; i < fRCperEvent; i++) {
@@ -457,7 +487,7 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
       RCpt = 0;
       RCeta = 0;
       RCphi = 0;
-      GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, 0);
+      GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, 0, kFALSE, fConeSumGrid);
       if (RCpt > 0) {
         fHistRCPhiEta->Fill(RCeta, RCphi);
         fHistRhoVSRCPt[fCentBin]->Fill(fJetsCont->GetRhoVal() * rcArea, RCpt);
@@ -479,7 +509,7 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
         RCpt = 0;
         RCeta = 0;
         RCphi = 0;
-        GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, jet);
+        GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, jet, kFALSE, fConeSumGrid);
         if (RCpt > 0) {
           if (jet) {
             Float_t dphi = RCphi - jet->Phi();
@@ -497,7 +527,7 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
           RCpt = 0;
           RCeta = 0;
           RCphi = 0;
-          GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, jet, kTRUE);
+          GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, jet, kTRUE, fConeSumGrid);
 
           if (RCpt > 0) {
             if (jet) {
@@ -519,7 +549,7 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
     RCpt = 0;
     RCeta = 0;
     RCphi = 0;
-    GetRandomCone(RCpt, RCeta, RCphi, fRandTracksCont, fRandCaloClustersCont, 0);
+    GetRandomCone(RCpt, RCeta, RCphi, fRandTracksCont, fRandCaloClustersCont, 0, kFALSE, fRandConeSumGrid);
     if (RCpt > 0) {
       fHistRCPtRand[fCentBin]->Fill(RCpt);
       fHistDeltaPtRCRand[fCentBin]->Fill(RCpt - rcArea * fJetsCont->GetRhoVal());
@@ -584,9 +614,10 @@ AliEmcalJet* AliAnalysisTaskDeltaPt::NextEmbeddedJet(Bool_t reset)
 //________________________________________________________________________
 void AliAnalysisTaskDeltaPt::GetRandomCone(Float_t &pt, Float_t &eta, Float_t &phi,
     AliParticleContainer* tracks, AliClusterContainer* clusters,
-    AliEmcalJet *jet, Bool_t bPartialExclusion) const
+    AliEmcalJet *jet, Bool_t bPartialExclusion, const AliJetConeSumGrid *grid) const
 {
   // Get rigid cone.
+  // If an eta-phi grid of the tracks and clusters is given, the cone pt is taken from it.
 
   eta = -999;
   phi = -999;
@@ -642,6 +673,11 @@ void AliAnalysisTaskDeltaPt::GetRandomCone(Float_t &pt, Float_t &eta, Float_t &p
     return;
   }
 
+  if (grid) {
+    pt = grid->GetConeSum(eta, phi, fConeRadius);
+    return;
+  }
+
   if (clusters) {
     clusters->ResetCurrentID();
     AliVCluster* cluster = clusters->GetNextAcceptCluster();
@@ -731,6 +767,19 @@ void AliAnalysisTaskDeltaPt::ExecOnce()
   if (fMinRC2LJ < 0)
     fMinRC2LJ = fConeRadius * 1.5;
 
+  if (fUseConeSumGrid) {
+    // cells of about a quarter of the cone radius, covering the cone acceptance
+    const Double_t cellSize = fConeRadius / 4;
+    const Double_t minEta = fConeMinEta - fConeRadius;
+    const Double_t maxEta = fConeMaxEta + fConeRadius;
+    const Int_t nEta = TMath::Max(1, TMath::CeilNint((maxEta - minEta) / cellSize));
+    const Int_t nPhi = TMath::Max(1, TMath::CeilNint(TMath::TwoPi() / cellSize));
+    if (!fConeSumGrid && (fTracksCont || fCaloClustersCont))
+      fConeSumGrid = new AliJetConeSumGrid(nEta, minEta, maxEta, nPhi);
+    if (!fRandConeSumGrid && (fRandTracksCont || fRandCaloClustersCont))
+      fRandConeSumGrid = new AliJetConeSumGrid(nEta, minEta, maxEta, nPhi);
+  }
+
   const Float_t maxDist = TMath::Max(fConeMaxPhi - fConeMinPhi, fConeMaxEta - fConeMinEta) / 2;
   if (fMinRC2LJ > maxDist) {
     AliWarning(Form("The parameter fMinRC2LJ = %f is too large for the considered acceptance. "
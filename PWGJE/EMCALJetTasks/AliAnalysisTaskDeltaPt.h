@@ -11,6 +11,7 @@ class TH3;
 class AliJetContainer;
 class AliParticleContainer;
 class AliClusterContainer;
+class AliJetConeSumGrid;
 
 #include "AliAnalysisTaskEmcalJet.h"
 
@@ -19,7 +20,7 @@ class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
 
   AliAnalysisTaskDeltaPt();
   AliAnalysisTaskDeltaPt(const char *name);
-  virtual ~AliAnalysisTaskDeltaPt() {;}
+  virtual ~AliAnalysisTaskDeltaPt();
 
   void                        UserCreateOutputObjects();
 
@@ -31,6 +32,7 @@ class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
   void                        SetConeEtaPhiTPC()   ;
   void                        SetConeEtaLimits(Float_t min, Float_t max)           { fConeMinEta = min, fConeMaxEta = max  ; }
   void                        SetConePhiLimits(Float_t min, Float_t max)           { fConeMinPhi = min, fConeMaxPhi = max  ; }
+  void                        SetUseConeSumGrid(Bool_t b = kTRUE)                  { fUseConeSumGrid          = b          ; }
 
  protected:
   void                        AllocateHistogramArrays()                                                                     ;
@@ -41,7 +43,7 @@ class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
   void                        DoEmbTrackLoop()                                                                              ;
   void                        DoEmbClusterLoop()                                                                            ;
   void                        GetRandomCone(Float_t &pt, Float_t &eta, Float_t &phi, AliParticleContainer* tracks, AliClusterContainer* clusters,
-					    AliEmcalJet *jet = 0, Bool_t bPartialExclusion = 0) const;
+					    AliEmcalJet *jet = 0, Bool_t bPartialExclusion = 0, const AliJetConeSumGrid *grid = 0) const;
   Double_t                    GetNColl() const;
 
 
@@ -53,6 +55,7 @@ class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
   Float_t                     fConeMaxEta;                 // Maximum eta of the random cones
   Float_t                     fConeMinPhi;                 // Minimum phi of the random cones
   Float_t                     fConeMaxPhi;                 // Maximum phi of the random cones
+  Bool_t                      fUseConeSumGrid;             // Get the random cone pt from an eta-phi grid built once per event
 
   AliJetContainer            *fJetsCont;                   //!Jets
   AliParticleContainer       *fTracksCont;                 //!Tracks
@@ -62,6 +65,8 @@ class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
   AliClusterContainer        *fEmbCaloClustersCont;        //!Embedded clusters  
   AliParticleContainer       *fRandTracksCont;             //!Randomized tracks
   AliClusterContainer        *fRandCaloClustersCont;       //!Randomized clusters
+  AliJetConeSumGrid          *fConeSumGrid;                //!Eta-phi grid of tracks and clusters
+  AliJetConeSumGrid          *fRandConeSumGrid;            //!Eta-phi grid of randomized tracks and clusters
 
   // General
   TH2                        *fHistRhovsCent;              //!Rho vs. centrality
@@ -98,6 +103,6 @@ class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
   AliAnalysisTaskDeltaPt(const AliAnalysisTaskDeltaPt&);            // not implemented
   AliAnalysisTaskDeltaPt &operator=(const AliAnalysisTaskDeltaPt&); // not implemented
 
-  ClassDef(AliAnalysisTaskDeltaPt, 5) // deltaPt analysis task
+  ClassDef(AliAnalysisTaskDeltaPt, 6) // deltaPt analysis task
 };
 #endif
@@ -70,6 +70,9 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fTrackEfficiencyOnlyForEmbedding(kFALSE),
   fUtilities(0),
   fLocked(0),
+  fExtraJetAlgos(),
+  fExtraRadii(),
+  fExtraRecombSchemes(),
   fJetsName(),
   fIsInit(0),
   fIsPSelSet(0),
@@ -79,7 +82,9 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fJets(0),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap(),
-  fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask")
+  fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask"),
+  fExtraJets(),
+  fExtraFastJetWrappers()
 {
 }
 
@@ -105,6 +110,9 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fTrackEfficiencyOnlyForEmbedding(kFALSE),
   fUtilities(0),
   fLocked(0),
+  fExtraJetAlgos(),
+  fExtraRadii(),
+  fExtraRecombSchemes(),
   fJetsName(),
   fIsInit(0),
   fIsPSelSet(0),
@@ -114,7 +122,9 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fJets(0),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap(),
-  fFastJetWrapper(name,name)
+  fFastJetWrapper(name,name),
+  fExtraJets(),
+  fExtraFastJetWrappers()
 {
 }
 
@@ -123,6 +133,7 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
  */
 AliEmcalJetTask::~AliEmcalJetTask()
 {
+  for (UInt_t idef = 0; idef < fExtraFastJetWrappers.size(); idef++) delete fExtraFastJetWrappers[idef];
 }
 
 /**
@@ -142,6 +153,27 @@ AliEmcalJetUtility* AliEmcalJetTask::AddUtility(AliEmcalJetUtility* utility)
   return utility;
 }
 
+/**
+ * Add a jet definition to be run on the same input as the main one. The input vectors
+ * are built once per event from the particle and cluster containers of this task and fed to
+ * the FastJet wrapper of each definition, avoiding to repeat the container loops and
+ * acceptance cuts in several jet finder tasks with the same input (e.g. several radii,
+ * or kt jets for the background estimation). Each definition fills its own jet branch,
+ * with the name generated as for the main one, applying the same jet selection
+ * (min pt, area, eta-phi range). The jet utilities are only run for the main definition.
+ * @param algo Jet algorithm
+ * @param radius Jet radius
+ * @param scheme Recombination scheme
+ */
+void AliEmcalJetTask::AddJetDefinition(EJetAlgo_t algo, Double_t radius, ERecoScheme_t scheme)
+{
+  if (IsLocked()) return;
+
+  fExtraJetAlgos.push_back(algo);
+  fExtraRadii.push_back(radius);
+  fExtraRecombSchemes.push_back(scheme);
+}
+
 /**
  * This method is called once before analyzing the first event. It executes
  * the Init() method of all utilities (if any).
@@ -206,13 +238,22 @@ Bool_t AliEmcalJetTask::Run()
   InitEvent();
   // clear the jet array (normally a null operation)
   fJets->Delete();
+  for (UInt_t idef = 0; idef < fExtraJets.size(); idef++) fExtraJets[idef]->Delete();
   Int_t n = FindJets();
 
-  if (n == 0) return kFALSE;
+  if (n > 0) FillJetBranch();
 
-  FillJetBranch();
+  // the additional definitions (different radius or minimum pt) can find jets
+  // even if the main one did not, as long as there were input vectors
+  Bool_t found = (n > 0);
+  if (fFastJetWrapper.GetInputVectors().size() > 0) {
+    for (UInt_t idef = 0; idef < fExtraFastJetWrappers.size(); idef++) {
+      FillJetBranch(*(fExtraFastJetWrappers[idef]), fExtraJets[idef], fExtraRadii[idef], kFALSE);
+      if (fExtraJets[idef]->GetEntriesFast() > 0) found = kTRUE;
+    }
+  }
 
-  return kTRUE;
+  return found;
 }
 
 /**
@@ -224,13 +265,13 @@ Bool_t AliEmcalJetTask::Run()
  */
 Int_t AliEmcalJetTask::FindJets()
 {
+  fFastJetWrapper.Clear();
+
   if (fParticleCollArray.GetEntriesFast() == 0 && fClusterCollArray.GetEntriesFast() == 0){
     AliError("No tracks or clusters, returning.");
     return 0;
   }
 
-  fFastJetWrapper.Clear();
-
   AliDebug(2,Form("Jet type = %d", fJetType));
 
   Int_t iColl = 1;
@@ -277,6 +318,13 @@ Int_t AliEmcalJetTask::FindJets()
   // run jet finder
   fFastJetWrapper.Run();
 
+  // run the additional jet definitions on the same input vectors
+  for (UInt_t idef = 0; idef < fExtraFastJetWrappers.size(); idef++) {
+    fExtraFastJetWrappers[idef]->Clear();
+    fExtraFastJetWrappers[idef]->AddInputVectors(fFastJetWrapper.GetInputVectors());
+    fExtraFastJetWrappers[idef]->Run();
+  }
+
   return fFastJetWrapper.GetInclusiveJets().size();
 }
 
@@ -287,10 +335,22 @@ Int_t AliEmcalJetTask::FindJets()
  */
 void AliEmcalJetTask::FillJetBranch()
 {
-  PrepareUtilities();
+  FillJetBranch(fFastJetWrapper, fJets, fRadius, kTRUE);
+}
+
+/**
+ * This method fills a jet output branch with the jets found by a FastJet wrapper.
+ * @param wrapper FastJet wrapper after jet finding
+ * @param jets Output jet branch
+ * @param radius Jet radius, used for the jet acceptance type
+ * @param doUtilities If kTRUE, the jet utilities are prepared, executed for each jet and terminated
+ */
+void AliEmcalJetTask::FillJetBranch(AliFJWrapper& wrapper, TClonesArray* jets, Double_t radius, Bool_t doUtilities)
+{
+  if (doUtilities) PrepareUtilities();
 
   // loop over fastjet jets
-  std::vector<fastjet::PseudoJet> jets_incl = fFastJetWrapper.GetInclusiveJets();
+  std::vector<fastjet::PseudoJet> jets_incl = wrapper.GetInclusiveJets();
   // sort jets according to jet pt
   static Int_t indexes[9999] = {-1};
   GetSortedArray(indexes, jets_incl);
@@ -298,27 +358,27 @@ void AliEmcalJetTask::FillJetBranch()
   AliDebug(1,Form("%d jets found", (Int_t)jets_incl.size()));
   for (UInt_t ijet = 0, jetCount = 0; ijet < jets_incl.size(); ++ijet) {
     Int_t ij = indexes[ijet];
-    AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), fFastJetWrapper.GetJetArea(ij)));
+    AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), wrapper.GetJetArea(ij)));
 
     if (jets_incl[ij].perp() < fMinJetPt) continue;
-    if (fFastJetWrapper.GetJetArea(ij) < fMinJetArea) continue;
+    if (wrapper.GetJetArea(ij) < fMinJetArea) continue;
     if ((jets_incl[ij].eta() < fJetEtaMin) || (jets_incl[ij].eta() > fJetEtaMax) ||
         (jets_incl[ij].phi() < fJetPhiMin) || (jets_incl[ij].phi() > fJetPhiMax))
       continue;
 
-    AliEmcalJet *jet = new ((*fJets)[jetCount])
+    AliEmcalJet *jet = new ((*jets)[jetCount])
     		          AliEmcalJet(jets_incl[ij].perp(), jets_incl[ij].eta(), jets_incl[ij].phi(), jets_incl[ij].m());
     jet->SetLabel(ij);
 
-    fastjet::PseudoJet area(fFastJetWrapper.GetJetAreaVector(ij));
+    fastjet::PseudoJet area(wrapper.GetJetAreaVector(ij));
     jet->SetArea(area.perp());
     jet->SetAreaEta(area.eta());
     jet->SetAreaPhi(area.phi());
     jet->SetAreaE(area.E());
-    jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), fRadius));
+    jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), radius));
 
     // Fill constituent info
-    std::vector<fastjet::PseudoJet> constituents(fFastJetWrapper.GetJetConstituents(ij));
+    std::vector<fastjet::PseudoJet> constituents(wrapper.GetJetConstituents(ij));
     FillJetConstituents(jet, constituents, constituents);
 
     if (fGeom) {
@@ -329,13 +389,13 @@ void AliEmcalJetTask::FillJetBranch()
         jet->SetAxisInEmcal(kTRUE);
     }
 
-    ExecuteUtilities(jet, ij);
+    if (doUtilities) ExecuteUtilities(jet, ij);
 
     AliDebug(2,Form("Added jet n. %d, pt = %f, area = %f, constituents = %d", jetCount, jet->Pt(), jet->Area(), jet->GetNumberOfConstituents()));
     jetCount++;
   }
 
-  TerminateUtilities();
+  if (doUtilities) TerminateUtilities();
 }
 
 /**
@@ -401,6 +461,31 @@ void AliEmcalJetTask::ExecOnce()
     fFastJetWrapper.SetLegacyMode(kTRUE);
   }
 
+  // setup the additional jet definitions, with the same settings except algorithm, radius and scheme
+  for (UInt_t idef = 0; idef < fExtraRadii.size(); idef++) {
+    EJetAlgo_t algo = static_cast<EJetAlgo_t>(fExtraJetAlgos[idef]);
+    ERecoScheme_t scheme = static_cast<ERecoScheme_t>(fExtraRecombSchemes[idef]);
+    TString jetsName = AliJetContainer::GenerateJetName(fJetType, algo, scheme, fExtraRadii[idef], GetParticleContainer(0), GetClusterContainer(0), fJetsTag);
+
+    if (InputEvent()->FindListObject(jetsName)) {
+      AliError(Form("%s: Object with name %s already in event! Returning", GetName(), jetsName.Data()));
+      return;
+    }
+
+    TClonesArray* jets = new TClonesArray("AliEmcalJet");
+    jets->SetName(jetsName);
+    ::Info("AliEmcalJetTask::ExecOnce", "Jet collection with name '%s' has been added to the event.", jetsName.Data());
+    InputEvent()->AddObject(jets);
+    fExtraJets.push_back(jets);
+
+    AliFJWrapper* wrapper = new AliFJWrapper(jetsName, jetsName);
+    wrapper->CopySettingsFrom(fFastJetWrapper);
+    wrapper->SetR(fExtraRadii[idef]);
+    wrapper->SetAlgorithm(ConvertToFJAlgo(algo));
+    wrapper->SetRecombScheme(ConvertToFJRecoScheme(scheme));
+    fExtraFastJetWrappers.push_back(wrapper);
+  }
+
   InitUtilities();
 
   AliAnalysisTaskEmcal::ExecOnce();
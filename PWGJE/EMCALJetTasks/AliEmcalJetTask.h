@@ -9,6 +9,8 @@ class TObjArray;
 class AliVEvent;
 class AliEmcalJetUtility;
 
+#include <vector>
+
 #include <AliLog.h>
 
 #include "AliAnalysisTaskEmcal.h"
@@ -87,6 +89,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetPhiRange(Double_t pmi, Double_t pma);
 
   AliEmcalJetUtility*    AddUtility(AliEmcalJetUtility* utility);
+  void                   AddJetDefinition(EJetAlgo_t algo, Double_t radius, ERecoScheme_t scheme);
 
   Double_t               GetGhostArea()                   { return fGhostArea         ; }
   const char*            GetJetsName()                    { return fJetsName.Data()   ; }
@@ -107,6 +110,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Bool_t                 GetTrackEfficiencyOnlyForEmbedding() { return fTrackEfficiencyOnlyForEmbedding; }
 
   TClonesArray*          GetJets()                        { return fJets              ; }
+  Int_t                  GetNJetDefinitions()       const { return fExtraRadii.size()   ; }
+  TClonesArray*          GetJets(Int_t idef)              { return idef < 0 ? fJets : fExtraJets.at(idef); }
   TObjArray*             GetUtilities()                   { return fUtilities         ; }
 
   void                   FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet::PseudoJet>& constituents,
@@ -144,6 +149,9 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
 
   Int_t                  FindJets();
   void                   FillJetBranch();
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+  void                   FillJetBranch(AliFJWrapper& wrapper, TClonesArray* jets, Double_t radius, Bool_t doUtilities);
+#endif
   void                   ExecOnce();
   void                   InitEvent();
   void                   InitUtilities();
@@ -173,6 +181,9 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   TObjArray             *fUtilities;              // jet utilities (gen subtractor, constituent subtractor etc.)
   Bool_t                 fTrackEfficiencyOnlyForEmbedding; // Apply aritificial tracking inefficiency only for embedded tracks
   Bool_t                 fLocked;                 // true if lock is set
+  std::vector<Int_t>     fExtraJetAlgos;          // jet algorithms of the additional jet definitions
+  std::vector<Double_t>  fExtraRadii;             // radii of the additional jet definitions
+  std::vector<Int_t>     fExtraRecombSchemes;     // recombination schemes of the additional jet definitions
 
   TString                fJetsName;               //!name of jet collection
   Bool_t                 fIsInit;                 //!=true if already initialized
@@ -183,6 +194,10 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
 
   TClonesArray          *fJets;                   //!jet collection
   AliFJWrapper           fFastJetWrapper;         //!fastjet wrapper
+  std::vector<TClonesArray*> fExtraJets;          //!jet collections of the additional jet definitions
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+  std::vector<AliFJWrapper*> fExtraFastJetWrappers; //!<! fastjet wrappers of the additional jet definitions
+#endif
 
   static const Int_t     fgkConstIndexShift;      //!contituent index shift
 
@@ -197,7 +212,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask &operator=(const AliEmcalJetTask&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTask, 24);
+  ClassDef(AliEmcalJetTask, 25);
   /// \endcond
 };
 #endif
@@ -0,0 +1,512 @@
+// $Id$
+//
+// Eta-phi grid of the particles of an event, with prefix sums of the pt
+// along phi, to get the pt in cones and strips (random cones, perpendicular
+// cones, eta-phi strips) without looping over all particles for each of them.
+// The pt of the cells completely inside a region is taken from the prefix sums,
+// only the particles of the cells on the border are checked one by one.
+// Excluded regions (e.g. around the leading jets) can be removed from the sums
+// and used to place random cones away from them.
+//
+// Usage, once per event:
+//   grid->Reset();
+//   grid->AddParticles(tracks); grid->AddClusters(clusters, vertex);
+//   grid->Build();
+//   grid->AddExclusion(jet->Eta(), jet->Phi(), jetRadius);
+//   pt = grid->GetConeSum(eta, phi, r);
+
+#include <TMath.h>
+#include <TRandom.h>
+#include <TVector2.h>
+#include <TLorentzVector.h>
+
+#include "AliVCluster.h"
+#include "AliVParticle.h"
+#include "AliParticleContainer.h"
+#include "AliClusterContainer.h"
+
+#include "AliJetConeSumGrid.h"
+
+ClassImp(AliJetConeSumGrid)
+
+//________________________________________________________________________
+AliJetConeSumGrid::AliJetConeSumGrid() :
+  TObject(),
+  fNEta(36),
+  fEtaMin(-0.9),
+  fEtaMax(0.9),
+  fNPhi(126),
+  fDEta(0.05),
+  fDPhi(TMath::TwoPi()/126),
+  fStageEta(),
+  fStagePhi(),
+  fStagePt(),
+  fCellOffset(),
+  fPartEta(),
+  fPartPhi(),
+  fPartPt(),
+  fCellPt(),
+  fRowPrefix(),
+  fExclEta(),
+  fExclPhi(),
+  fExclR(),
+  fCellExcluded(),
+  fRowExcluded(),
+  fExclusionDirty(kFALSE)
+{
+  // Default constructor.
+
+  Reset();
+}
+
+//________________________________________________________________________
+AliJetConeSumGrid::AliJetConeSumGrid(Int_t nEta, Double_t etaMin, Double_t etaMax, Int_t nPhi) :
+  TObject(),
+  fNEta(nEta > 0 ? nEta : 1),
+  fEtaMin(etaMin),
+  fEtaMax(etaMax),
+  fNPhi(nPhi > 0 ? nPhi : 1),
+  fDEta(0),
+  fDPhi(0),
+  fStageEta(),
+  fStagePhi(),
+  fStagePt(),
+  fCellOffset(),
+  fPartEta(),
+  fPartPhi(),
+  fPartPt(),
+  fCellPt(),
+  fRowPrefix(),
+  fExclEta(),
+  fExclPhi(),
+  fExclR(),
+  fCellExcluded(),
+  fRowExcluded(),
+  fExclusionDirty(kFALSE)
+{
+  // Standard constructor: nEta rows in [etaMin, etaMax] (particles outside are
+  // kept in an underflow and an overflow row) and nPhi columns in [0, 2pi).
+
+  if (fEtaMax <= fEtaMin) fEtaMax = fEtaMin + 1;
+  fDEta = (fEtaMax - fEtaMin) / fNEta;
+  fDPhi = TMath::TwoPi() / fNPhi;
+
+  Reset();
+}
+
+//________________________________________________________________________
+void AliJetConeSumGrid::Reset()
+{
+  // Remove all particles and excluded regions, to be called at each event.
+
+  fStageEta.clear();
+  fStagePhi.clear();
+  fStagePt.clear();
+  fPartEta.clear();
+  fPartPhi.clear();
+  fPartPt.clear();
+
+  const Int_t ncells = (fNEta + 2) * fNPhi;
+  fCellOffset.assign(ncells + 1, 0);
+  fCellPt.assign(ncells, 0);
+  fRowPrefix.assign((fNEta + 2) * (fNPhi + 1), 0);
+
+  ClearExclusions();
+}
+
+//________________________________________________________________________
+void AliJetConeSumGrid::AddParticle(Double_t eta, Double_t phi, Double_t pt)
+{
+  // Add a particle, used in the sums after the next Build().
+
+  fStageEta.push_back(eta);
+  fStagePhi.push_back(TVector2::Phi_0_2pi(phi));
+  fStagePt.push_back(pt);
+}
+
+//________________________________________________________________________
+void AliJetConeSumGrid::AddParticles(AliParticleContainer *tracks)
+{
+  // Add the accepted particles of a container.
+
+  if (!tracks) return;
+
+  tracks->ResetCurrentID();
+  AliVParticle* track = tracks->GetNextAcceptParticle();
+  while (track) {
+    AddParticle(track->Eta(), track->Phi(), track->Pt());
+    track = tracks->GetNextAcceptParticle();
+  }
+}
+
+//________________________________________________________________________
+void AliJetConeSumGrid::AddClusters(AliClusterContainer *clusters, const Double_t vertex[3])
+{
+  // Add the accepted clusters of a container, with the momentum w.r.t. the vertex.
+
+  if (!clusters) return;
+
+  clusters->ResetCurrentID();
+  AliVCluster* cluster = clusters->GetNextAcceptCluster();
+  while (cluster) {
+    TLorentzVector nPart;
+    cluster->GetMomentum(nPart, const_cast<Double_t*>(vertex));
+    AddParticle(nPart.Eta(), nPart.Phi(), nPart.Pt());
+    cluster = clusters->GetNextAcceptCluster();
+  }
+}
+
+//________________________________________________________________________
+void AliJetConeSumGrid::Build()
+{
+  // Sort the particles by cell and compute the cell sums and the prefix sums.
+
+  const Int_t ncells = (fNEta + 2) * fNPhi;
+  const Int_t npart = fStagePt.size();
+
+  std::vector<Int_t> cells(npart);
+  fCellOffset.assign(ncells + 1, 0);
+  for (Int_t i = 0; i < npart; i++) {
+    Int_t col = TMath::Min(Int_t(fStagePhi[i] / fDPhi), fNPhi - 1);
+    cells[i] = GetRow(fStageEta[i]) * fNPhi + col;
+    fCellOffset[cells[i] + 1]++;
+  }
+  for (Int_t c = 0; c < ncells; c++) fCellOffset[c + 1] += fCellOffset[c];
+
+  fPartEta.resize(npart);
+  fPartPhi.resize(npart);
+  fPartPt.resize(npart);
+  fCellPt.assign(ncells, 0);
+  std::vector<Int_t> next(fCellOffset.begin(), fCellOffset.end() - 1);
+  for (Int_t i = 0; i < npart; i++) {
+    Int_t j = next[cells[i]]++;
+    fPartEta[j] = fStageEta[i];
+    fPartPhi[j] = fStagePhi[i];
+    fPartPt[j] = fStagePt[i];
+    fCellPt[cells[i]] += fStagePt[i];
+  }
+
+  fRowPrefix.assign((fNEta + 2) * (fNPhi + 1), 0);
+  for (Int_t row = 0; row < fNEta + 2; row++) {
+    Double_t *prefix = &fRowPrefix[row * (fNPhi + 1)];
+    for (Int_t col = 0; col < fNPhi; col++) prefix[col + 1] = prefix[col] + fCellPt[row * fNPhi + col];
+  }
+
+  fStageEta.clear();
+  fStagePhi.clear();
+  fStagePt.clear();
+  fExclusionDirty = kTRUE;
+}
+
+//________________________________________________________________________
+void AliJetConeSumGrid::AddExclusion(Double_t eta, Double_t phi, Double_t r)
+{
+  // Exclude the particles within r of (eta, phi) from the sums with exclusion
+  // and the cones closer than a minimum distance to (eta, phi) from the random cones.
+
+  fExclEta.push_back(eta);
+  fExclPhi.push_back(TVector2::Phi_0_2pi(phi));
+  fExclR.push_back(r);
+  fExclusionDirty = kTRUE;
+}
+
+//________________________________________________________________________
+void AliJetConeSumGrid::ClearExclusions()
+{
+  // Remove all excluded regions.
+
+  fExclEta.clear();
+  fExclPhi.clear();
+  fExclR.clear();
+  fExclusionDirty = kTRUE;
+}
+
+//________________________________________________________________________
+Bool_t AliJetConeSumGrid::IsExcluded(Double_t eta, Double_t phi, Double_t minDist) const
+{
+  // Whether (eta, phi) is closer than minDist to the center of an excluded region.
+
+  for (UInt_t i = 0; i < fExclEta.size(); i++) {
+    Double_t deta = eta - fExclEta[i];
+    Double_t dphi = DeltaPhi(phi, fExclPhi[i]);
+    if (deta * deta + dphi * dphi < minDist * minDist) return kTRUE;
+  }
+  return kFALSE;
+}
+
+//________________________________________________________________________
+Double_t AliJetConeSumGrid::GetConeSum(Double_t eta, Double_t phi, Double_t r, Bool_t exclude) const
+{
+  // Sum pt of the particles within r of (eta, phi), without the excluded regions if requested.
+
+  if (r <= 0) return 0;
+
+  Region reg = { kTRUE, eta, TVector2::Phi_0_2pi(phi), r * r, 0, 0, 0 };
+
+  // the cells completely inside the cone are taken 1e-9 smaller than the cone,
+  // so that the particles close to its border are always checked one by one
+  const Double_t rIn = r * (1 - 1e-9);
+
+  Double_t sum = 0;
+  const Int_t rowMin = GetRow(eta - r);
+  const Int_t rowMax = GetRow(eta + r);
+  for (Int_t row = rowMin; row <= rowMax; row++) {
+    const Double_t etaLow = GetRowEtaMin(row);
+    const Double_t etaUp = GetRowEtaMax(row);
+    const Double_t detaMin = eta < etaLow ? etaLow - eta : (eta > etaUp ? eta - etaUp : 0);
+    const Double_t detaMax = TMath::Max(TMath::Abs(eta - etaLow), TMath::Abs(eta - etaUp));
+    if (detaMin > r) continue;
+
+    // phi half width of the cone for the closest and the farthest eta of the row
+    const Double_t wOut = TMath::Sqrt(r * r - detaMin * detaMin);
+    const Double_t wIn = detaMax < rIn ? TMath::Sqrt(rIn * rIn - detaMax * detaMax) : -1;
+
+    Int_t firstIn = TMath::CeilNint((reg.fPhi - wIn) / fDPhi);
+    Int_t lastIn = TMath::FloorNint((reg.fPhi + wIn) / fDPhi) - 1;
+    if (wIn < 0) lastIn = firstIn - 1;
+    if (lastIn - firstIn + 1 >= fNPhi) lastIn = firstIn + fNPhi - 1;
+
+    Int_t first = TMath::FloorNint((reg.fPhi - wOut) / fDPhi);
+    Int_t last = TMath::FloorNint((reg.fPhi + wOut) / fDPhi);
+    if (last - first + 1 > fNPhi) {
+      // the whole row, starting with the cells inside the cone
+      first = lastIn >= firstIn ? firstIn : 0;
+      last = first + fNPhi - 1;
+    }
+
+    sum += SumRow(row, first, last, firstIn, lastIn, reg, exclude);
+  }
+
+  return sum;
+}
+
+//________________________________________________________________________
+Double_t AliJetConeSumGrid::GetPerpendicularConeSum(Double_t eta, Double_t phi, Double_t r, Bool_t exclude) const
+{
+  // Sum pt of the cone perpendicular in phi to (eta, phi), e.g. to a jet axis.
+
+  return GetConeSum(eta, phi + TMath::PiOver2(), r, exclude);
+}
+
+//________________________________________________________________________
+Double_t AliJetConeSumGrid::GetStripSum(Double_t etaMin, Double_t etaMax, Double_t phiMin, Double_t phiMax, Bool_t exclude) const
+{
+  // Sum pt of the particles with etaMin <= eta <= etaMax and phi going from phiMin to phiMax
+  // (through 2pi if phiMax < phiMin), without the excluded regions if requested.
+
+  if (etaMax < etaMin) return 0;
+
+  Double_t width = phiMax - phiMin;
+  if (width < 0) width += TMath::TwoPi();
+  if (width > TMath::TwoPi()) width = TMath::TwoPi();
+
+  Region reg = { kFALSE, 0, TVector2::Phi_0_2pi(phiMin), 0, etaMin, etaMax, width };
+
+  const Double_t eps = 1e-9;
+
+  Int_t first = TMath::FloorNint(reg.fPhi / fDPhi);
+  Int_t last = TMath::FloorNint((reg.fPhi + width) / fDPhi);
+  if (last - first + 1 > fNPhi) last = first + fNPhi - 1;
+
+  Double_t sum = 0;
+  const Int_t rowMin = GetRow(etaMin);
+  const Int_t rowMax = GetRow(etaMax);
+  for (Int_t row = rowMin; row <= rowMax; row++) {
+    Int_t firstIn = first;
+    Int_t lastIn = first - 1;
+    if (GetRowEtaMin(row) > etaMin + eps && GetRowEtaMax(row) < etaMax - eps) {
+      if (width >= TMath::TwoPi()) {
+        lastIn = first + fNPhi - 1;
+      }
+      else {
+        firstIn = TMath::CeilNint((reg.fPhi + eps) / fDPhi);
+        lastIn = TMath::FloorNint((reg.fPhi + width - eps) / fDPhi) - 1;
+      }
+    }
+    sum += SumRow(row, first, last, firstIn, lastIn, reg, exclude);
+  }
+
+  return sum;
+}
+
+//________________________________________________________________________
+Bool_t AliJetConeSumGrid::GetRandomCone(Double_t &eta, Double_t &phi, Double_t etaMin, Double_t etaMax,
+                                        Double_t phiMin, Double_t phiMax, Double_t minDist) const
+{
+  // Draw a random cone axis in the given eta-phi limits, at least minDist away
+  // from the centers of the excluded regions. Returns kFALSE if none was found.
+
+  Int_t repeats = 0;
+  do {
+    eta = gRandom->Rndm() * (etaMax - etaMin) + etaMin;
+    phi = gRandom->Rndm() * (phiMax - phiMin) + phiMin;
+    repeats++;
+  } while (minDist > 0 && IsExcluded(eta, phi, minDist) && repeats < 999);
+
+  return repeats < 999;
+}
+
+//________________________________________________________________________
+Double_t AliJetConeSumGrid::GetTotalSum() const
+{
+  // Sum pt of all particles.
+
+  Double_t sum = 0;
+  for (Int_t row = 0; row < fNEta + 2; row++) sum += fRowPrefix[row * (fNPhi + 1) + fNPhi];
+  return sum;
+}
+
+//________________________________________________________________________
+Int_t AliJetConeSumGrid::GetRow(Double_t eta) const
+{
+  // Row of eta: 0 below fEtaMin, fNEta + 1 above fEtaMax.
+
+  if (eta < fEtaMin) return 0;
+  if (eta >= fEtaMax) return fNEta + 1;
+  return TMath::Min(Int_t((eta - fEtaMin) / fDEta), fNEta - 1) + 1;
+}
+
+//________________________________________________________________________
+Double_t AliJetConeSumGrid::GetRowEtaMin(Int_t row) const
+{
+  // Lower eta edge of a row.
+
+  if (row == 0) return -1e30;
+  if (row == fNEta + 1) return fEtaMax;
+  return fEtaMin + (row - 1) * fDEta;
+}
+
+//________________________________________________________________________
+Double_t AliJetConeSumGrid::GetRowEtaMax(Int_t row) const
+{
+  // Upper eta edge of a row.
+
+  if (row == 0) return fEtaMin;
+  if (row == fNEta + 1) return 1e30;
+  if (row == fNEta) return fEtaMax;
+  return fEtaMin + row * fDEta;
+}
+
+//________________________________________________________________________
+Bool_t AliJetConeSumGrid::IsInRegion(const Region &reg, Double_t eta, Double_t phi) const
+{
+  // Whether a particle is in a cone or a strip.
+
+  if (reg.fCone) {
+    Double_t deta = eta - reg.fEta;
+    Double_t dphi = DeltaPhi(phi, reg.fPhi);
+    return deta * deta + dphi * dphi <= reg.fR2;
+  }
+
+  if (eta < reg.fEtaMin || eta > reg.fEtaMax) return kFALSE;
+  Double_t dphi = phi - reg.fPhi;
+  if (dphi < 0) dphi += TMath::TwoPi();
+  return dphi <= reg.fWidth;
+}
+
+//________________________________________________________________________
+Bool_t AliJetConeSumGrid::IsInExclusion(Double_t eta, Double_t phi) const
+{
+  // Whether a particle is in an excluded region.
+
+  for (UInt_t i = 0; i < fExclEta.size(); i++) {
+    Double_t deta = eta - fExclEta[i];
+    Double_t dphi = DeltaPhi(phi, fExclPhi[i]);
+    if (deta * deta + dphi * dphi <= fExclR[i] * fExclR[i]) return kTRUE;
+  }
+  return kFALSE;
+}
+
+//________________________________________________________________________
+void AliJetConeSumGrid::UpdateExclusionCells() const
+{
+  // Flag the cells overlapping the eta-phi box of an excluded region.
+
+  fExclusionDirty = kFALSE;
+  fCellExcluded.assign((fNEta + 2) * fNPhi, 0);
+  fRowExcluded.assign(fNEta + 2, 0);
+
+  for (UInt_t i = 0; i < fExclEta.size(); i++) {
+    const Double_t r = fExclR[i];
+    Int_t first = TMath::FloorNint((fExclPhi[i] - r) / fDPhi);
+    Int_t last = TMath::FloorNint((fExclPhi[i] + r) / fDPhi);
+    if (last - first + 1 > fNPhi) last = first + fNPhi - 1;
+    for (Int_t row = GetRow(fExclEta[i] - r); row <= GetRow(fExclEta[i] + r); row++) {
+      fRowExcluded[row] = 1;
+      for (Int_t col = first; col <= last; col++) {
+        fCellExcluded[row * fNPhi + ((col % fNPhi) + fNPhi) % fNPhi] = 1;
+      }
+    }
+  }
+}
+
+//________________________________________________________________________
+Double_t AliJetConeSumGrid::SumCell(Int_t cell, const Region &reg, Bool_t exclude) const
+{
+  // Sum pt of the particles of a cell in the region, checked one by one.
+
+  Double_t sum = 0;
+  for (Int_t i = fCellOffset[cell]; i < fCellOffset[cell + 1]; i++) {
+    if (!IsInRegion(reg, fPartEta[i], fPartPhi[i])) continue;
+    if (exclude && IsInExclusion(fPartEta[i], fPartPhi[i])) continue;
+    sum += fPartPt[i];
+  }
+  return sum;
+}
+
+//________________________________________________________________________
+Double_t AliJetConeSumGrid::SumSpan(Int_t row, Int_t first, Int_t last) const
+{
+  // Sum pt of the columns first to last of a row (at most fNPhi, wrapping around 2pi).
+
+  const Double_t *prefix = &fRowPrefix[row * (fNPhi + 1)];
+  const Int_t start = ((first % fNPhi) + fNPhi) % fNPhi;
+  const Int_t len = last - first + 1;
+  if (start + len <= fNPhi) return prefix[start + len] - prefix[start];
+  return prefix[fNPhi] - prefix[start] + prefix[start + len - fNPhi];
+}
+
+//________________________________________________________________________
+Double_t AliJetConeSumGrid::SumRow(Int_t row, Int_t first, Int_t last, Int_t firstIn, Int_t lastIn,
+                                   const Region &reg, Bool_t exclude) const
+{
+  // Sum pt of the columns first to last of a row, of which firstIn to lastIn
+  // are completely inside the region and the others on its border.
+
+  Bool_t excludeRow = exclude && !fExclEta.empty();
+  if (excludeRow) {
+    if (fExclusionDirty) UpdateExclusionCells();
+    excludeRow = fRowExcluded[row];
+  }
+
+  Double_t sum = 0;
+  for (Int_t col = first; col <= last; col++) {
+    if (col >= firstIn && col <= lastIn) continue;
+    sum += SumCell(row * fNPhi + ((col % fNPhi) + fNPhi) % fNPhi, reg, excludeRow);
+  }
+
+  if (lastIn >= firstIn) {
+    if (!excludeRow) {
+      sum += SumSpan(row, firstIn, lastIn);
+    }
+    else {
+      for (Int_t col = firstIn; col <= lastIn; col++) {
+        Int_t cell = row * fNPhi + ((col % fNPhi) + fNPhi) % fNPhi;
+        sum += fCellExcluded[cell] ? SumCell(cell, reg, kTRUE) : fCellPt[cell];
+      }
+    }
+  }
+
+  return sum;
+}
+
+//________________________________________________________________________
+Double_t AliJetConeSumGrid::DeltaPhi(Double_t phi1, Double_t phi2)
+{
+  // Phi difference in [-pi, pi].
+
+  Double_t dphi = phi1 - phi2;
+  while (dphi > TMath::Pi()) dphi -= TMath::TwoPi();
+  while (dphi < -TMath::Pi()) dphi += TMath::TwoPi();
+  return dphi;
+}
@@ -0,0 +1,89 @@
+#ifndef ALIJETCONESUMGRID_H
+#define ALIJETCONESUMGRID_H
+
+// $Id$
+
+#include <vector>
+
+#include <TObject.h>
+
+class AliParticleContainer;
+class AliClusterContainer;
+
+class AliJetConeSumGrid : public TObject {
+ public:
+
+  AliJetConeSumGrid();
+  AliJetConeSumGrid(Int_t nEta, Double_t etaMin, Double_t etaMax, Int_t nPhi);
+  virtual ~AliJetConeSumGrid() {;}
+
+  void                        Reset();
+  void                        AddParticle(Double_t eta, Double_t phi, Double_t pt);
+  void                        AddParticles(AliParticleContainer *tracks);
+  void                        AddClusters(AliClusterContainer *clusters, const Double_t vertex[3]);
+  void                        Build();
+
+  void                        AddExclusion(Double_t eta, Double_t phi, Double_t r);
+  void                        ClearExclusions();
+  Bool_t                      IsExcluded(Double_t eta, Double_t phi, Double_t minDist) const;
+
+  Double_t                    GetConeSum(Double_t eta, Double_t phi, Double_t r, Bool_t exclude=kFALSE) const;
+  Double_t                    GetPerpendicularConeSum(Double_t eta, Double_t phi, Double_t r, Bool_t exclude=kFALSE) const;
+  Double_t                    GetStripSum(Double_t etaMin, Double_t etaMax, Double_t phiMin, Double_t phiMax, Bool_t exclude=kFALSE) const;
+  Bool_t                      GetRandomCone(Double_t &eta, Double_t &phi, Double_t etaMin, Double_t etaMax,
+                                            Double_t phiMin, Double_t phiMax, Double_t minDist=0) const;
+
+  Int_t                       GetNParticles() const                                { return fPartPt.size()               ; }
+  Double_t                    GetTotalSum() const;
+
+ protected:
+  // Region of a sum: a cone (eta, phi, r) or a strip (eta range, phi range starting at phi of width fWidth)
+  struct Region {
+    Bool_t   fCone;   // cone or strip
+    Double_t fEta;    // cone center
+    Double_t fPhi;    // cone center, or phi start of the strip in [0, 2pi)
+    Double_t fR2;     // cone radius squared
+    Double_t fEtaMin; // eta range of the strip
+    Double_t fEtaMax; //
+    Double_t fWidth;  // phi width of the strip
+  };
+
+  Int_t                       GetRow(Double_t eta) const;
+  Double_t                    GetRowEtaMin(Int_t row) const;
+  Double_t                    GetRowEtaMax(Int_t row) const;
+  Bool_t                      IsInRegion(const Region &reg, Double_t eta, Double_t phi) const;
+  Bool_t                      IsInExclusion(Double_t eta, Double_t phi) const;
+  void                        UpdateExclusionCells() const;
+  Double_t                    SumCell(Int_t cell, const Region &reg, Bool_t exclude) const;
+  Double_t                    SumSpan(Int_t row, Int_t first, Int_t last) const;
+  Double_t                    SumRow(Int_t row, Int_t first, Int_t last, Int_t firstIn, Int_t lastIn,
+                                     const Region &reg, Bool_t exclude) const;
+
+  static Double_t             DeltaPhi(Double_t phi1, Double_t phi2);
+
+  Int_t                       fNEta;                       // Number of eta rows in the grid acceptance
+  Double_t                    fEtaMin;                     // Minimum eta of the grid
+  Double_t                    fEtaMax;                     // Maximum eta of the grid
+  Int_t                       fNPhi;                       // Number of phi columns
+  Double_t                    fDEta;                       // Eta size of a cell
+  Double_t                    fDPhi;                       // Phi size of a cell
+
+  std::vector<Double_t>       fStageEta;                   //!Particles added since the last build
+  std::vector<Double_t>       fStagePhi;                   //!
+  std::vector<Double_t>       fStagePt;                    //!
+  std::vector<Int_t>          fCellOffset;                 //!First particle of each cell (rows with under/overflow x columns)
+  std::vector<Double_t>       fPartEta;                    //!Particle eta, ordered by cell
+  std::vector<Double_t>       fPartPhi;                    //!Particle phi in [0, 2pi), ordered by cell
+  std::vector<Double_t>       fPartPt;                     //!Particle pt, ordered by cell
+  std::vector<Double_t>       fCellPt;                     //!Sum pt of each cell
+  std::vector<Double_t>       fRowPrefix;                  //!Prefix sums of the cell pt along phi, per row
+  std::vector<Double_t>       fExclEta;                    //!Excluded regions (e.g. leading jets)
+  std::vector<Double_t>       fExclPhi;                    //!
+  std::vector<Double_t>       fExclR;                      //!
+  mutable std::vector<Char_t> fCellExcluded;               //!Cells overlapping an excluded region
+  mutable std::vector<Char_t> fRowExcluded;                //!Rows with a cell overlapping an excluded region
+  mutable Bool_t              fExclusionDirty;             //!Excluded cells to be updated
+
+  ClassDef(AliJetConeSumGrid, 1) // Eta-phi grid for cone and strip pt sums
+};
+#endif
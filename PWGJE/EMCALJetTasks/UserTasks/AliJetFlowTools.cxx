@@ -56,6 +56,9 @@
 #include "TLine.h"
 #include "TVirtualFitter.h"
 #include "TFitResultPtr.h"
+#include "TKey.h"
+#include "TClass.h"
+#include "TSystem.h"
 #include "Minuit2/Minuit2Minimizer.h"
 #include "Math/Functor.h"
 // aliroot includes
@@ -69,6 +72,9 @@
 #include "RooUnfoldSvd.h"
 #include "RooUnfoldBayes.h"
 #include "TSVDUnfold.h"
+// std includes
+#include <unistd.h>
+#include <sys/wait.h>
 
 using namespace std;
 //_____________________________________________________________________________
@@ -149,7 +155,12 @@ AliJetFlowTools::AliJetFlowTools() :
     fSubdueError        (kTRUE),
     fUnfoldedSpectrumIn (0x0),
     fUnfoldedSpectrumOut(0x0),
-    fHarmonic(2) { // class constructor
+    fHarmonic(2),
+    fNWorkers(0),
+    fJobNames(),
+    fJobConfigurations(),
+    fJobSeeds(),
+    fJobBootstrap() { // class constructor
 #ifdef ALIJETFLOWTOOLS_DEBUG_FLAG
     printf("__FILE__ = %s \n __LINE __ %i , __FUNC__ %s \n ", __FILE__, __LINE__, __func__);
 #endif
@@ -387,6 +398,177 @@ void AliJetFlowTools::Make(TH1* customIn, TH1* customOut) {
 
 }
 //_____________________________________________________________________________
+Int_t AliJetFlowTools::RunJobs(TH1* customIn, TH1* customOut) {
+#ifdef ALIJETFLOWTOOLS_DEBUG_FLAG
+    printf("__FILE__ = %s \n __LINE __ %i , __FUNC__ %s \n ", __FILE__, __LINE__, __func__);
+#endif
+    // run the jobs added via AddJob and AddBootstrapJobs and merge their output 
+    // 1) the input (including customIn and customOut) is prepared once, so that all jobs inherit it;
+    //    a job only prepares it again if its configuration changes the input settings (see RunJob)
+    // 2) every job runs in a forked process (the unfolding routines rely on static 
+    //    and global state, e.g. AliUnfolding, TMinuit and gDirectory, so they cannot 
+    //    share a process) and writes its output list to a temporary file
+    // 3) the output lists are copied to the output file in the order in which the jobs were 
+    //    added, with the same prefixes as for consecutive calls to CreateOutputList and Make,
+    //    and the rms profiles of the jobs are added to the rms profiles of this object
+    // note that each job starts from the state at the time of this call, i.e. changes made by a 
+    // job (including the training of the power law fit) do not propagate to the next job
+    // returns the number of jobs for which output was merged
+    Int_t nJobs(fJobNames.size());
+    if(nJobs == 0) return 0;
+    if(fRefreshInput) {
+        if(!PrepareForUnfolding(customIn, customOut)) {
+            printf(" AliJetFlowTools::RunJobs() Fatal error \n - couldn't prepare for unfolding ! \n");
+            return 0;
+        }
+    }
+    // the workers use the prepared input as is, the flag is restored when the jobs are done
+    Bool_t refreshInput(fRefreshInput);
+    fRefreshInput = kFALSE;
+    if(!fOutputFile) fOutputFile = new TFile(fOutputFileName.Data(), "RECREATE");
+    Int_t nWorkers(fNWorkers);
+    if(nWorkers < 1) nWorkers = (Int_t)sysconf(_SC_NPROCESSORS_ONLN);
+    if(nWorkers < 1) nWorkers = 1;
+    Int_t listPrefix(fListPrefix);
+    std::vector<TString> fileNames(nJobs);
+    std::vector<pid_t> pids(nJobs, -1);
+    std::vector<Bool_t> success(nJobs, kFALSE);
+    for(Int_t i(0); i < nJobs; i++) fileNames[i] = Form("%s.job%i_%i.root", fOutputFileName.Data(), (Int_t)getpid(), i);
+    // don't duplicate buffered output in the workers
+    fflush(0);
+    cout.flush();
+    Int_t next(0), running(0);
+    while(next < nJobs || running > 0) {
+        while(next < nJobs && running < nWorkers) {
+            pid_t pid = fork();
+            if(pid == 0) {
+                // worker: run the job, and leave without the exit handlers, 
+                // which would close the files of the parent process 
+                RunJob(next, listPrefix + next, fileNames[next], customIn, customOut);
+                fflush(0);
+                cout.flush();
+                _exit(0);
+            } else if(pid < 0) {
+                printf(" > RunJobs: couldn't start job %s ! < \n", fJobNames[next].Data());
+            } else {
+                pids[next] = pid;
+                running++;
+            }
+            next++;
+        }
+        if(running == 0) continue;
+        Int_t status(0);
+        pid_t pid = wait(&status);
+        if(pid < 0) break;
+        for(Int_t i(0); i < nJobs; i++) {
+            if(pids[i] != pid) continue;
+            success[i] = (WIFEXITED(status) && WEXITSTATUS(status) == 0);
+            running--;
+        }
+    }
+    // merge the output lists, in the order of the jobs
+    Int_t merged(0);
+    TProfile** profiles[] = {&fRMSSpectrumIn, &fRMSSpectrumOut, &fRMSRatio, &fRMSV2};
+    for(Int_t i(0); i < nJobs; i++) {
+        TString name(Form("%i__%s", listPrefix + i + 1, fJobNames[i].Data()));
+        TFile* jobFile = (success[i]) ? TFile::Open(fileNames[i].Data(), "READ") : 0x0;
+        TDirectory* jobDir = (jobFile && !jobFile->IsZombie()) ? dynamic_cast<TDirectory*>(jobFile->Get(name.Data())) : 0x0;
+        if(!jobDir) {
+            printf(" > RunJobs: job %s failed, no output merged ! < \n", fJobNames[i].Data());
+        } else {
+            fOutputFile->cd();
+            fActiveString = name;
+            fActiveDir = new TDirectoryFile(name.Data(), jobDir->GetTitle());
+            CopyDirectory(jobDir, fActiveDir);
+            for(Int_t j(0); j < 4; j++) {
+                TProfile* p = dynamic_cast<TProfile*>(jobFile->Get(Form("RMSProfile_%i", j)));
+                if(!p) continue;
+                if(*profiles[j]) (*profiles[j])->Add(p);
+                else {
+                    *profiles[j] = (TProfile*)p->Clone();
+                    (*profiles[j])->SetDirectory(0x0);
+                }
+            }
+            merged++;
+        }
+        if(jobFile) {
+            jobFile->Close();
+            delete jobFile;
+        }
+        gSystem->Unlink(fileNames[i].Data());
+    }
+    fListPrefix = listPrefix + nJobs;
+    fRefreshInput = refreshInput;
+    if(fActiveDir) fActiveDir->cd();
+    ClearJobs();
+    return merged;
+}
+//_____________________________________________________________________________
+void AliJetFlowTools::RunJob(Int_t job, Int_t listPrefix, TString fileName, TH1* customIn, TH1* customOut) {
+#ifdef ALIJETFLOWTOOLS_DEBUG_FLAG
+    printf("__FILE__ = %s \n __LINE __ %i , __FUNC__ %s \n ", __FILE__, __LINE__, __func__);
+#endif
+    // run a single job of RunJobs (called in the worker process), output goes to fileName
+    fOutputFile = new TFile(fileName.Data(), "RECREATE");
+    fListPrefix = listPrefix;
+    fActiveString = "";
+    CreateOutputList(fJobNames[job]);
+    // the rms profiles only hold the values of this job, they're added up in RunJobs
+    TProfile* profiles[] = {fRMSSpectrumIn, fRMSSpectrumOut, fRMSRatio, fRMSV2};
+    for(Int_t j(0); j < 4; j++) if(profiles[j]) profiles[j]->Reset();
+    // the input prepared by RunJobs is used, unless the configuration of the job changes
+    // the settings it was prepared with (e.g. the binning), then it's prepared again
+    TString input(GetInputSettings());
+    if(fJobConfigurations[job]) fJobConfigurations[job](this);
+    if(GetInputSettings() != input) fRefreshInput = kTRUE;
+    if(fJobBootstrap[job]) fBootstrap = kTRUE;
+    if(fJobSeeds[job] >= 0) gRandom->SetSeed(fJobSeeds[job]);
+    Make(customIn, customOut);
+    fOutputFile->cd();
+    TProfile* results[] = {fRMSSpectrumIn, fRMSSpectrumOut, fRMSRatio, fRMSV2};
+    for(Int_t j(0); j < 4; j++) if(results[j]) results[j]->Write(Form("RMSProfile_%i", j));
+    fOutputFile->Close();
+}
+//_____________________________________________________________________________
+TString AliJetFlowTools::GetInputSettings() const {
+    // the settings read by PrepareForUnfolding, as a string to compare them before and after
+    // the configuration of a job in RunJob
+    TString settings(Form("%p %p %p %i %.8g %i %i %i %i %i %i %i %i %i", 
+                (void*)fInputList, (void*)fDetectorResponse, (void*)fMergeWithList, fMergeWithCen, fMergeWithWeight,
+                fRawInputProvided, fRho0, fExLJDpt, fDphiUnfolding, fNormalizeSpectra, fEventCount, fAvoidRoundingError, 
+                fTrainPower, fRefreshInput));
+    TArrayD* doubles[] = {fBinsTrue, fBinsRec, fCentralityWeights};
+    for(Int_t i(0); i < 3; i++) {
+        settings += " |";
+        if(doubles[i]) for(Int_t j(0); j < doubles[i]->GetSize(); j++) settings += Form(" %.17g", doubles[i]->At(j));
+    }
+    settings += " |";
+    if(fCentralityArray) for(Int_t j(0); j < fCentralityArray->GetSize(); j++) settings += Form(" %i", fCentralityArray->At(j));
+    return settings;
+}
+//_____________________________________________________________________________
+void AliJetFlowTools::CopyDirectory(TDirectory* source, TDirectory* target) {
+    // copy all objects (all cycles) and subdirectories of source to target
+    // the list of keys holds the last written key first, so it's read backwards to keep the order
+    TIter next(source->GetListOfKeys(), kIterBackward);
+    TKey* key(0x0);
+    while((key = (TKey*)next())) {
+        TClass* cl(TClass::GetClass(key->GetClassName()));
+        if(cl && cl->InheritsFrom(TDirectory::Class())) {
+            TDirectory* subdir((TDirectory*)source->Get(key->GetName()));
+            target->cd();
+            TDirectoryFile* copy(new TDirectoryFile(key->GetName(), subdir->GetTitle()));
+            CopyDirectory(subdir, copy);
+        } else {
+            TObject* obj(key->ReadObj());
+            if(!obj) continue;
+            target->cd();
+            obj->Write(key->GetName());
+            delete obj;
+        }
+    }
+}
+//_____________________________________________________________________________
 TH1D* AliJetFlowTools::UnfoldWrapper(
         const TH1D* measuredJetSpectrum,        // truncated raw jets (same binning as pt rec of response) 
         const TH2D* resizedResponse,            // response matrix
@@ -21,6 +21,9 @@ class TObjArray;
 // aliroot forward declarations
 class AliAnaChargedJetResponseMaker;
 class AliUnfolding;
+// std includes
+#include <functional>
+#include <vector>
 // root includes
 #include "TRandom3.h"
 #include "TMatrixD.h"
@@ -192,6 +195,32 @@ class AliJetFlowTools {
         // main function. buffers about 5mb per call!
         void            Make(TH1* customIn = 0x0, TH1* customOut = 0x0);
         void            MakeAU();       // test function, use with caution (09012014)
+        // execution engine for independent unfolding variations (systematics, bootstrap replicas)
+        // every job is a call to Make(customIn, customOut) after applying its configuration, run on a forked copy
+        // of the current state (own copies of all histograms and of the static unfolding state).
+        // at most fNWorkers jobs run at a time, outputs are merged in the order the jobs were added
+        void            SetNWorkers(Int_t n)                    {fNWorkers              = n;}
+        void            AddJob(TString name, std::function<void(AliJetFlowTools*)> configure = std::function<void(AliJetFlowTools*)>(), Int_t seed = -1) {
+            fJobNames.push_back(name);
+            fJobConfigurations.push_back(configure);
+            fJobSeeds.push_back(seed);
+            fJobBootstrap.push_back(kFALSE);
+        }
+        void            AddBootstrapJobs(TString name, Int_t replicas, Int_t seed = 1, std::function<void(AliJetFlowTools*)> configure = std::function<void(AliJetFlowTools*)>()) {
+            // one job per replica, each with its own (reproducible) seed
+            for(Int_t i(0); i < replicas; i++) {
+                AddJob(Form("%s_bootstrap_%i", name.Data(), i), configure, seed + i);
+                fJobBootstrap.back() = kTRUE;
+            }
+        }
+        void            ClearJobs() {
+            fJobNames.clear();
+            fJobConfigurations.clear();
+            fJobSeeds.clear();
+            fJobBootstrap.clear();
+        }
+        Int_t           GetNJobs() const                        {return fJobNames.size();}
+        Int_t           RunJobs(TH1* customIn = 0x0, TH1* customOut = 0x0);
         void            Finish() {
             fOutputFile->cd();
             if(fRMSSpectrumIn)  fRMSSpectrumIn->Write();
@@ -486,6 +515,9 @@ TLatex* tex = new TLatex(xmin, ymax, string.Data());
                 Bool_t RMS = kFALSE) const;
 
         static void     ResetAliUnfolding();
+        void            RunJob(Int_t job, Int_t listPrefix, TString fileName, TH1* customIn, TH1* customOut);
+        TString         GetInputSettings() const;
+        static void     CopyDirectory(TDirectory* source, TDirectory* target);
         static void     SquelchWarning() {
             printf(" >> I squelched a warning, jay, I'm contributing ! << \n");
             return;
@@ -577,6 +609,11 @@ TLatex* tex = new TLatex(xmin, ymax, string.Data());
         TH1*                    fUnfoldedSpectrumIn;    // unfolded spectrum in plane
         TH1*                    fUnfoldedSpectrumOut;   // unfolded spectrum out of plane
         Int_t                   fHarmonic;              // vn harmonic
+        Int_t                   fNWorkers;              // max number of jobs running at a time (0: number of cores)
+        std::vector<TString>    fJobNames;              // name of the output list of each job
+        std::vector<std::function<void(AliJetFlowTools*)> >      fJobConfigurations;     // configuration of each job
+        std::vector<Int_t>      fJobSeeds;              // seed of gRandom for each job (-1: inherited state)
+        std::vector<Bool_t>     fJobBootstrap;          // resample the input spectra in the job
 
         static TArrayD*         gV2;                    // internal use only, do not touch these
         static TArrayD*         gStat;                  // internal use only, do not touch these
@@ -13,6 +13,9 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 //
 
+#include <algorithm>
+#include <map>
+
 #include <Riostream.h>
 
 #include <TH1.h>
@@ -45,6 +48,7 @@
 #include "AliRsnMiniPair.h"
 #include "AliRsnMiniEvent.h"
 #include "AliRsnMiniParticle.h"
+#include "AliRsnMiniAxis.h"
 
 #include "AliRsnMiniAnalysisTask.h"
 
@@ -68,6 +72,7 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fFlowQnVectorExpStep("latest"),
    fContinuousMix(kTRUE),
    fNMix(0),
+   fIndexedMix(kFALSE),
    fMaxDiffMult(10),
    fMaxDiffVz(1.0),
    fMaxDiffAngle(1E20),
@@ -99,7 +104,13 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fRejectIfNoQuark(kFALSE),
    fMotherAcceptanceCutMinPt(0.0),
    fMotherAcceptanceCutMaxEta(0.9),
-   fKeepMotherInAcceptance(kFALSE) 
+   fKeepMotherInAcceptance(kFALSE),
+   fSharedPairs(kFALSE),
+   fSharedPair(),
+   fSharedSel1(),
+   fSharedSel2(),
+   fSharedValues(),
+   fSharedValueDone()
 {
 //
 // Dummy constructor ALWAYS needed for I/O.
@@ -123,6 +134,7 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC) :
    fFlowQnVectorExpStep("latest"),
    fContinuousMix(kTRUE),
    fNMix(0),
+   fIndexedMix(kFALSE),
    fMaxDiffMult(10),
    fMaxDiffVz(1.0),
    fMaxDiffAngle(1E20),
@@ -154,7 +166,13 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC) :
    fRejectIfNoQuark(kFALSE),
    fMotherAcceptanceCutMinPt(0.0),
    fMotherAcceptanceCutMaxEta(0.9),
-   fKeepMotherInAcceptance(kFALSE)
+   fKeepMotherInAcceptance(kFALSE),
+   fSharedPairs(kFALSE),
+   fSharedPair(),
+   fSharedSel1(),
+   fSharedSel2(),
+   fSharedValues(),
+   fSharedValueDone()
 {
 //
 // Default constructor.
@@ -183,6 +201,7 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fFlowQnVectorExpStep(copy.fFlowQnVectorExpStep),
    fContinuousMix(copy.fContinuousMix),
    fNMix(copy.fNMix),
+   fIndexedMix(copy.fIndexedMix),
    fMaxDiffMult(copy.fMaxDiffMult),
    fMaxDiffVz(copy.fMaxDiffVz),
    fMaxDiffAngle(copy.fMaxDiffAngle),
@@ -214,7 +233,13 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fRejectIfNoQuark(copy.fRejectIfNoQuark),
    fMotherAcceptanceCutMinPt(copy.fMotherAcceptanceCutMinPt),
    fMotherAcceptanceCutMaxEta(copy.fMotherAcceptanceCutMaxEta),
-   fKeepMotherInAcceptance(copy.fKeepMotherInAcceptance)
+   fKeepMotherInAcceptance(copy.fKeepMotherInAcceptance),
+   fSharedPairs(copy.fSharedPairs),
+   fSharedPair(),
+   fSharedSel1(),
+   fSharedSel2(),
+   fSharedValues(),
+   fSharedValueDone()
 {
 //
 // Copy constructor.
@@ -249,6 +274,7 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fFlowQnVectorExpStep = copy.fFlowQnVectorExpStep;
    fContinuousMix = copy.fContinuousMix;
    fNMix = copy.fNMix;
+   fIndexedMix = copy.fIndexedMix;
    fMaxDiffMult = copy.fMaxDiffMult;
    fMaxDiffVz = copy.fMaxDiffVz;
    fMaxDiffAngle = copy.fMaxDiffAngle;
@@ -277,6 +303,7 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fMotherAcceptanceCutMinPt = copy.fMotherAcceptanceCutMinPt;
    fMotherAcceptanceCutMaxEta = copy.fMotherAcceptanceCutMaxEta;
    fKeepMotherInAcceptance = copy.fKeepMotherInAcceptance;
+   fSharedPairs = copy.fSharedPairs;
    return (*this);
 }
 
@@ -491,6 +518,19 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       else printNum = 0;
    }
 
+   // groups of pair outputs with the same daughter definitions, which share the pair computation
+   std::vector< std::vector<Int_t> > sameGroups, mixGroups;
+   if (fSharedPairs) GroupPairOutputs(sameGroups, mixGroups);
+   UInt_t igroup;
+
+   // mixing variables of the buffered events, to search the partners without reading the buffer again
+   std::vector<Float_t> evVz, evMult, evAngle;
+   if (fNMix > 0 && fIndexedMix) {
+      evVz.resize(nEvents);
+      evMult.resize(nEvents);
+      evAngle.resize(nEvents);
+   }
+
    // loop on events, and for each one fill all outputs
    // using the appropriate procedure depending on its type
    // only mother-related histograms are filled in UserExec,
@@ -499,6 +539,11 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    for (ievt = 0; ievt < nEvents; ievt++) {
       // get next entry
       fEvBuffer->GetEntry(ievt);
+      if (!evVz.empty()) {
+         evVz[ievt] = fMiniEvent->Vz();
+         evMult[ievt] = fMiniEvent->Mult();
+         evAngle[ievt] = fMiniEvent->Angle();
+      }
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] Std.Event %d/%d",GetName(), ievt,nEvents));
          timer.Stop(); timer.Print(); fflush(stdout); timer.Start(kFALSE);
@@ -508,6 +553,8 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
          def = (AliRsnMiniOutput *)fHistograms[idef];
          if (!def) continue;
          compType = def->GetComputation();
+         // pairs are filled below for all the outputs of a group
+         if (fSharedPairs && compType != AliRsnMiniOutput::kEventOnly) continue;
          // execute computation in the appropriate way
          switch (compType) {
             case AliRsnMiniOutput::kEventOnly:
@@ -539,6 +586,10 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
          // message
          AliDebugClass(1, Form("Event %6d: def = '%15s' -- fills = %5d", ievt, def->GetName(), ifill));
       }
+      for (igroup = 0; igroup < sameGroups.size(); igroup++) {
+         ifill = FillPairGroup(sameGroups[igroup], fMiniEvent, fMiniEvent);
+         AliDebugClass(1, Form("Event %6d: group %d of %d outputs -- fills = %5d", ievt, igroup, (Int_t)sameGroups[igroup].size(), ifill));
+      }
    }
 
    // if no mixing is required, stop here and post the output
@@ -549,66 +600,70 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    }
 
    // initialize mixing counter
-   Int_t    nmatched[nEvents];
-   TString *smatched = new TString[nEvents];
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      smatched[ievt] = "|";
-      nmatched[ievt] = 0;
-   }
-
+   std::vector< std::vector<Int_t> > matched(nEvents);
 
    AliInfo(Form("[%s] Std.Event %d/%d",GetName(), nEvents,nEvents));
    timer.Stop(); timer.Print(); timer.Start(); fflush(stdout);
 
    // search for good matchings
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      if (printNum&&(ievt%printNum==0)) {
-         AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
-         timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
-      }
-      if (nmatched[ievt] >= fNMix) continue;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      for (iloop = 1; iloop < nEvents; iloop++) {
-         imix = ievt + iloop;
-         if (imix >= nEvents) imix -= nEvents;
-         if (imix == ievt) continue;
-         // text next entry
-         fEvBuffer->GetEntry(imix);
-         // skip if events are not matched
-         if (!EventsMatch(&evMain, fMiniEvent)) continue;
-         // check that the array of good matches for mixed does not already contain main event
-         if (smatched[imix].Contains(Form("|%d|", ievt))) continue;
-         // check that the found good events has not enough matches already
-         if (nmatched[imix] >= fNMix) continue;
-         // add new mixing candidate
-         smatched[ievt].Append(Form("%d|", imix));
-         nmatched[ievt]++;
-         nmatched[imix]++;
-         if (nmatched[ievt] >= fNMix) break;
+   if (!fIndexedMix || !FindMixingPartners(evVz, evMult, evAngle, matched)) {
+      std::vector<Int_t> nmatched(nEvents, 0);
+      for (ievt = 0; ievt < nEvents; ievt++) matched[ievt].clear();
+
+      for (ievt = 0; ievt < nEvents; ievt++) {
+         if (printNum&&(ievt%printNum==0)) {
+            AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
+            timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
+         }
+         if (nmatched[ievt] >= fNMix) continue;
+         fEvBuffer->GetEntry(ievt);
+         AliRsnMiniEvent evMain(*fMiniEvent);
+         for (iloop = 1; iloop < nEvents; iloop++) {
+            imix = ievt + iloop;
+            if (imix >= nEvents) imix -= nEvents;
+            if (imix == ievt) continue;
+            // text next entry
+            fEvBuffer->GetEntry(imix);
+            // skip if events are not matched
+            if (!EventsMatch(&evMain, fMiniEvent)) continue;
+            // check that the array of good matches for mixed does not already contain main event
+            if (std::find(matched[imix].begin(), matched[imix].end(), ievt) != matched[imix].end()) continue;
+            // check that the found good events has not enough matches already
+            if (nmatched[imix] >= fNMix) continue;
+            // add new mixing candidate
+            matched[ievt].push_back(imix);
+            nmatched[ievt]++;
+            nmatched[imix]++;
+            if (nmatched[ievt] >= fNMix) break;
+         }
+         AliDebugClass(1, Form("Matches for event %5d = %d (missing are declared above)", evMain.ID(), nmatched[ievt]));
       }
-      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", evMain.ID(), nmatched[ievt], smatched[ievt].Data()));
    }
 
    AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout); timer.Start();
 
    // perform mixing
-   TObjArray *list = 0x0;
-   TObjString *os = 0x0;
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       ifill = 0;
+      if (matched[ievt].empty()) continue;
       fEvBuffer->GetEntry(ievt);
       AliRsnMiniEvent evMain(*fMiniEvent);
-      list = smatched[ievt].Tokenize("|");
-      TObjArrayIter next(list);
-      while ( (os = (TObjString *)next()) ) {
-         imix = os->GetString().Atoi();
+      for (UInt_t im = 0; im < matched[ievt].size(); im++) {
+         imix = matched[ievt][im];
          fEvBuffer->GetEntry(imix);
+         for (igroup = 0; igroup < mixGroups.size(); igroup++) {
+            ifill += FillPairGroup(mixGroups[igroup], &evMain, fMiniEvent, kTRUE);
+            if (!((AliRsnMiniOutput *)fHistograms[mixGroups[igroup][0]])->IsSymmetric()) {
+               AliDebugClass(2, "Reflecting non symmetric pair");
+               ifill += FillPairGroup(mixGroups[igroup], fMiniEvent, &evMain, kFALSE);
+            }
+         }
+         if (fSharedPairs) continue;
          for (idef = 0; idef < nDefs; idef++) {
             def = (AliRsnMiniOutput *)fHistograms[idef];
             if (!def) continue;
@@ -620,11 +675,8 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
             }
          }
       }
-      delete list;
    }
 
-   delete [] smatched;
-
    AliInfo(Form("[%s] EventMixing %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout);
 
@@ -1418,33 +1470,35 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
 //
 
    if (!event1 || !event2) return kFALSE;
+   return EventsMatch(event1->Vz(), event1->Mult(), event1->Angle(), event2->Vz(), event2->Mult(), event2->Angle());
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniAnalysisTask::EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const
+{
+//
+// Check if two events are compatible, given their vz, mult and angle
+// (same criteria as the version taking the events).
+//
+
    Int_t ivz1, ivz2, imult1, imult2, iangle1, iangle2;
    Double_t dv, dm, da;
 
    if (fContinuousMix) {
-      dv = TMath::Abs(event1->Vz()    - event2->Vz()   );
-      dm = TMath::Abs(event1->Mult()  - event2->Mult() );
-      da = TMath::Abs(event1->Angle() - event2->Angle());
-      if (dv > fMaxDiffVz) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Vz = %f", event1->ID(), event2->ID(), dv));
-         return kFALSE;
-      }
-      if (dm > fMaxDiffMult ) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Mult = %f", event1->ID(), event2->ID(), dm));
-         return kFALSE;
-      }
-      if (da > fMaxDiffAngle) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Angle = %f", event1->ID(), event2->ID(), da));
-         return kFALSE;
-      }
+      dv = TMath::Abs(vz1    - vz2   );
+      dm = TMath::Abs(mult1  - mult2 );
+      da = TMath::Abs(angle1 - angle2);
+      if (dv > fMaxDiffVz) return kFALSE;
+      if (dm > fMaxDiffMult ) return kFALSE;
+      if (da > fMaxDiffAngle) return kFALSE;
       return kTRUE;
    } else {
-      ivz1 = (Int_t)(event1->Vz() / fMaxDiffVz);
-      ivz2 = (Int_t)(event2->Vz() / fMaxDiffVz);
-      imult1 = (Int_t)(event1->Mult() / fMaxDiffMult);
-      imult2 = (Int_t)(event2->Mult() / fMaxDiffMult);
-      iangle1 = (Int_t)(event1->Angle() / fMaxDiffAngle);
-      iangle2 = (Int_t)(event2->Angle() / fMaxDiffAngle);
+      ivz1 = (Int_t)(vz1 / fMaxDiffVz);
+      ivz2 = (Int_t)(vz2 / fMaxDiffVz);
+      imult1 = (Int_t)(mult1 / fMaxDiffMult);
+      imult2 = (Int_t)(mult2 / fMaxDiffMult);
+      iangle1 = (Int_t)(angle1 / fMaxDiffAngle);
+      iangle2 = (Int_t)(angle2 / fMaxDiffAngle);
       if (ivz1 != ivz2) return kFALSE;
       if (imult1 != imult2) return kFALSE;
       if (iangle1 != iangle2) return kFALSE;
@@ -1452,6 +1506,210 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
    }
 }
 
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniAnalysisTask::FindMixingPartners(const std::vector<Float_t> &vz, const std::vector<Float_t> &mult, const std::vector<Float_t> &angle, std::vector< std::vector<Int_t> > &matched) const
+{
+//
+// Search the events to be mixed with each buffered event, using only their vz, mult and angle.
+// The events are put in cells of the size of the allowed differences, so that the candidates
+// of each event are searched only in its cell (binned mixing) or also in the neighbouring ones
+// (continuous mixing), instead of the whole buffer.
+// The candidates are then taken in the same order and with the same conditions as the scan
+// in FinishTaskOutput(), so that the same pairs are found.
+// Returns kFALSE if the allowed differences do not permit to define the cells.
+//
+
+   if (fMaxDiffVz <= 0.0 || fMaxDiffMult <= 0.0 || fMaxDiffAngle <= 0.0) return kFALSE;
+
+   Int_t nEvents = vz.size();
+   if ((Int_t)mult.size() != nEvents || (Int_t)angle.size() != nEvents) return kFALSE;
+
+   // cell of each event: in continuous mode the cells are slightly larger than the allowed
+   // differences, so that all matching events are in the same or in the neighbouring cells
+   Double_t scale = fContinuousMix ? 1.001 : 1.0;
+   Double_t size[3] = {scale * fMaxDiffVz, scale * fMaxDiffMult, scale * fMaxDiffAngle};
+   typedef std::vector<Long64_t> CellKey;
+   std::vector<CellKey> cellOf(nEvents, CellKey(3));
+   std::map<CellKey, std::vector<Int_t> > cells;
+   Int_t ievt, imix, icell, idim;
+   for (ievt = 0; ievt < nEvents; ievt++) {
+      Float_t values[3] = {vz[ievt], mult[ievt], angle[ievt]};
+      for (idim = 0; idim < 3; idim++) {
+         // undefined values are left to the scan of all the events
+         if (!TMath::Finite(values[idim]) || TMath::Abs(values[idim] / size[idim]) > 1E9) return kFALSE;
+         if (fContinuousMix)
+            cellOf[ievt][idim] = (Long64_t)TMath::Floor(values[idim] / size[idim]);
+         else
+            cellOf[ievt][idim] = (Long64_t)(Int_t)(values[idim] / size[idim]);
+      }
+      cells[cellOf[ievt]].push_back(ievt);
+   }
+
+   Int_t nNeighbours = fContinuousMix ? 27 : 1;
+   std::vector<Int_t> nmatched(nEvents, 0);
+   std::vector< std::pair<Int_t, Int_t> > ordered;
+   for (ievt = 0; ievt < nEvents; ievt++) {
+      matched[ievt].clear();
+      if (nmatched[ievt] >= fNMix) continue;
+
+      // collect the matching events of the cell and of its neighbours,
+      // ordered as in the cyclic scan starting from the next event
+      ordered.clear();
+      for (icell = 0; icell < nNeighbours; icell++) {
+         CellKey key(cellOf[ievt]);
+         if (fContinuousMix) {
+            key[0] += icell % 3 - 1;
+            key[1] += (icell / 3) % 3 - 1;
+            key[2] += icell / 9 - 1;
+         }
+         std::map<CellKey, std::vector<Int_t> >::const_iterator it = cells.find(key);
+         if (it == cells.end()) continue;
+         const std::vector<Int_t> &events = it->second;
+         for (UInt_t i = 0; i < events.size(); i++) {
+            imix = events[i];
+            if (imix == ievt) continue;
+            if (nmatched[imix] >= fNMix) continue;
+            if (!EventsMatch(vz[ievt], mult[ievt], angle[ievt], vz[imix], mult[imix], angle[imix])) continue;
+            ordered.push_back(std::make_pair((imix - ievt + nEvents) % nEvents, imix));
+         }
+      }
+      std::sort(ordered.begin(), ordered.end());
+
+      for (UInt_t i = 0; i < ordered.size(); i++) {
+         imix = ordered[i].second;
+         // check that the array of good matches for mixed does not already contain main event
+         if (std::find(matched[imix].begin(), matched[imix].end(), ievt) != matched[imix].end()) continue;
+         // check that the found good events has not enough matches already
+         if (nmatched[imix] >= fNMix) continue;
+         // add new mixing candidate
+         matched[ievt].push_back(imix);
+         nmatched[ievt]++;
+         nmatched[imix]++;
+         if (nmatched[ievt] >= fNMix) break;
+      }
+      AliDebugClass(1, Form("Matches for event %5d = %d", ievt, nmatched[ievt]));
+   }
+
+   return kTRUE;
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::GroupPairOutputs(std::vector< std::vector<Int_t> > &sameEvent, std::vector< std::vector<Int_t> > &mixing)
+{
+//
+// Groups the pair-based outputs which loop on the same pairs with the same kinematics:
+// same charge, cut ID and species of the two daughters, same reference mass
+// and same treatment of the pair (unchanged, rotated first or rotated second daughter).
+// Outputs of same-event pairs (also true pairs) and of mixed pairs are put in separate groups.
+//
+
+   sameEvent.clear();
+   mixing.clear();
+
+   Int_t idef, nDefs = fHistograms.GetEntries(), nPairDefs = 0;
+   std::vector<Int_t> kinds(nDefs, -1);
+   for (idef = 0; idef < nDefs; idef++) {
+      AliRsnMiniOutput *def = (AliRsnMiniOutput *)fHistograms[idef];
+      if (!def) continue;
+      // treatment of the pair
+      Int_t kind;
+      switch (def->GetComputation()) {
+         case AliRsnMiniOutput::kTrackPair:
+         case AliRsnMiniOutput::kTruePair:          kind = 0; break;
+         case AliRsnMiniOutput::kTrackPairRotated1: kind = 1; break;
+         case AliRsnMiniOutput::kTrackPairRotated2: kind = 2; break;
+         case AliRsnMiniOutput::kTrackPairMix:      kind = 3; break;
+         default: continue;
+      }
+      std::vector< std::vector<Int_t> > &groups = (kind == 3 ? mixing : sameEvent);
+      UInt_t igroup;
+      for (igroup = 0; igroup < groups.size(); igroup++) {
+         AliRsnMiniOutput *ref = (AliRsnMiniOutput *)fHistograms[groups[igroup][0]];
+         if (kinds[groups[igroup][0]] != kind) continue;
+         if (ref->GetCharge(0) != def->GetCharge(0) || ref->GetCharge(1) != def->GetCharge(1)) continue;
+         if (ref->GetCutID(0) != def->GetCutID(0) || ref->GetCutID(1) != def->GetCutID(1)) continue;
+         if (ref->GetDaughter(0) != def->GetDaughter(0) || ref->GetDaughter(1) != def->GetDaughter(1)) continue;
+         if (ref->GetMotherMass() != def->GetMotherMass()) continue;
+         break;
+      }
+      if (igroup == groups.size()) groups.push_back(std::vector<Int_t>());
+      groups[igroup].push_back(idef);
+      kinds[idef] = kind;
+      nPairDefs++;
+   }
+
+   AliInfo(Form("[%s] %d pair outputs in %d same-event and %d mixing groups", GetName(), nPairDefs, (Int_t)sameEvent.size(), (Int_t)mixing.size()));
+}
+
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniAnalysisTask::FillPairGroup(const std::vector<Int_t> &group, AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, Bool_t refFirst)
+{
+//
+// Same as AliRsnMiniOutput::FillPair() for all the outputs of a group made by GroupPairOutputs():
+// the selection of the daughters and the pair kinematics are computed once,
+// then each output applies its own checks and pair cuts, and the values used in its axes,
+// which are computed once per pair for all the outputs, are filled in its histogram.
+// Returns the number of successful fillings.
+//
+
+   if (group.empty()) return 0;
+   AliRsnMiniOutput *ref = (AliRsnMiniOutput *)fHistograms[group[0]];
+
+   Bool_t sameCriteria = ((ref->GetCharge(0) == ref->GetCharge(1)) && (ref->GetDaughter(0) == ref->GetDaughter(1)));
+   Bool_t sameEvent = (event1->ID() == event2->ID());
+
+   Int_t n1 = event1->CountParticles(fSharedSel1, (Char_t)ref->GetCharge(0), ref->GetCutID(0));
+   Int_t n2 = event2->CountParticles(fSharedSel2, (Char_t)ref->GetCharge(1), ref->GetCutID(1));
+   if (!n1 || !n2) return 0;
+
+   AliRsnMiniOutput::EComputation comp = ref->GetComputation();
+   Double_t mass1 = ref->GetMass(0), mass2 = ref->GetMass(1), refMass = ref->GetMotherMass();
+   AliRsnMiniEvent *refEvent = (refFirst ? event1 : event2);
+
+   Int_t nval = fValues.GetEntries();
+   if (fSharedValues.GetSize() < nval) fSharedValues.Set(nval);
+   fSharedValueDone.Set(nval);
+   fSharedValueDone.Reset(-1);
+
+   Int_t i1, i2, start, ival, iax, nax, npair = 0, nadded = 0;
+   UInt_t iout;
+   AliRsnMiniParticle *p1, *p2;
+   for (i1 = 0; i1 < n1; i1++) {
+      p1 = event1->GetParticle(fSharedSel1[i1]);
+      start = ((sameEvent && sameCriteria) ? i1 + 1 : 0);
+      for (i2 = start; i2 < n2; i2++) {
+         p2 = event2->GetParticle(fSharedSel2[i2]);
+         // avoid to mix a particle with itself
+         if (sameEvent && (p1->Index() == p2->Index())) continue;
+         // sum momenta
+         fSharedPair.Fill(p1, p2, mass1, mass2, refMass);
+         // do rotation if needed
+         if (comp == AliRsnMiniOutput::kTrackPairRotated1) fSharedPair.InvertP(kTRUE);
+         if (comp == AliRsnMiniOutput::kTrackPairRotated2) fSharedPair.InvertP(kFALSE);
+         npair++;
+         for (iout = 0; iout < group.size(); iout++) {
+            AliRsnMiniOutput *def = (AliRsnMiniOutput *)fHistograms[group[iout]];
+            if (!def->AcceptPair(&fSharedPair, p1, p2)) continue;
+            // compute the values not yet computed for this pair
+            nax = def->GetNAxes();
+            for (iax = 0; iax < nax; iax++) {
+               AliRsnMiniAxis *axis = def->GetAxis(iax);
+               if (!axis) continue;
+               ival = axis->GetValueID();
+               if (ival < 0 || ival >= nval || fSharedValueDone[ival] == npair) continue;
+               AliRsnMiniValue *val = (AliRsnMiniValue *)fValues[ival];
+               fSharedValues[ival] = (val ? val->Eval(&fSharedPair, refEvent) : 1E20);
+               fSharedValueDone[ival] = npair;
+            }
+            def->FillValues(fSharedValues.GetArray(), nval);
+            nadded++;
+         }
+      }
+   }
+
+   return nadded;
+}
+
 //---------------------------------------------------------------------
 Double_t AliRsnMiniAnalysisTask::ApplyCentralityPatchPbPb2011(){
   //This part rejects randomly events such that the centrality gets flat for LHC11h Pb-Pb data
@@ -12,13 +12,18 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 //
 
+#include <vector>
+
 #include <TString.h>
 #include <TClonesArray.h>
+#include <TArrayD.h>
+#include <TArrayI.h>
 
 #include "AliAnalysisTaskSE.h"
 
 #include "AliRsnEvent.h"
 #include "AliRsnMiniValue.h"
+#include "AliRsnMiniPair.h"
 #include "AliRsnMiniOutput.h"
 #include "AliRsnCutEventUtils.h"
 #include "AliRsnCutPrimaryVertex.h"
@@ -53,6 +58,8 @@ public:
    void                UseMultiplicity(const char *type)  {fUseCentrality = kFALSE; fCentralityType = type; if(!fCentralityType.Contains("AliMultSelection")) fCentralityType.ToUpper();}
    void                UseContinuousMix()                 {fContinuousMix = kTRUE;}
    void                UseBinnedMix()                     {fContinuousMix = kFALSE;}
+   void                UseIndexedMix(Bool_t yn = kTRUE)   {fIndexedMix = yn;}
+   void                UseSharedPairs(Bool_t yn = kTRUE)  {fSharedPairs = yn;}
    void                SetNMix(Int_t nmix)                {fNMix = nmix;}
    void                SetMaxDiffMult (Double_t val)      {fMaxDiffMult  = val;}
    void                SetMaxDiffVz   (Double_t val)      {fMaxDiffVz    = val;}
@@ -99,6 +106,10 @@ private:
    void     FillTrueMotherAOD(AliRsnMiniEvent *event);
    void     StoreTrueMother(AliRsnMiniPair *pair, AliRsnMiniEvent *event);
    Bool_t   EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2);
+   Bool_t   EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const;
+   Bool_t   FindMixingPartners(const std::vector<Float_t> &vz, const std::vector<Float_t> &mult, const std::vector<Float_t> &angle, std::vector< std::vector<Int_t> > &matched) const;
+   void     GroupPairOutputs(std::vector< std::vector<Int_t> > &sameEvent, std::vector< std::vector<Int_t> > &mixing);
+   Int_t    FillPairGroup(const std::vector<Int_t> &group, AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, Bool_t refFirst = kTRUE);
    AliQnCorrectionsQnVector * GetQnVectorFromList(const TList *list,
                                                         const char *subdetector,
                                                         const char *expectedstep) const;
@@ -118,6 +129,7 @@ private:
 
    Bool_t               fContinuousMix;   //  mixing --> technique chosen (continuous or binned)
    Int_t                fNMix;            //  mixing --> required number of mixes
+   Bool_t               fIndexedMix;      //  mixing --> search the partners in an index of the buffered events
    Double_t             fMaxDiffMult;     //  mixing --> max difference in multiplicity
    Double_t             fMaxDiffVz;       //  mixing --> max difference in Vz of prim vert
    Double_t             fMaxDiffAngle;    //  mixing --> max difference in reaction plane angle
@@ -154,7 +166,14 @@ private:
    Float_t              fMotherAcceptanceCutMaxEta;             // cut value to apply when selecting the mothers inside a defined acceptance
    Bool_t               fKeepMotherInAcceptance;                // flag to keep also mothers in acceptance
 
-   ClassDef(AliRsnMiniAnalysisTask, 13);   // AliRsnMiniAnalysisTask
+   Bool_t               fSharedPairs;     //  compute the pairs once for all the outputs with the same daughter definitions
+   AliRsnMiniPair       fSharedPair;      //! pair shared by the outputs of a group
+   TArrayI              fSharedSel1;      //! selected particles for the first daughter of a group
+   TArrayI              fSharedSel2;      //! selected particles for the second daughter of a group
+   TArrayD              fSharedValues;    //! values computed for the current shared pair
+   TArrayI              fSharedValueDone; //! pair counter at which each value was last computed
+
+   ClassDef(AliRsnMiniAnalysisTask, 15);   // AliRsnMiniAnalysisTask
 };
 
 
@@ -547,30 +547,50 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
          // do rotation if needed
          if (fComputation == kTrackPairRotated1) fPair.InvertP(kTRUE);
          if (fComputation == kTrackPairRotated2) fPair.InvertP(kFALSE);
-         // if required, check that this is a true pair
-         if (fComputation == kTruePair) {
-            if (fPair.Mother() < 0)  {
-               continue;
-            } else if (fPair.MotherPDG() != fMotherPDG) {
-               continue;
-            }
-            Bool_t decayMatch = kFALSE;
-            if (p1->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[0]) && p2->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[1]))
-               decayMatch = kTRUE;
-            if (p2->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[0]) && p1->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[1]))
-               decayMatch = kTRUE;
-            if (!decayMatch) continue;
-	    if ( (fMaxNSisters>0) && (p1->NTotSisters()==p2->NTotSisters()) && (p1->NTotSisters()>fMaxNSisters)) continue;
-	    if ( fCheckP &&(TMath::Abs(fPair.PmotherX()-(p1->Px(1)+p2->Px(1)))/(TMath::Abs(fPair.PmotherX())+1.e-13)) > 0.00001 && 	  
-		          (TMath::Abs(fPair.PmotherY()-(p1->Py(1)+p2->Py(1)))/(TMath::Abs(fPair.PmotherY())+1.e-13)) > 0.00001 &&
-     			  (TMath::Abs(fPair.PmotherZ()-(p1->Pz(1)+p2->Pz(1)))/(TMath::Abs(fPair.PmotherZ())+1.e-13)) > 0.00001 ) continue;
+         // check that the pair is a true one (if required) and passes the pair cuts
+         if (!AcceptPair(&fPair, p1, p2)) continue;
+         // get computed values & fill histogram
+         nadded++;
+         if (refFirst) ComputeValues(event1, valueList); else ComputeValues(event2, valueList);
+         FillHistogram();
+      } // end internal loop
+   } // end external loop
+
+   AliDebugClass(1, Form("Pairs added in total = %4d", nadded));
+   return nadded;
+}
+//___________________________________________________________
+Bool_t AliRsnMiniOutput::AcceptPair(AliRsnMiniPair *pair, AliRsnMiniParticle *p1, AliRsnMiniParticle *p2)
+{
+//
+// Checks done on a pair filled from the two particles, before filling the output:
+// if required, that this is a true pair, then the pair cuts.
+//
+
+   // if required, check that this is a true pair
+   if (fComputation == kTruePair) {
+      if (pair->Mother() < 0)  {
+         return kFALSE;
+      } else if (pair->MotherPDG() != fMotherPDG) {
+         return kFALSE;
+      }
+      Bool_t decayMatch = kFALSE;
+      if (p1->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[0]) && p2->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[1]))
+         decayMatch = kTRUE;
+      if (p2->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[0]) && p1->PDGAbs() == AliRsnDaughter::SpeciesPDG(fDaughter[1]))
+         decayMatch = kTRUE;
+      if (!decayMatch) return kFALSE;
+	    if ( (fMaxNSisters>0) && (p1->NTotSisters()==p2->NTotSisters()) && (p1->NTotSisters()>fMaxNSisters)) return kFALSE;
+	    if ( fCheckP &&(TMath::Abs(pair->PmotherX()-(p1->Px(1)+p2->Px(1)))/(TMath::Abs(pair->PmotherX())+1.e-13)) > 0.00001 && 	  
+		          (TMath::Abs(pair->PmotherY()-(p1->Py(1)+p2->Py(1)))/(TMath::Abs(pair->PmotherY())+1.e-13)) > 0.00001 &&
+  			  (TMath::Abs(pair->PmotherZ()-(p1->Pz(1)+p2->Pz(1)))/(TMath::Abs(pair->PmotherZ())+1.e-13)) > 0.00001 ) return kFALSE;
 	    if ( fCheckFeedDown ){
 	    		Int_t pdgGranma = 0;
 	  		Bool_t isFromB=kFALSE;
 	  		Bool_t isQuarkFound=kFALSE;
 			
-			if(fPair.IsFromB() == kTRUE) isFromB = kTRUE;
-			if(fPair.IsQuarkFound() == kTRUE) isQuarkFound = kTRUE;
+			if(pair->IsFromB() == kTRUE) isFromB = kTRUE;
+			if(pair->IsQuarkFound() == kTRUE) isQuarkFound = kTRUE;
 	  		if(fRejectIfNoQuark && !isQuarkFound) pdgGranma = -99999;
 	  		if(isFromB){
 	  		  if (!fKeepDfromB) pdgGranma = -9999; //skip particle if come from a B meson.
@@ -580,33 +600,56 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
 			  } 
 	  		if (pdgGranma == -99999){
 	  			AliDebug(2,"This particle does not have a quark in his genealogy\n");
-	  			continue;
+	  			return kFALSE;
 	  		}
 	  		if (pdgGranma == -9999){
 	  			AliDebug(2,"This particle come from a B decay channel but according to the settings of the task, we keep only the prompt charm particles\n");	
-	  			continue;
+	  			return kFALSE;
 	  		}	
 	 
 	  		if (pdgGranma == -999){
 	  			AliDebug(2,"This particle come from a prompt charm particles but according to the settings of the task, we want only the ones coming from B\n");  
-	  			continue;
+	  			return kFALSE;
 	  		}	
 		    }
-         }
-         // check pair against cuts
-         if (fPairCuts) {
-            if (!fPairCuts->IsSelected(&fPair)) continue;
-         }
-         // get computed values & fill histogram
-         nadded++;
-         if (refFirst) ComputeValues(event1, valueList); else ComputeValues(event2, valueList);
-         FillHistogram();
-      } // end internal loop
-   } // end external loop
+   }
+   // check pair against cuts
+   if (fPairCuts) {
+      if (!fPairCuts->IsSelected(pair)) return kFALSE;
+   }
+   return kTRUE;
+}
 
-   AliDebugClass(1, Form("Pairs added in total = %4d", nadded));
-   return nadded;
+//___________________________________________________________
+void AliRsnMiniOutput::FillValues(const Double_t *values, Int_t nval)
+{
+//
+// Fills the output with values which are already computed for the current pair,
+// stored in the passed array at the position of their ID in the value list
+// (the ones not used in the axes of this output are not accessed).
+//
+
+   Int_t i, ival, size = fAxes.GetEntries();
+   if (fComputed.GetSize() != size) fComputed.Set(size);
+
+   for (i = 0; i < size; i++) {
+      fComputed[i] = 1E20;
+      AliRsnMiniAxis *axis = (AliRsnMiniAxis *)fAxes[i];
+      if (!axis) {
+         AliError("Null axis");
+         continue;
+      }
+      ival = axis->GetValueID();
+      if (ival < 0 || ival >= nval) {
+         AliError(Form("Required value #%d, while maximum is %d", ival, nval));
+         continue;
+      }
+      fComputed[i] = values[ival];
+   }
+
+   FillHistogram();
 }
+
 //___________________________________________________________
 void AliRsnMiniOutput::SetDselection(UShort_t originDselection)
 {
@@ -96,6 +96,7 @@ public:
    void            AddAxis(Int_t id, Int_t nbins, Double_t min, Double_t max);
    void            AddAxis(Int_t id, Double_t min, Double_t max, Double_t step);
    void            AddAxis(Int_t id, Int_t nbins, Double_t *values);
+   Int_t           GetNAxes()        {return fAxes.GetEntries();}
    AliRsnMiniAxis *GetAxis(Int_t i)  {if (i >= 0 && i < fAxes.GetEntries()) return (AliRsnMiniAxis *)fAxes[i]; return 0x0;}
    Double_t       *GetAllComputed()  {return fComputed.GetArray();}
 
@@ -105,6 +106,8 @@ public:
    Bool_t          FillMotherInAcceptance(const AliRsnMiniPair *pair, AliRsnMiniEvent *event, TClonesArray *valueList);
    Bool_t          FillEvent(AliRsnMiniEvent *event, TClonesArray *valueList);
    Int_t           FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2, TClonesArray *valueList, Bool_t refFirst = kTRUE);
+   Bool_t          AcceptPair(AliRsnMiniPair *pair, AliRsnMiniParticle *p1, AliRsnMiniParticle *p2);
+   void            FillValues(const Double_t *values, Int_t nval);
 
 private:
 
@@ -111,6 +111,7 @@ class AliAODv0;
 #include "AliEventCuts.h"
 #include "AliV0Result.h"
 #include "AliCascadeResult.h"
+#include "AliWeakResultMatcher.h"
 #include "AliAnalysisTaskStrangenessVsMultiplicityRun2.h"
 
 using std::cout;
@@ -118,6 +119,44 @@ using std::endl;
 
 ClassImp(AliAnalysisTaskStrangenessVsMultiplicityRun2)
 
+namespace {
+    //Threshold cuts and flags of the configuration matchers (see BuildConfigurationMatchers)
+    enum EV0MatcherCut {
+        kV0MinEta = 0, kV0MaxEta, kV0Radius, kV0DCANegToPV, kV0DCAPosToPV, kV0DCAV0Daughters, kV0CosPA,
+        kV0ProperLifetime, kV0CrossedRows, kV0CrossedRowsOverFindable, kV0MinBaryonMomentum, kV0TPCdEdx,
+        kV0MaxChi2PerCluster, kV0MinTrackLength, kV0NCuts
+    };
+    enum EV0MatcherFlag { kV0Armenteros = 0, kV0ITSRefit, kV0NFlags };
+    const AliWeakResultMatcher::ECutType kV0CutTypes[kV0NCuts] = {
+        AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kUpperCut, AliWeakResultMatcher::kLowerCut,
+        AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kUpperCut,
+        AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kUpperCut, AliWeakResultMatcher::kLowerCut,
+        AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kUpperCut,
+        AliWeakResultMatcher::kUpperCut, AliWeakResultMatcher::kLowerCut
+    };
+    enum ECascMatcherCut {
+        kCascMinEta = 0, kCascMaxEta, kCascDCANegToPV, kCascDCAPosToPV, kCascDCAV0Daughters, kCascV0CosPA,
+        kCascV0Radius, kCascDCAV0ToPV, kCascV0Mass, kCascDCABachToPV, kCascDCACascDaughters, kCascCascCosPA,
+        kCascCascRadius, kCascProperLifetime, kCascLeastNbrClusters, kCascTPCdEdx, kCascXiRejection,
+        kCascDCABachToBaryon, kCascBachBaryonCosPA, kCascMinV0Lifetime, kCascMaxV0Lifetime,
+        kCascMaxChi2PerCluster, kCascMinTrackLength, kCascNCuts
+    };
+    enum ECascMatcherFlag { kCascITSRefit = 0, kCascNFlags };
+    const AliWeakResultMatcher::ECutType kCascCutTypes[kCascNCuts] = {
+        AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kUpperCut, AliWeakResultMatcher::kLowerCut,
+        AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kUpperCut, AliWeakResultMatcher::kLowerCut,
+        AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kUpperCut,
+        AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kUpperCut, AliWeakResultMatcher::kLowerCut,
+        AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kUpperCut, AliWeakResultMatcher::kLowerCut,
+        AliWeakResultMatcher::kUpperCut, AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kLowerCut,
+        AliWeakResultMatcher::kUpperCut, AliWeakResultMatcher::kLowerCut, AliWeakResultMatcher::kUpperCut,
+        AliWeakResultMatcher::kUpperCut, AliWeakResultMatcher::kLowerCut
+    };
+    //Smallest/largest of two values, NaN if any of them is NaN (so that no cut is passed, as in the sweep)
+    Double_t MinOrNaN( Double_t a, Double_t b ) { return ( a != a || b != b ) ? a + b : TMath::Min( a, b ); }
+    Double_t MaxOrNaN( Double_t a, Double_t b ) { return ( a != a || b != b ) ? a + b : TMath::Max( a, b ); }
+}
+
 AliAnalysisTaskStrangenessVsMultiplicityRun2::AliAnalysisTaskStrangenessVsMultiplicityRun2()
     : AliAnalysisTaskSE(), fListHist(0), fListV0(0), fListCascade(0), fTreeEvent(0), fTreeV0(0), fTreeCascade(0), fPIDResponse(0), fESDtrackCuts(0), fESDtrackCutsITSsa2010(0), fESDtrackCutsGlobal2015(0), fUtils(0), fRand(0),
 
@@ -145,6 +184,8 @@ fkRunVertexers    ( kFALSE ),
 fkUseLightVertexer ( kTRUE ),
 fkDoV0Refit       ( kTRUE ),
 fkExtraCleanup    ( kTRUE ),
+fkUseConfigurationMatcher ( kFALSE ),
+fMatchedConfigurations(),
 
 //---> Flag controlling trigger selection
 fTrigType(AliVEvent::kMB),
@@ -300,7 +341,8 @@ fHistCentrality(0)
 //------------------------------------------------
 // Tree Variables
 {
-
+    for(Int_t ih=0; ih<3; ih++) fV0Matcher[ih] = 0x0;
+    for(Int_t ih=0; ih<4; ih++) fCascadeMatcher[ih] = 0x0;
 }
 
 AliAnalysisTaskStrangenessVsMultiplicityRun2::AliAnalysisTaskStrangenessVsMultiplicityRun2(Bool_t lSaveEventTree, Bool_t lSaveV0Tree, Bool_t lSaveCascadeTree, const char *name, TString lExtraOptions)
@@ -330,6 +372,8 @@ fkRunVertexers    ( kFALSE ),
 fkUseLightVertexer ( kTRUE ),
 fkDoV0Refit       ( kTRUE ),
 fkExtraCleanup    ( kTRUE ),
+fkUseConfigurationMatcher ( kFALSE ),
+fMatchedConfigurations(),
 
 //---> Flag controlling trigger selection
 fTrigType(AliVEvent::kMB),
@@ -482,6 +526,8 @@ fTreeCascVarMVPileupFlag(kFALSE),
 fHistEventCounter(0),
 fHistCentrality(0)
 {
+    for(Int_t ih=0; ih<3; ih++) fV0Matcher[ih] = 0x0;
+    for(Int_t ih=0; ih<4; ih++) fCascadeMatcher[ih] = 0x0;
 
     //Re-vertex: Will only apply for cascade candidates
 
@@ -569,6 +615,14 @@ AliAnalysisTaskStrangenessVsMultiplicityRun2::~AliAnalysisTaskStrangenessVsMulti
         delete fRand;
         fRand = 0x0;
     }
+    for(Int_t ih=0; ih<3; ih++) {
+        delete fV0Matcher[ih];
+        fV0Matcher[ih] = 0x0;
+    }
+    for(Int_t ih=0; ih<4; ih++) {
+        delete fCascadeMatcher[ih];
+        fCascadeMatcher[ih] = 0x0;
+    }
 }
 
 //________________________________________________________________________
@@ -823,6 +877,9 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserCreateOutputObjects()
         fListCascade->SetOwner();
     }
 
+    //Superlight mode: threshold tables of the configurations
+    if ( fkUseConfigurationMatcher ) BuildConfigurationMatchers();
+
     //Regular Output: Slots 1, 2, 3
     PostData(1, fListHist    );
     PostData(2, fListV0      );
@@ -1289,7 +1346,9 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
         //Step 1: Sweep members of the output object TList and fill all of them as appropriate
-        Int_t lNumberOfConfigurations = fListV0->GetEntries();
+        //(with the configuration matcher: fill only the ones passed by this candidate)
+        if ( fkUseConfigurationMatcher ) FillMatchedV0Configurations( lOnFlyStatus );
+        Int_t lNumberOfConfigurations = fkUseConfigurationMatcher ? 0 : fListV0->GetEntries();
         //AliWarning(Form("[V0 Analyses] Processing different configurations (%i detected)",lNumberOfConfigurations));
         TH3F *histoout         = 0x0;
         AliV0Result *lV0Result = 0x0;
@@ -1962,7 +2021,9 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
         //Step 1: Sweep members of the output object TList and fill all of them as appropriate
-        Int_t lNumberOfConfigurationsCascade = fListCascade->GetEntries();
+        //(with the configuration matcher: fill only the ones passed by this candidate)
+        if ( fkUseConfigurationMatcher ) FillMatchedCascadeConfigurations();
+        Int_t lNumberOfConfigurationsCascade = fkUseConfigurationMatcher ? 0 : fListCascade->GetEntries();
         //AliWarning(Form("[Cascade Analyses] Processing different configurations (%i detected)",lNumberOfConfigurationsCascade));
         TH3F *histoout         = 0x0;
         AliCascadeResult *lCascadeResult = 0x0;
@@ -2217,6 +2278,276 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::AddConfiguration( AliCascadeR
     fListCascade->Add(lCascadeResult);
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildConfigurationMatchers()
+{
+    //Sort the cuts of all configurations into threshold tables, one per mass hypothesis,
+    //to be used by FillMatchedV0Configurations / FillMatchedCascadeConfigurations
+    //Cuts depending on the candidate pT (variable CosPA) are checked afterwards,
+    //only for the configurations passing all the others
+    for(Int_t ih=0; ih<3; ih++) {
+        delete fV0Matcher[ih];
+        fV0Matcher[ih] = new AliWeakResultMatcher(kV0NCuts, kV0CutTypes, kV0NFlags);
+    }
+    for(Int_t ih=0; ih<4; ih++) {
+        delete fCascadeMatcher[ih];
+        fCascadeMatcher[ih] = new AliWeakResultMatcher(kCascNCuts, kCascCutTypes, kCascNFlags);
+    }
+
+    Int_t lNumberOfConfigurations = fListV0 ? fListV0->GetEntries() : 0;
+    for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+        AliV0Result *lV0Result = (AliV0Result*) fListV0->At(lcfg);
+        Int_t ih = lV0Result->GetMassHypothesis();
+        if( ih<0 || ih>=3 ) continue;
+        AliWeakResultMatcher *lMatcher = fV0Matcher[ih];
+        Int_t lPos = lMatcher->AddConfiguration( lcfg );
+        lMatcher->SetCut( lPos, kV0MinEta,           lV0Result->GetCutMinEtaTracks() );
+        lMatcher->SetCut( lPos, kV0MaxEta,           lV0Result->GetCutMaxEtaTracks() );
+        lMatcher->SetCut( lPos, kV0Radius,           lV0Result->GetCutV0Radius() );
+        lMatcher->SetCut( lPos, kV0DCANegToPV,       lV0Result->GetCutDCANegToPV() );
+        lMatcher->SetCut( lPos, kV0DCAPosToPV,       lV0Result->GetCutDCAPosToPV() );
+        lMatcher->SetCut( lPos, kV0DCAV0Daughters,   lV0Result->GetCutDCAV0Daughters() );
+        lMatcher->SetCut( lPos, kV0CosPA,            (Float_t) lV0Result->GetCutV0CosPA() );
+        lMatcher->SetCut( lPos, kV0ProperLifetime,   lV0Result->GetCutProperLifetime() );
+        lMatcher->SetCut( lPos, kV0CrossedRows,      lV0Result->GetCutLeastNumberOfCrossedRows() );
+        lMatcher->SetCut( lPos, kV0CrossedRowsOverFindable, lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() );
+        if( ih != AliV0Result::kK0Short )
+            lMatcher->SetCut( lPos, kV0MinBaryonMomentum, lV0Result->GetCutMinBaryonMomentum() );
+        lMatcher->SetCut( lPos, kV0TPCdEdx,          lV0Result->GetCutTPCdEdx() );
+        lMatcher->SetCut( lPos, kV0MaxChi2PerCluster, lV0Result->GetCutMaxChi2PerCluster() );
+        lMatcher->SetCut( lPos, kV0MinTrackLength,   lV0Result->GetCutMinTrackLength() );
+        lMatcher->SetFlag( lPos, kV0Armenteros, ih == AliV0Result::kK0Short && lV0Result->GetCutArmenteros() );
+        lMatcher->SetFlag( lPos, kV0ITSRefit,   lV0Result->GetCutUseITSRefitTracks() );
+    }
+
+    Int_t lNumberOfConfigurationsCascade = fListCascade ? fListCascade->GetEntries() : 0;
+    for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
+        AliCascadeResult *lCascadeResult = (AliCascadeResult*) fListCascade->At(lcfg);
+        Int_t ih = lCascadeResult->GetMassHypothesis();
+        if( ih<0 || ih>=4 ) continue;
+        AliWeakResultMatcher *lMatcher = fCascadeMatcher[ih];
+        Int_t lPos = lMatcher->AddConfiguration( lcfg );
+        lMatcher->SetCut( lPos, kCascMinEta,            lCascadeResult->GetCutMinEtaTracks() );
+        lMatcher->SetCut( lPos, kCascMaxEta,            lCascadeResult->GetCutMaxEtaTracks() );
+        lMatcher->SetCut( lPos, kCascDCANegToPV,        lCascadeResult->GetCutDCANegToPV() );
+        lMatcher->SetCut( lPos, kCascDCAPosToPV,        lCascadeResult->GetCutDCAPosToPV() );
+        lMatcher->SetCut( lPos, kCascDCAV0Daughters,    lCascadeResult->GetCutDCAV0Daughters() );
+        lMatcher->SetCut( lPos, kCascV0CosPA,           (Float_t) lCascadeResult->GetCutV0CosPA() );
+        lMatcher->SetCut( lPos, kCascV0Radius,          lCascadeResult->GetCutV0Radius() );
+        lMatcher->SetCut( lPos, kCascDCAV0ToPV,         lCascadeResult->GetCutDCAV0ToPV() );
+        lMatcher->SetCut( lPos, kCascV0Mass,            lCascadeResult->GetCutV0Mass() );
+        lMatcher->SetCut( lPos, kCascDCABachToPV,       lCascadeResult->GetCutDCABachToPV() );
+        lMatcher->SetCut( lPos, kCascDCACascDaughters,  lCascadeResult->GetCutDCACascDaughters() );
+        lMatcher->SetCut( lPos, kCascCascCosPA,         (Float_t) lCascadeResult->GetCutCascCosPA() );
+        lMatcher->SetCut( lPos, kCascCascRadius,        lCascadeResult->GetCutCascRadius() );
+        lMatcher->SetCut( lPos, kCascProperLifetime,    lCascadeResult->GetCutProperLifetime() );
+        lMatcher->SetCut( lPos, kCascLeastNbrClusters,  lCascadeResult->GetCutLeastNumberOfClusters() );
+        lMatcher->SetCut( lPos, kCascTPCdEdx,           lCascadeResult->GetCutTPCdEdx() );
+        if( ih == AliCascadeResult::kOmegaMinus || ih == AliCascadeResult::kOmegaPlus )
+            lMatcher->SetCut( lPos, kCascXiRejection,   lCascadeResult->GetCutXiRejection() );
+        lMatcher->SetCut( lPos, kCascDCABachToBaryon,   lCascadeResult->GetCutDCABachToBaryon() );
+        lMatcher->SetCut( lPos, kCascBachBaryonCosPA,   lCascadeResult->GetCutBachBaryonCosPA() );
+        lMatcher->SetCut( lPos, kCascMinV0Lifetime,     lCascadeResult->GetCutMinV0Lifetime() );
+        lMatcher->SetCut( lPos, kCascMaxV0Lifetime,     lCascadeResult->GetCutMaxV0Lifetime() );
+        lMatcher->SetCut( lPos, kCascMaxChi2PerCluster, lCascadeResult->GetCutMaxChi2PerCluster() );
+        lMatcher->SetCut( lPos, kCascMinTrackLength,    lCascadeResult->GetCutMinTrackLength() );
+        lMatcher->SetFlag( lPos, kCascITSRefit, lCascadeResult->GetCutUseITSRefitTracks() );
+    }
+
+    for(Int_t ih=0; ih<3; ih++) fV0Matcher[ih]->Compile();
+    for(Int_t ih=0; ih<4; ih++) fCascadeMatcher[ih]->Compile();
+    AliInfo(Form("Configuration matcher: %i V0 and %i cascade configurations",lNumberOfConfigurations,lNumberOfConfigurationsCascade));
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::FillMatchedV0Configurations( Int_t lOnFlyStatus )
+{
+    //Fill the histograms of the V0 configurations passed by the current candidate
+    //Same selections as the sweep over all configurations in UserExec
+    if( lOnFlyStatus != 0 ) return;
+
+    Bool_t lFlags[kV0NFlags];
+    lFlags[kV0Armenteros] = fTreeVariablePtArmV0*5>TMath::Abs(fTreeVariableAlphaV0);
+    lFlags[kV0ITSRefit]   = (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) && (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit);
+
+    for(Int_t ih=0; ih<3; ih++){
+        if( !fV0Matcher[ih] || !fV0Matcher[ih]->GetNConfigurations() ) continue;
+
+        Float_t lMass = 0;
+        Float_t lRap  = 0;
+        Float_t lPDGMass = -1;
+        Float_t lNegdEdx = 100;
+        Float_t lPosdEdx = 100;
+        Float_t lBaryonMomentum = -0.5;
+        if ( ih == AliV0Result::kK0Short     ){
+            lMass    = fTreeVariableInvMassK0s;
+            lRap     = fTreeVariableRapK0Short;
+            lPDGMass = 0.497;
+            lNegdEdx = fTreeVariableNSigmasNegPion;
+            lPosdEdx = fTreeVariableNSigmasPosPion;
+        }
+        if ( ih == AliV0Result::kLambda      ){
+            lMass = fTreeVariableInvMassLambda;
+            lRap = fTreeVariableRapLambda;
+            lPDGMass = 1.115683;
+            lNegdEdx = fTreeVariableNSigmasNegPion;
+            lPosdEdx = fTreeVariableNSigmasPosProton;
+            lBaryonMomentum = fTreeVariablePosInnerP;
+        }
+        if ( ih == AliV0Result::kAntiLambda  ){
+            lMass = fTreeVariableInvMassAntiLambda;
+            lRap = fTreeVariableRapLambda;
+            lPDGMass = 1.115683;
+            lNegdEdx = fTreeVariableNSigmasNegProton;
+            lPosdEdx = fTreeVariableNSigmasPosPion;
+            lBaryonMomentum = fTreeVariableNegInnerP;
+        }
+        if( !(TMath::Abs(lRap) < 0.5) ) continue;
+
+        Float_t lProperLifetime = fTreeVariableDistOverTotMom*lPDGMass;
+        Double_t lValues[kV0NCuts];
+        lValues[kV0MinEta]           = MinOrNaN( fTreeVariableNegEta, fTreeVariablePosEta );
+        lValues[kV0MaxEta]           = MaxOrNaN( fTreeVariableNegEta, fTreeVariablePosEta );
+        lValues[kV0Radius]           = fTreeVariableV0Radius;
+        lValues[kV0DCANegToPV]       = fTreeVariableDcaNegToPrimVertex;
+        lValues[kV0DCAPosToPV]       = fTreeVariableDcaPosToPrimVertex;
+        lValues[kV0DCAV0Daughters]   = fTreeVariableDcaV0Daughters;
+        lValues[kV0CosPA]            = fTreeVariableV0CosineOfPointingAngle;
+        lValues[kV0ProperLifetime]   = lProperLifetime;
+        lValues[kV0CrossedRows]      = fTreeVariableLeastNbrCrossedRows;
+        lValues[kV0CrossedRowsOverFindable] = fTreeVariableLeastRatioCrossedRowsOverFindable;
+        lValues[kV0MinBaryonMomentum] = ( ih == AliV0Result::kK0Short ) ? 0. : lBaryonMomentum;
+        lValues[kV0TPCdEdx]          = MaxOrNaN( TMath::Abs(lNegdEdx), TMath::Abs(lPosdEdx) );
+        //Cuts passed if absurd (> 1e+3 or < 0), as in the sweep
+        lValues[kV0MaxChi2PerCluster] = fTreeVariableMaxChi2PerCluster < 1e+3 ? fTreeVariableMaxChi2PerCluster : 1e+3;
+        lValues[kV0MinTrackLength]   = fTreeVariableMinTrackLength > 0 ? fTreeVariableMinTrackLength : 0.;
+
+        if( !fV0Matcher[ih]->Match( lValues, lFlags, fMatchedConfigurations ) ) continue;
+
+        for(UInt_t im=0; im<fMatchedConfigurations.size(); im++){
+            AliV0Result *lV0Result = (AliV0Result*) fListV0->At( fMatchedConfigurations[im] );
+            if( lV0Result->GetCutUseVarV0CosPA() ){
+                //Variable V0 CosPA (the constant one is in the tables)
+                Float_t lVarV0CosPA = TMath::Cos(
+                                                 lV0Result->GetCutVarV0CosPAExp0Const()*TMath::Exp(lV0Result->GetCutVarV0CosPAExp0Slope()*fTreeVariablePt) +
+                                                 lV0Result->GetCutVarV0CosPAExp1Const()*TMath::Exp(lV0Result->GetCutVarV0CosPAExp1Slope()*fTreeVariablePt) +
+                                                 lV0Result->GetCutVarV0CosPAConst());
+                if( !(fTreeVariableV0CosineOfPointingAngle > lVarV0CosPA) ) continue;
+            }
+            lV0Result->GetHistogram() -> Fill ( fCentrality, fTreeVariablePt, lMass );
+        }
+    }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::FillMatchedCascadeConfigurations()
+{
+    //Fill the histograms of the cascade configurations passed by the current candidate
+    //Same selections as the sweep over all configurations in UserExec
+    Bool_t lFlags[kCascNFlags];
+    lFlags[kCascITSRefit] = (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
+                            (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
+                            (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit);
+
+    for(Int_t ih=0; ih<4; ih++){
+        if( !fCascadeMatcher[ih] || !fCascadeMatcher[ih]->GetNConfigurations() ) continue;
+
+        Float_t lMass = 0;
+        Float_t lRap  = 0;
+        Float_t lPDGMass = -1;
+        Float_t lNegdEdx = 100;
+        Float_t lPosdEdx = 100;
+        Float_t lBachdEdx = 100;
+        Short_t  lCharge = -2;
+        if ( ih == AliCascadeResult::kXiMinus     ){
+            lCharge  = -1;
+            lMass    = fTreeCascVarMassAsXi;
+            lRap     = fTreeCascVarRapXi;
+            lPDGMass = 1.32171;
+            lNegdEdx = fTreeCascVarNegNSigmaPion;
+            lPosdEdx = fTreeCascVarPosNSigmaProton;
+            lBachdEdx= fTreeCascVarBachNSigmaPion;
+        }
+        if ( ih == AliCascadeResult::kXiPlus      ){
+            lCharge  = +1;
+            lMass    = fTreeCascVarMassAsXi;
+            lRap     = fTreeCascVarRapXi;
+            lPDGMass = 1.32171;
+            lNegdEdx = fTreeCascVarNegNSigmaProton;
+            lPosdEdx = fTreeCascVarPosNSigmaPion;
+            lBachdEdx= fTreeCascVarBachNSigmaPion;
+        }
+        if ( ih == AliCascadeResult::kOmegaMinus     ){
+            lCharge  = -1;
+            lMass    = fTreeCascVarMassAsOmega;
+            lRap     = fTreeCascVarRapOmega;
+            lPDGMass = 1.67245;
+            lNegdEdx = fTreeCascVarNegNSigmaPion;
+            lPosdEdx = fTreeCascVarPosNSigmaProton;
+            lBachdEdx= fTreeCascVarBachNSigmaKaon;
+        }
+        if ( ih == AliCascadeResult::kOmegaPlus      ){
+            lCharge  = +1;
+            lMass    = fTreeCascVarMassAsOmega;
+            lRap     = fTreeCascVarRapOmega;
+            lPDGMass = 1.67245;
+            lNegdEdx = fTreeCascVarNegNSigmaProton;
+            lPosdEdx = fTreeCascVarPosNSigmaPion;
+            lBachdEdx= fTreeCascVarBachNSigmaKaon;
+        }
+        if( fTreeCascVarCharge != lCharge || !(TMath::Abs(lRap) < 0.5) ) continue;
+
+        Float_t lProperLifetime = fTreeCascVarDistOverTotMom*lPDGMass;
+        Double_t lValues[kCascNCuts];
+        lValues[kCascMinEta]            = MinOrNaN( MinOrNaN( fTreeCascVarPosEta, fTreeCascVarNegEta ), fTreeCascVarBachEta );
+        lValues[kCascMaxEta]            = MaxOrNaN( MaxOrNaN( fTreeCascVarPosEta, fTreeCascVarNegEta ), fTreeCascVarBachEta );
+        lValues[kCascDCANegToPV]        = fTreeCascVarDCANegToPrimVtx;
+        lValues[kCascDCAPosToPV]        = fTreeCascVarDCAPosToPrimVtx;
+        lValues[kCascDCAV0Daughters]    = fTreeCascVarDCAV0Daughters;
+        lValues[kCascV0CosPA]           = fTreeCascVarV0CosPointingAngle;
+        lValues[kCascV0Radius]          = fTreeCascVarV0Radius;
+        lValues[kCascDCAV0ToPV]         = fTreeCascVarDCAV0ToPrimVtx;
+        lValues[kCascV0Mass]            = TMath::Abs(fTreeCascVarV0Mass-1.116);
+        lValues[kCascDCABachToPV]       = fTreeCascVarDCABachToPrimVtx;
+        lValues[kCascDCACascDaughters]  = fTreeCascVarDCACascDaughters;
+        lValues[kCascCascCosPA]         = fTreeCascVarCascCosPointingAngle;
+        lValues[kCascCascRadius]        = fTreeCascVarCascRadius;
+        lValues[kCascProperLifetime]    = lProperLifetime;
+        lValues[kCascLeastNbrClusters]  = fTreeCascVarLeastNbrClusters;
+        lValues[kCascTPCdEdx]           = MaxOrNaN( MaxOrNaN( TMath::Abs(lNegdEdx), TMath::Abs(lPosdEdx) ), TMath::Abs(lBachdEdx) );
+        lValues[kCascXiRejection]       = ( ih == AliCascadeResult::kOmegaMinus || ih == AliCascadeResult::kOmegaPlus ) ? TMath::Abs( fTreeCascVarMassAsXi - 1.32171 ) : 0.;
+        lValues[kCascDCABachToBaryon]   = fTreeCascVarDCABachToBaryon;
+        lValues[kCascBachBaryonCosPA]   = fTreeCascVarWrongCosPA;
+        lValues[kCascMinV0Lifetime]     = fTreeCascVarV0Lifetime;
+        //Cuts passed if absurd (> 1e+3 or < 0), as in the sweep
+        lValues[kCascMaxV0Lifetime]     = fTreeCascVarV0Lifetime < 1e+3 ? fTreeCascVarV0Lifetime : 1e+3;
+        lValues[kCascMaxChi2PerCluster] = fTreeCascVarMaxChi2PerCluster < 1e+3 ? fTreeCascVarMaxChi2PerCluster : 1e+3;
+        lValues[kCascMinTrackLength]    = fTreeCascVarMinTrackLength > 0 ? fTreeCascVarMinTrackLength : 0.;
+
+        if( !fCascadeMatcher[ih]->Match( lValues, lFlags, fMatchedConfigurations ) ) continue;
+
+        for(UInt_t im=0; im<fMatchedConfigurations.size(); im++){
+            AliCascadeResult *lCascadeResult = (AliCascadeResult*) fListCascade->At( fMatchedConfigurations[im] );
+            //Variable Cascade and V0 CosPA (the constant ones are in the tables)
+            if( lCascadeResult->GetCutUseVarCascCosPA() ){
+                Float_t lVarCascCosPA = TMath::Cos(
+                    lCascadeResult->GetCutVarCascCosPAExp0Const()*TMath::Exp(lCascadeResult->GetCutVarCascCosPAExp0Slope()*fTreeCascVarPt) +
+                    lCascadeResult->GetCutVarCascCosPAExp1Const()*TMath::Exp(lCascadeResult->GetCutVarCascCosPAExp1Slope()*fTreeCascVarPt) +
+                    lCascadeResult->GetCutVarCascCosPAConst());
+                if( !(fTreeCascVarCascCosPointingAngle > lVarCascCosPA) ) continue;
+            }
+            if( lCascadeResult->GetCutUseVarV0CosPA() ){
+                Float_t lVarV0CosPA = TMath::Cos(
+                    lCascadeResult->GetCutVarV0CosPAExp0Const()*TMath::Exp(lCascadeResult->GetCutVarV0CosPAExp0Slope()*fTreeCascVarPt) +
+                    lCascadeResult->GetCutVarV0CosPAExp1Const()*TMath::Exp(lCascadeResult->GetCutVarV0CosPAExp1Slope()*fTreeCascVarPt) +
+                    lCascadeResult->GetCutVarV0CosPAConst());
+                if( !(fTreeCascVarV0CosPointingAngle > lVarV0CosPA) ) continue;
+            }
+            lCascadeResult->GetHistogram() -> Fill ( fCentrality, fTreeCascVarPt, lMass );
+        }
+    }
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskStrangenessVsMultiplicityRun2::SetupStandardVertexing()
 //Meant to store standard re-vertexing configuration
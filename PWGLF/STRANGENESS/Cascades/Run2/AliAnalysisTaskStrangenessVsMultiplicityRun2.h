@@ -41,7 +41,9 @@ class AliPhysicsSelection;
 class AliCFContainer;
 class AliV0Result;
 class AliCascadeResult;
+class AliWeakResultMatcher;
 
+#include <vector>
 //#include "TString.h"
 //#include "AliESDtrackCuts.h"
 //#include "AliAnalysisTaskSE.h"
@@ -89,6 +91,11 @@ public:
     void SetExtraCleanup ( Bool_t lExtraCleanup = kTRUE) {
         fkExtraCleanup = lExtraCleanup;
     }
+    void SetUseConfigurationMatcher ( Bool_t lUseConfigurationMatcher = kTRUE) {
+        //Find the configurations passed by each candidate in threshold tables
+        //instead of testing all of them (same result, faster with many configurations)
+        fkUseConfigurationMatcher = lUseConfigurationMatcher;
+    }
 //---------------------------------------------------------------------------------------
     void SetUseExtraEvSels ( Bool_t lUseExtraEvSels = kTRUE) {
         fkDoExtraEvSels = lUseExtraEvSels;
@@ -163,6 +170,10 @@ public:
     //Superlight mode: add another configuration, please
     void AddConfiguration( AliV0Result      *lV0Result      );
     void AddConfiguration( AliCascadeResult *lCascadeResult );
+    //Superlight mode: threshold tables of the configurations (see AliWeakResultMatcher)
+    void BuildConfigurationMatchers();
+    void FillMatchedV0Configurations( Int_t lOnFlyStatus );
+    void FillMatchedCascadeConfigurations();
 //---------------------------------------------------------------------------------------
     //Functions for analysis Bookkeepinp
     // 1- Configure standard vertexing
@@ -224,6 +235,12 @@ private:
     Bool_t    fkUseLightVertexer;       // if true, use AliLightVertexers instead of regular ones
     Bool_t    fkDoV0Refit;              // if true, will invoke AliESDv0::Refit in the vertexing procedure
     Bool_t    fkExtraCleanup;           //if true, perform pre-rejection of useless candidates before going through configs
+    Bool_t    fkUseConfigurationMatcher; //if true, find the configurations passed by a candidate in threshold tables
+
+    //Threshold tables of the configurations, one per mass hypothesis
+    AliWeakResultMatcher *fV0Matcher[3];      //!
+    AliWeakResultMatcher *fCascadeMatcher[4]; //!
+    std::vector<Int_t> fMatchedConfigurations; //! configurations passed by the current candidate
 
     AliVEvent::EOfflineTriggerTypes fTrigType; // trigger type
 
@@ -408,8 +425,9 @@ private:
     AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
     AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
 
-    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 2);
+    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 3);
     //1: first implementation
+    //3: configuration matcher
 };
 
 #endif
@@ -0,0 +1,165 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Threshold tables of the configurations of a multi-cut analysis,
+// to find the configurations passed by a candidate with a few
+// binary searches and bitset intersections (see header)
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include <algorithm>
+#include "AliWeakResultMatcher.h"
+
+ClassImp(AliWeakResultMatcher);
+//________________________________________________________________
+AliWeakResultMatcher::AliWeakResultMatcher() : TObject(),
+fNCuts(0), fNFlags(0), fNConfigs(0), fNWords(0), fCompiled(kFALSE),
+fCutType(), fID(), fThreshold(), fFlag(),
+fTableOffset(), fTableThreshold(), fTableBits(), fFlagBits(), fResult()
+{
+    // Dummy Constructor - not to be used!
+}
+//________________________________________________________________
+AliWeakResultMatcher::AliWeakResultMatcher(Int_t lNCuts, const ECutType *lCutTypes, Int_t lNFlags) : TObject(),
+fNCuts(lNCuts), fNFlags(lNFlags), fNConfigs(0), fNWords(0), fCompiled(kFALSE),
+fCutType(lNCuts), fID(), fThreshold(), fFlag(),
+fTableOffset(), fTableThreshold(), fTableBits(), fFlagBits(), fResult()
+{
+    // Constructor: number and type of the threshold cuts, number of flags
+    for( Int_t icut=0; icut<lNCuts; icut++) fCutType[icut] = lCutTypes[icut];
+}
+//________________________________________________________________
+Int_t AliWeakResultMatcher::AddConfiguration( Int_t lID )
+{
+    // Add a configuration (by default passed by any candidate)
+    // Returns its position in this matcher
+    fID.push_back( lID );
+    for( Int_t icut=0; icut<fNCuts; icut++) fThreshold.push_back( fCutType[icut] == kLowerCut ? -1e+30 : 1e+30 );
+    for( Int_t iflag=0; iflag<fNFlags; iflag++) fFlag.push_back( 0 );
+    fCompiled = kFALSE;
+    return fNConfigs++;
+}
+//________________________________________________________________
+void AliWeakResultMatcher::SetCut( Int_t lConfig, Int_t lCut, Double_t lThreshold )
+{
+    if( lConfig<0 || lConfig>=fNConfigs || lCut<0 || lCut>=fNCuts ) return;
+    fThreshold[lConfig*fNCuts + lCut] = lThreshold;
+    fCompiled = kFALSE;
+}
+//________________________________________________________________
+void AliWeakResultMatcher::SetFlag( Int_t lConfig, Int_t lFlag, Bool_t lRequired )
+{
+    if( lConfig<0 || lConfig>=fNConfigs || lFlag<0 || lFlag>=fNFlags ) return;
+    fFlag[lConfig*fNFlags + lFlag] = lRequired;
+    fCompiled = kFALSE;
+}
+//________________________________________________________________
+void AliWeakResultMatcher::Clear(Option_t*)
+{
+    // Remove all configurations
+    fNConfigs = 0;
+    fNWords   = 0;
+    fID.clear();
+    fThreshold.clear();
+    fFlag.clear();
+    fTableOffset.clear();
+    fTableThreshold.clear();
+    fTableBits.clear();
+    fFlagBits.clear();
+    fResult.clear();
+    fCompiled = kFALSE;
+}
+//________________________________________________________________
+void AliWeakResultMatcher::Compile()
+{
+    // Build the threshold tables
+    // For a cut with k distinct thresholds t[0] < ... < t[k-1], k+1 bitsets B[0..k] are stored
+    //  - kLowerCut: B[j] = configurations with threshold < t[j] (i.e. among t[0..j-1])
+    //  - kUpperCut: B[j] = configurations with threshold > t[j-1] (i.e. among t[j..k-1])
+    // so that a candidate with value v passes the configurations in B[j], with j the number
+    // of thresholds < v (kLowerCut) or <= v (kUpperCut)
+    // The bitsets of cut c start at (fTableOffset[c]+c)*fNWords in fTableBits
+    fNWords = (fNConfigs+63)/64;
+    fTableOffset.assign(fNCuts+1, 0);
+    fTableThreshold.clear();
+    fTableBits.clear();
+
+    std::vector<Double_t> lSorted;
+    for( Int_t icut=0; icut<fNCuts; icut++){
+        lSorted.clear();
+        for( Int_t icfg=0; icfg<fNConfigs; icfg++) lSorted.push_back( fThreshold[icfg*fNCuts + icut] );
+        std::sort( lSorted.begin(), lSorted.end() );
+        lSorted.erase( std::unique( lSorted.begin(), lSorted.end() ), lSorted.end() );
+        Int_t lK = lSorted.size();
+
+        fTableOffset[icut+1] = fTableOffset[icut] + lK;
+        fTableThreshold.insert( fTableThreshold.end(), lSorted.begin(), lSorted.end() );
+
+        //Position of each configuration among the sorted thresholds
+        std::vector<Int_t> lPos(fNConfigs);
+        for( Int_t icfg=0; icfg<fNConfigs; icfg++)
+            lPos[icfg] = std::lower_bound( lSorted.begin(), lSorted.end(), fThreshold[icfg*fNCuts + icut] ) - lSorted.begin();
+
+        size_t lStart = fTableBits.size();
+        fTableBits.resize( lStart + (lK+1)*fNWords, 0 );
+        for( Int_t j=0; j<=lK; j++){
+            ULong64_t *lBits = &fTableBits[lStart + j*fNWords];
+            for( Int_t icfg=0; icfg<fNConfigs; icfg++){
+                Bool_t lPass = ( fCutType[icut] == kLowerCut ) ? (lPos[icfg] < j) : (lPos[icfg] >= j);
+                if( lPass ) lBits[icfg/64] |= (1ULL << (icfg%64));
+            }
+        }
+    }
+
+    fFlagBits.assign( fNFlags*fNWords, 0 );
+    for( Int_t iflag=0; iflag<fNFlags; iflag++)
+        for( Int_t icfg=0; icfg<fNConfigs; icfg++)
+            if( fFlag[icfg*fNFlags + iflag] ) fFlagBits[iflag*fNWords + icfg/64] |= (1ULL << (icfg%64));
+
+    fResult.assign( fNWords, 0 );
+    fCompiled = kTRUE;
+}
+//________________________________________________________________
+Int_t AliWeakResultMatcher::Match( const Double_t *lValues, const Bool_t *lFlags, std::vector<Int_t> &lIDs )
+{
+    // Find the configurations passed by a candidate
+    // Returns the number of passed configurations, whose IDs are in lIDs
+    lIDs.clear();
+    if( !fNConfigs ) return 0;
+    if( !fCompiled ) Compile();
+
+    //Start from all configurations
+    for( Int_t iw=0; iw<fNWords; iw++) fResult[iw] = ~0ULL;
+    if( fNConfigs%64 ) fResult[fNWords-1] = (1ULL << (fNConfigs%64)) - 1;
+
+    for( Int_t icut=0; icut<fNCuts; icut++){
+        const Double_t *lBegin = fTableThreshold.empty() ? 0x0 : &fTableThreshold[0] + fTableOffset[icut];
+        const Double_t *lEnd   = lBegin + (fTableOffset[icut+1] - fTableOffset[icut]);
+        //A NaN value passes no configuration, as in the direct comparison
+        Int_t j = ( fCutType[icut] == kLowerCut ) ?
+            std::lower_bound( lBegin, lEnd, lValues[icut] ) - lBegin :
+            std::upper_bound( lBegin, lEnd, lValues[icut] ) - lBegin;
+        const ULong64_t *lBits = &fTableBits[(fTableOffset[icut] + icut + j)*fNWords];
+        ULong64_t lAny = 0;
+        for( Int_t iw=0; iw<fNWords; iw++){
+            fResult[iw] &= lBits[iw];
+            lAny |= fResult[iw];
+        }
+        if( !lAny ) return 0;
+    }
+
+    //Configurations requiring a flag not fulfilled by the candidate
+    for( Int_t iflag=0; iflag<fNFlags; iflag++){
+        if( lFlags[iflag] ) continue;
+        const ULong64_t *lBits = &fFlagBits[iflag*fNWords];
+        for( Int_t iw=0; iw<fNWords; iw++) fResult[iw] &= ~lBits[iw];
+    }
+
+    for( Int_t iw=0; iw<fNWords; iw++){
+        ULong64_t lWord = fResult[iw];
+        while( lWord ){
+            Int_t lBit = 0;
+            while( !((lWord >> lBit) & 1ULL) ) lBit++;
+            lIDs.push_back( fID[iw*64 + lBit] );
+            lWord &= lWord - 1;
+        }
+    }
+    return lIDs.size();
+}
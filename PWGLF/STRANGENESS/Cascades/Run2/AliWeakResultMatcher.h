@@ -0,0 +1,68 @@
+#ifndef AliWeakResultMatcher_H
+#define AliWeakResultMatcher_H
+#include <vector>
+#include <TObject.h>
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Finds the configurations (AliV0Result / AliCascadeResult) passed
+// by a candidate without looping on all of them.
+//
+// Each cut is a threshold per configuration, passed if:
+//  - kLowerCut: threshold < value (e.g. DCA to PV, radius)
+//  - kUpperCut: threshold > value (e.g. DCA between daughters)
+// Each flag is a requirement of some configurations (e.g. ITS refit)
+// that the candidate may or may not fulfil.
+//
+// Compile() sorts the distinct thresholds of each cut and stores,
+// for each of them, the set of configurations passed by a value
+// just above (kLowerCut) or below (kUpperCut) it as a bitset.
+// The configurations passed by a candidate are then the intersection
+// of one bitset per cut, found with a binary search.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliWeakResultMatcher : public TObject {
+
+public:
+    enum ECutType { kLowerCut = 0, kUpperCut };
+
+    AliWeakResultMatcher();
+    AliWeakResultMatcher(Int_t lNCuts, const ECutType *lCutTypes, Int_t lNFlags = 0);
+    ~AliWeakResultMatcher() {}
+
+    //Definition of the configurations
+    Int_t AddConfiguration( Int_t lID );
+    void SetCut ( Int_t lConfig, Int_t lCut, Double_t lThreshold );
+    void SetFlag( Int_t lConfig, Int_t lFlag, Bool_t lRequired = kTRUE );
+    void Compile();
+    void Clear(Option_t* = "");
+
+    Int_t GetNConfigurations() const { return fNConfigs; }
+    Int_t GetNCuts () const { return fNCuts;  }
+    Int_t GetNFlags() const { return fNFlags; }
+    Bool_t IsCompiled() const { return fCompiled; }
+
+    //Matching: lValues[lNCuts] of the candidate, lFlags[lNFlags] fulfilled by the candidate
+    //Fills lIDs with the IDs of the passed configurations (in the order they were added)
+    Int_t Match( const Double_t *lValues, const Bool_t *lFlags, std::vector<Int_t> &lIDs );
+
+private:
+    Int_t fNCuts;   //number of threshold cuts
+    Int_t fNFlags;  //number of flags
+    Int_t fNConfigs;//number of configurations
+    Int_t fNWords;  //words of a bitset of configurations
+    Bool_t fCompiled; //tables built after the last change
+    std::vector<Int_t> fCutType;       //type of each cut
+    std::vector<Int_t> fID;            //ID of each configuration
+    std::vector<Double_t> fThreshold;  //threshold, configuration x cut
+    std::vector<Char_t> fFlag;         //required flags, configuration x flag
+
+    std::vector<Int_t> fTableOffset;        //! start of the thresholds of each cut in fTableThreshold (and of their bitsets)
+    std::vector<Double_t> fTableThreshold;  //! sorted distinct thresholds of each cut
+    std::vector<ULong64_t> fTableBits;      //! bitsets of the configurations passed above/below each threshold
+    std::vector<ULong64_t> fFlagBits;       //! bitsets of the configurations requiring each flag
+    std::vector<ULong64_t> fResult;         //! bitset of the configurations passed by the current candidate
+
+    ClassDef(AliWeakResultMatcher, 1)
+    // 1 - original implementation
+};
+#endif
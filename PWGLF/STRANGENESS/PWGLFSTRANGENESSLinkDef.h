@@ -46,4 +46,5 @@
 #pragma link C++ class AliV0Result+;
 #pragma link C++ class AliCascadeResult+;
 #pragma link C++ class AliStrangenessModule+;
+#pragma link C++ class AliWeakResultMatcher+;
 #endif
@@ -0,0 +1,745 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+// This class unfolds a spectrum by minimizing
+//
+//   chi2 + weight * regularization
+//
+// where chi2 = sum_j ((sum_i R_ji x_i - m_j) / e_j)^2, R is the response matrix normalized
+// to 1 for each true bin i, m the measured spectrum normalized to 1 and e its error.
+// The unfolded spectrum is parametrized as x_i = p_i^2 to keep it positive (as in AliUnfolding).
+//
+// The function and its gradient are calculated analytically from the dense response matrix,
+// and minimized with a limited memory BFGS (L-BFGS) method with a backtracking line search.
+// One evaluation costs O(nMeasured * nTrue), independent of the number of parameters, while a
+// minimizer using numerical derivatives needs O(nTrue) evaluations for each gradient.
+//
+// The unfoldings of the toy spectra for the statistical uncertainty (UnfoldToys) are independent
+// and run in parallel threads. The randomized inputs are generated before in the calling thread
+// from a single generator, so that the result does not depend on the number of threads.
+//
+// Regularizations (applied to the unfolded spectrum before the efficiency correction):
+//   kPol0:    sum_i (1 - x_{i-1} / x_i)^2                     (constant)
+//   kPol1:    sum_i ((x_i - 2 x_{i-1} + x_{i-2}) / x_{i-1})^2  (linear)
+//   kEntropy: sum_i f_i ln f_i, f_i = x_i / sum_k x_k          (negative entropy)
+
+#include "AliGradientUnfolding.h"
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <atomic>
+
+#include <TH1.h>
+#include <TH2.h>
+#include <TMath.h>
+#include <TRandom3.h>
+#include <AliLog.h>
+
+ClassImp(AliGradientUnfolding)
+
+namespace {
+  const Double_t kEpsilon = 1e-30; // protects the divisions by empty bins in the regularization
+
+  struct UnfoldingProblem
+  {
+    Int_t fNTrue;                     // number of true bins
+    Int_t fNMeasured;                 // number of measured bins
+    std::vector<Double_t> fResponse;  // response matrix, measured x true (row major), normalized to 1 for each true bin
+    std::vector<Double_t> fMeasured;  // measured spectrum normalized to 1
+    std::vector<Double_t> fWeight;    // 1 / e^2 of the measured bins, 0 for bins excluded from the chi2
+    Double_t fNorm;                   // integral of the measured spectrum
+    Int_t fRegularizationType;        // regularization
+    Double_t fRegularizationWeight;   // weight of the regularization
+  };
+
+  struct MinimizerSettings
+  {
+    Int_t fMaxIterations;
+    Double_t fTolerance;
+    Int_t fMemory;
+    Bool_t fDebug;
+  };
+
+  struct MinimizerResult
+  {
+    Int_t fStatus;
+    Int_t fIterations;
+    Double_t fChi2;
+    Double_t fRegularization;
+  };
+
+  //____________________________________________________________________
+  Bool_t SetupProblem(const std::vector<Double_t>& correlation, Int_t nTrue, Int_t nMeasured, const std::vector<Double_t>& measured, const std::vector<Double_t>& measuredError, Int_t skipBinsBegin, Int_t regType, Double_t regWeight, UnfoldingProblem& problem)
+  {
+    // fills the normalized response matrix and measured spectrum
+    // correlation is given as true x measured (row major), as in the TH2
+
+    problem.fNTrue = nTrue;
+    problem.fNMeasured = nMeasured;
+    problem.fRegularizationType = regType;
+    problem.fRegularizationWeight = regWeight;
+
+    problem.fResponse.assign(nMeasured * nTrue, 0);
+    for (Int_t i=0; i<nTrue; ++i)
+    {
+      Double_t sum = 0;
+      for (Int_t j=0; j<nMeasured; ++j)
+        sum += correlation[i * nMeasured + j];
+      if (sum <= 0)
+        continue;
+      for (Int_t j=0; j<nMeasured; ++j)
+        problem.fResponse[j * nTrue + i] = correlation[i * nMeasured + j] / sum;
+    }
+
+    problem.fNorm = 0;
+    for (Int_t j=0; j<nMeasured; ++j)
+      problem.fNorm += measured[j];
+    if (problem.fNorm <= 0)
+      return kFALSE;
+
+    problem.fMeasured.resize(nMeasured);
+    problem.fWeight.resize(nMeasured);
+    for (Int_t j=0; j<nMeasured; ++j)
+    {
+      problem.fMeasured[j] = measured[j] / problem.fNorm;
+      // empty bins are taken with an error of 1 entry
+      Double_t error = (measuredError[j] > 0) ? measuredError[j] : 1;
+      error /= problem.fNorm;
+      problem.fWeight[j] = (j < skipBinsBegin) ? 0 : 1.0 / (error * error);
+    }
+
+    return kTRUE;
+  }
+
+  //____________________________________________________________________
+  Double_t Regularization(const UnfoldingProblem& problem, const std::vector<Double_t>& x, std::vector<Double_t>& gradX)
+  {
+    // calculates the regularization term and adds its gradient w.r.t. x to gradX
+
+    const Int_t n = problem.fNTrue;
+    Double_t reg = 0;
+
+    switch (problem.fRegularizationType)
+    {
+      case AliGradientUnfolding::kPol0:
+        for (Int_t i=1; i<n; ++i)
+        {
+          Double_t right = x[i] + kEpsilon;
+          Double_t diff = 1 - x[i-1] / right;
+          reg += diff * diff;
+          gradX[i-1] += -2 * diff / right;
+          gradX[i] += 2 * diff * x[i-1] / (right * right);
+        }
+        break;
+
+      case AliGradientUnfolding::kPol1:
+        for (Int_t i=2; i<n; ++i)
+        {
+          Double_t middle = x[i-1] + kEpsilon;
+          Double_t diff = (x[i] + x[i-2]) / middle - 2;
+          reg += diff * diff;
+          gradX[i] += 2 * diff / middle;
+          gradX[i-2] += 2 * diff / middle;
+          gradX[i-1] += -2 * diff * (x[i] + x[i-2]) / (middle * middle);
+        }
+        break;
+
+      case AliGradientUnfolding::kEntropy:
+      {
+        Double_t sum = 0;
+        for (Int_t i=0; i<n; ++i)
+          sum += x[i];
+        if (sum <= 0)
+          break;
+        for (Int_t i=0; i<n; ++i)
+        {
+          Double_t f = x[i] / sum;
+          if (f > 0)
+            reg += f * TMath::Log(f);
+        }
+        for (Int_t i=0; i<n; ++i)
+          gradX[i] += (TMath::Log(x[i] / sum + kEpsilon) - reg) / sum;
+        break;
+      }
+
+      default:
+        break;
+    }
+
+    return reg;
+  }
+
+  //____________________________________________________________________
+  Double_t Evaluate(const UnfoldingProblem& problem, const std::vector<Double_t>& p, std::vector<Double_t>& grad, std::vector<Double_t>& x, std::vector<Double_t>& gradX, Double_t& chi2, Double_t& reg)
+  {
+    // calculates chi2 + weight * regularization and its gradient w.r.t. the parameters p
+
+    const Int_t nTrue = problem.fNTrue;
+    const Int_t nMeasured = problem.fNMeasured;
+
+    for (Int_t i=0; i<nTrue; ++i)
+    {
+      x[i] = p[i] * p[i];
+      gradX[i] = 0;
+    }
+
+    chi2 = 0;
+    for (Int_t j=0; j<nMeasured; ++j)
+    {
+      if (problem.fWeight[j] <= 0)
+        continue;
+
+      const Double_t* row = &problem.fResponse[j * nTrue];
+      Double_t folded = 0;
+      for (Int_t i=0; i<nTrue; ++i)
+        folded += row[i] * x[i];
+
+      Double_t residual = folded - problem.fMeasured[j];
+      chi2 += problem.fWeight[j] * residual * residual;
+
+      Double_t coeff = 2 * problem.fWeight[j] * residual;
+      for (Int_t i=0; i<nTrue; ++i)
+        gradX[i] += coeff * row[i];
+    }
+
+    reg = 0;
+    if (problem.fRegularizationType != AliGradientUnfolding::kNone && problem.fRegularizationWeight != 0)
+    {
+      std::vector<Double_t> gradReg(nTrue, 0);
+      reg = Regularization(problem, x, gradReg);
+      for (Int_t i=0; i<nTrue; ++i)
+        gradX[i] += problem.fRegularizationWeight * gradReg[i];
+    }
+
+    // dx_i/dp_i = 2 p_i
+    for (Int_t i=0; i<nTrue; ++i)
+      grad[i] = 2 * p[i] * gradX[i];
+
+    return chi2 + problem.fRegularizationWeight * reg;
+  }
+
+  //____________________________________________________________________
+  Double_t Dot(const std::vector<Double_t>& a, const std::vector<Double_t>& b)
+  {
+    Double_t sum = 0;
+    for (UInt_t i=0; i<a.size(); ++i)
+      sum += a[i] * b[i];
+    return sum;
+  }
+
+  //____________________________________________________________________
+  MinimizerResult Minimize(const UnfoldingProblem& problem, const MinimizerSettings& settings, std::vector<Double_t>& p)
+  {
+    // L-BFGS minimization starting from p
+    // status 0: converged, 1: maximum number of iterations reached, 2: line search failed
+
+    const Int_t n = problem.fNTrue;
+
+    std::vector<Double_t> x(n), gradX(n), grad(n), pNew(n), gradNew(n), q(n), direction(n), alpha(TMath::Max(settings.fMemory, 1));
+    std::deque<std::vector<Double_t> > sHistory, yHistory;
+    std::deque<Double_t> rhoHistory;
+
+    MinimizerResult result;
+    result.fStatus = 1;
+    result.fIterations = 0;
+
+    Double_t chi2 = 0, reg = 0;
+    Double_t f = Evaluate(problem, p, grad, x, gradX, chi2, reg);
+
+    Int_t nSmallChanges = 0;
+    for (Int_t iter=0; iter<settings.fMaxIterations; ++iter)
+    {
+      result.fIterations = iter + 1;
+
+      // two-loop recursion: direction = - H * grad
+      q = grad;
+      const Int_t m = sHistory.size();
+      for (Int_t k=m-1; k>=0; --k)
+      {
+        alpha[k] = rhoHistory[k] * Dot(sHistory[k], q);
+        for (Int_t i=0; i<n; ++i)
+          q[i] -= alpha[k] * yHistory[k][i];
+      }
+
+      Double_t gamma = 0;
+      if (m > 0)
+        gamma = Dot(sHistory[m-1], yHistory[m-1]) / Dot(yHistory[m-1], yHistory[m-1]);
+      else
+      {
+        // first step: steepest descent with a length of 10% of the parameter vector
+        Double_t gradNorm = TMath::Sqrt(Dot(grad, grad));
+        gamma = (gradNorm > 0) ? 0.1 * TMath::Sqrt(Dot(p, p)) / gradNorm : 1;
+        if (gamma <= 0)
+          gamma = 1;
+      }
+      for (Int_t i=0; i<n; ++i)
+        q[i] *= gamma;
+
+      for (Int_t k=0; k<m; ++k)
+      {
+        Double_t beta = rhoHistory[k] * Dot(yHistory[k], q);
+        for (Int_t i=0; i<n; ++i)
+          q[i] += sHistory[k][i] * (alpha[k] - beta);
+      }
+
+      for (Int_t i=0; i<n; ++i)
+        direction[i] = -q[i];
+
+      Double_t slope = Dot(direction, grad);
+      if (slope >= 0)
+      {
+        // not a descent direction: restart from steepest descent
+        sHistory.clear();
+        yHistory.clear();
+        rhoHistory.clear();
+        Double_t gradNorm = TMath::Sqrt(Dot(grad, grad));
+        if (gradNorm <= 0)
+        {
+          result.fStatus = 0;
+          break;
+        }
+        Double_t scale = 0.1 * TMath::Sqrt(Dot(p, p)) / gradNorm;
+        for (Int_t i=0; i<n; ++i)
+          direction[i] = -scale * grad[i];
+        slope = Dot(direction, grad);
+      }
+
+      // backtracking line search (Armijo condition)
+      Double_t step = 1;
+      Double_t fNew = f, chi2New = chi2, regNew = reg;
+      Bool_t accepted = kFALSE;
+      for (Int_t ls=0; ls<50; ++ls)
+      {
+        for (Int_t i=0; i<n; ++i)
+          pNew[i] = p[i] + step * direction[i];
+        fNew = Evaluate(problem, pNew, gradNew, x, gradX, chi2New, regNew);
+        if (fNew <= f + 1e-4 * step * slope)
+        {
+          accepted = kTRUE;
+          break;
+        }
+        step *= 0.5;
+      }
+
+      if (!accepted)
+      {
+        if (sHistory.empty())
+        {
+          result.fStatus = 2;
+          break;
+        }
+        sHistory.clear();
+        yHistory.clear();
+        rhoHistory.clear();
+        continue;
+      }
+
+      // update the correction pairs
+      std::vector<Double_t> s(n), y(n);
+      for (Int_t i=0; i<n; ++i)
+      {
+        s[i] = pNew[i] - p[i];
+        y[i] = gradNew[i] - grad[i];
+      }
+      Double_t sy = Dot(s, y);
+      if (sy > 1e-12 * TMath::Sqrt(Dot(s, s) * Dot(y, y)))
+      {
+        sHistory.push_back(s);
+        yHistory.push_back(y);
+        rhoHistory.push_back(1.0 / sy);
+        if ((Int_t) sHistory.size() > TMath::Max(settings.fMemory, 1))
+        {
+          sHistory.pop_front();
+          yHistory.pop_front();
+          rhoHistory.pop_front();
+        }
+      }
+
+      Double_t change = TMath::Abs(f - fNew) / TMath::Max(1.0, TMath::Max(TMath::Abs(f), TMath::Abs(fNew)));
+
+      p = pNew;
+      grad = gradNew;
+      f = fNew;
+      chi2 = chi2New;
+      reg = regNew;
+
+      if (settings.fDebug && iter % 100 == 0)
+        Printf("AliGradientUnfolding: iteration %d: f = %f (chi2 = %f, regularization = %f)", iter, f, chi2, reg);
+
+      nSmallChanges = (change < settings.fTolerance) ? nSmallChanges + 1 : 0;
+      if (nSmallChanges >= 3)
+      {
+        result.fStatus = 0;
+        break;
+      }
+    }
+
+    result.fChi2 = chi2;
+    result.fRegularization = reg;
+    return result;
+  }
+
+  //____________________________________________________________________
+  void Fold(const UnfoldingProblem& problem, const std::vector<Double_t>& p, std::vector<Double_t>& folded)
+  {
+    // folds the unfolded spectrum (normalized) with the response
+
+    folded.assign(problem.fNMeasured, 0);
+    for (Int_t j=0; j<problem.fNMeasured; ++j)
+      for (Int_t i=0; i<problem.fNTrue; ++i)
+        folded[j] += problem.fResponse[j * problem.fNTrue + i] * p[i] * p[i];
+  }
+
+  //____________________________________________________________________
+  Bool_t ReadInputs(const TH2* correlation, const TH1* measured, TH1* result, Int_t& nTrue, Int_t& nMeasured, std::vector<Double_t>& corr, std::vector<Double_t>& meas, std::vector<Double_t>& measError)
+  {
+    // copies the histogram contents (without under/overflow) into flat arrays
+
+    if (!correlation || !measured || !result)
+      return kFALSE;
+
+    nTrue = correlation->GetNbinsX();
+    nMeasured = correlation->GetNbinsY();
+    if (measured->GetNbinsX() != nMeasured || result->GetNbinsX() != nTrue)
+    {
+      AliErrorGeneral("AliGradientUnfolding", Form("Inconsistent binning: correlation %d x %d, measured %d, result %d", nTrue, nMeasured, measured->GetNbinsX(), result->GetNbinsX()));
+      return kFALSE;
+    }
+
+    corr.resize(nTrue * nMeasured);
+    for (Int_t i=0; i<nTrue; ++i)
+      for (Int_t j=0; j<nMeasured; ++j)
+        corr[i * nMeasured + j] = correlation->GetBinContent(i+1, j+1);
+
+    meas.resize(nMeasured);
+    measError.resize(nMeasured);
+    for (Int_t j=0; j<nMeasured; ++j)
+    {
+      meas[j] = measured->GetBinContent(j+1);
+      measError[j] = measured->GetBinError(j+1);
+    }
+
+    return kTRUE;
+  }
+
+  //____________________________________________________________________
+  void InitialParameters(const UnfoldingProblem& problem, const TH1* initialConditions, Double_t minimumValue, std::vector<Double_t>& p)
+  {
+    // starting point: the initial conditions if given, otherwise the measured spectrum
+
+    const Int_t n = problem.fNTrue;
+    std::vector<Double_t> x(n, 1);
+    if (initialConditions && initialConditions->GetNbinsX() >= n)
+    {
+      for (Int_t i=0; i<n; ++i)
+        x[i] = initialConditions->GetBinContent(i+1);
+    }
+    else if (problem.fNMeasured >= n)
+    {
+      for (Int_t i=0; i<n; ++i)
+        x[i] = problem.fMeasured[i];
+    }
+
+    Double_t sum = 0, max = 0;
+    for (Int_t i=0; i<n; ++i)
+    {
+      if (x[i] < 0)
+        x[i] = 0;
+      sum += x[i];
+      max = TMath::Max(max, x[i]);
+    }
+    if (sum <= 0)
+    {
+      x.assign(n, 1);
+      sum = n;
+      max = 1;
+    }
+
+    p.resize(n);
+    for (Int_t i=0; i<n; ++i)
+      p[i] = TMath::Sqrt(TMath::Max(x[i], minimumValue * max) / sum);
+  }
+
+  //____________________________________________________________________
+  void FillResult(const UnfoldingProblem& problem, const std::vector<Double_t>& p, const TH1* efficiency, TH1* result)
+  {
+    // fills the unfolded spectrum, scaled to the measured one and corrected for the efficiency
+
+    for (Int_t i=0; i<problem.fNTrue; ++i)
+    {
+      Double_t value = p[i] * p[i] * problem.fNorm;
+      if (efficiency)
+      {
+        Double_t eff = efficiency->GetBinContent(i+1);
+        value = (eff > 0) ? value / eff : 0;
+      }
+      result->SetBinContent(i+1, value);
+      result->SetBinError(i+1, 0);
+    }
+  }
+}
+
+//____________________________________________________________________
+AliGradientUnfolding::AliGradientUnfolding() :
+  TObject(),
+  fRegularizationType(kPol1),
+  fRegularizationWeight(1e4),
+  fSkipBinsBegin(0),
+  fMinimumInitialValue(1e-4),
+  fMaxIterations(10000),
+  fTolerance(1e-10),
+  fMemory(10),
+  fNThreads(0),
+  fSeed(4357),
+  fDebug(kFALSE),
+  fLastChi2(-1),
+  fLastRegularization(-1),
+  fLastIterations(0)
+{
+  // default constructor
+}
+
+//____________________________________________________________________
+Int_t AliGradientUnfolding::Unfold(const TH2* correlation, const TH1* efficiency, const TH1* measured, const TH1* initialConditions, TH1* result) const
+{
+  //
+  // unfolds <measured> using the response <correlation> (x: true, y: measured) and corrects
+  // the result for <efficiency>. The result is scaled to the integral of <measured>.
+  //
+  // The bin errors of the result are set to 0: the statistical uncertainty is obtained
+  // with UnfoldToys, the bias with UnfoldGetBias
+  //
+  // returns 0 if the minimization converged
+  //
+
+  Int_t nTrue = 0, nMeasured = 0;
+  std::vector<Double_t> corr, meas, measError;
+  if (!ReadInputs(correlation, measured, result, nTrue, nMeasured, corr, meas, measError))
+    return -1;
+
+  UnfoldingProblem problem;
+  if (!SetupProblem(corr, nTrue, nMeasured, meas, measError, fSkipBinsBegin, fRegularizationType, fRegularizationWeight, problem))
+  {
+    AliError("Empty measured spectrum");
+    return -1;
+  }
+
+  std::vector<Double_t> p;
+  InitialParameters(problem, initialConditions, fMinimumInitialValue, p);
+
+  MinimizerSettings settings = { fMaxIterations, fTolerance, fMemory, fDebug };
+  MinimizerResult status = Minimize(problem, settings, p);
+
+  fLastChi2 = status.fChi2;
+  fLastRegularization = status.fRegularization;
+  fLastIterations = status.fIterations;
+
+  AliInfo(Form("Status %d after %d iterations: chi2 = %f, regularization = %f", status.fStatus, status.fIterations, status.fChi2, status.fRegularization));
+
+  FillResult(problem, p, efficiency, result);
+
+  return status.fStatus;
+}
+
+//____________________________________________________________________
+Int_t AliGradientUnfolding::UnfoldGetBias(const TH2* correlation, const TH1* efficiency, const TH1* measured, const TH1* initialConditions, TH1* result) const
+{
+  //
+  // unfolds as Unfold and sets the bin errors of the result to the bias of the method:
+  // the result is folded with the response, unfolded again and the difference to the
+  // first result is taken as error
+  //
+  // returns the status of the first unfolding
+  //
+
+  Int_t nTrue = 0, nMeasured = 0;
+  std::vector<Double_t> corr, meas, measError;
+  if (!ReadInputs(correlation, measured, result, nTrue, nMeasured, corr, meas, measError))
+    return -1;
+
+  UnfoldingProblem problem;
+  if (!SetupProblem(corr, nTrue, nMeasured, meas, measError, fSkipBinsBegin, fRegularizationType, fRegularizationWeight, problem))
+  {
+    AliError("Empty measured spectrum");
+    return -1;
+  }
+
+  std::vector<Double_t> p;
+  InitialParameters(problem, initialConditions, fMinimumInitialValue, p);
+
+  MinimizerSettings settings = { fMaxIterations, fTolerance, fMemory, fDebug };
+  MinimizerResult status = Minimize(problem, settings, p);
+
+  fLastChi2 = status.fChi2;
+  fLastRegularization = status.fRegularization;
+  fLastIterations = status.fIterations;
+
+  // unfold the folded result, keeping the errors of the measured spectrum
+  UnfoldingProblem folded = problem;
+  Fold(problem, p, folded.fMeasured);
+
+  std::vector<Double_t> pFolded(p);
+  MinimizerResult statusFolded = Minimize(folded, settings, pFolded);
+  if (statusFolded.fStatus != 0)
+    AliWarning(Form("Unfolding of the folded result did not converge (status %d)", statusFolded.fStatus));
+
+  FillResult(problem, p, efficiency, result);
+
+  for (Int_t i=0; i<nTrue; ++i)
+  {
+    Double_t bias = TMath::Abs(pFolded[i] * pFolded[i] - p[i] * p[i]) * problem.fNorm;
+    if (efficiency)
+    {
+      Double_t eff = efficiency->GetBinContent(i+1);
+      bias = (eff > 0) ? bias / eff : 0;
+    }
+    result->SetBinError(i+1, bias);
+  }
+
+  return status.fStatus;
+}
+
+//____________________________________________________________________
+Int_t AliGradientUnfolding::UnfoldToys(const TH2* correlation, const TH1* efficiency, const TH1* measured, const TH1* initialConditions, TH1* result, Int_t nToys, Bool_t randomizeMeasured, Bool_t randomizeResponse, TH1* spread) const
+{
+  //
+  // unfolds as Unfold and evaluates the statistical uncertainty with <nToys> unfoldings
+  // of randomized inputs: the measured spectrum (<randomizeMeasured>) and/or each cell
+  // of the response (<randomizeResponse>) are drawn from a Poisson distribution with the
+  // original value as mean. The toys start from the central result and run in parallel
+  // (see SetNThreads). The bin errors of the result are set to the standard deviation of
+  // the toy results; <spread> (optional) is filled with the relative standard deviation
+  // (as AliMultiplicityCorrection::CalculateStdDev)
+  //
+  // returns the status of the central unfolding
+  //
+
+  Int_t nTrue = 0, nMeasured = 0;
+  std::vector<Double_t> corr, meas, measError;
+  if (!ReadInputs(correlation, measured, result, nTrue, nMeasured, corr, meas, measError))
+    return -1;
+
+  UnfoldingProblem problem;
+  if (!SetupProblem(corr, nTrue, nMeasured, meas, measError, fSkipBinsBegin, fRegularizationType, fRegularizationWeight, problem))
+  {
+    AliError("Empty measured spectrum");
+    return -1;
+  }
+
+  std::vector<Double_t> p;
+  InitialParameters(problem, initialConditions, fMinimumInitialValue, p);
+
+  MinimizerSettings settings = { fMaxIterations, fTolerance, fMemory, fDebug };
+  MinimizerResult status = Minimize(problem, settings, p);
+
+  fLastChi2 = status.fChi2;
+  fLastRegularization = status.fRegularization;
+  fLastIterations = status.fIterations;
+
+  FillResult(problem, p, efficiency, result);
+
+  if (nToys <= 0)
+    return status.fStatus;
+
+  // randomized inputs, generated here so that they do not depend on the number of threads
+  TRandom3 random(fSeed);
+  std::vector<UnfoldingProblem> toys(nToys);
+  std::vector<Double_t> toyCorr(corr), toyMeas(meas), toyMeasError(measError);
+  for (Int_t n=0; n<nToys; ++n)
+  {
+    if (randomizeResponse)
+      for (UInt_t k=0; k<corr.size(); ++k)
+        toyCorr[k] = random.Poisson(corr[k]);
+
+    if (randomizeMeasured)
+      for (Int_t j=0; j<nMeasured; ++j)
+      {
+        toyMeas[j] = random.Poisson(meas[j]);
+        toyMeasError[j] = TMath::Sqrt(toyMeas[j]);
+      }
+
+    if (!SetupProblem(toyCorr, nTrue, nMeasured, toyMeas, toyMeasError, fSkipBinsBegin, fRegularizationType, fRegularizationWeight, toys[n]))
+      toys[n].fNorm = 0;
+  }
+
+  // unfold the toys in parallel
+  std::vector<std::vector<Double_t> > toyResults(nToys, p);
+  std::vector<Int_t> toyStatus(nToys, -1);
+  MinimizerSettings toySettings = settings;
+  toySettings.fDebug = kFALSE;
+
+  std::atomic<Int_t> nextToy(0);
+  auto worker = [&]() {
+    for (Int_t n = nextToy++; n < nToys; n = nextToy++)
+    {
+      if (toys[n].fNorm <= 0)
+        continue;
+      toyStatus[n] = Minimize(toys[n], toySettings, toyResults[n]).fStatus;
+    }
+  };
+
+  Int_t nThreads = (fNThreads > 0) ? fNThreads : (Int_t) std::thread::hardware_concurrency();
+  nThreads = TMath::Max(1, TMath::Min(nThreads, nToys));
+  std::vector<std::thread> threads;
+  for (Int_t t=1; t<nThreads; ++t)
+    threads.push_back(std::thread(worker));
+  worker();
+  for (UInt_t t=0; t<threads.size(); ++t)
+    threads[t].join();
+
+  // standard deviation of the toy results (normalized to the central integral)
+  std::vector<Double_t> sum(nTrue, 0), sum2(nTrue, 0);
+  Int_t nGood = 0;
+  for (Int_t n=0; n<nToys; ++n)
+  {
+    if (toyStatus[n] != 0)
+      continue;
+    ++nGood;
+    for (Int_t i=0; i<nTrue; ++i)
+    {
+      Double_t value = toyResults[n][i] * toyResults[n][i];
+      sum[i] += value;
+      sum2[i] += value * value;
+    }
+  }
+
+  if (nGood < nToys)
+    AliWarning(Form("%d of %d toy unfoldings did not converge and are not used", nToys - nGood, nToys));
+  if (nGood < 2)
+    return status.fStatus;
+
+  for (Int_t i=0; i<nTrue; ++i)
+  {
+    Double_t mean = sum[i] / nGood;
+    Double_t variance = TMath::Max(0.0, (sum2[i] - nGood * mean * mean) / (nGood - 1));
+    Double_t sigma = TMath::Sqrt(variance) * problem.fNorm;
+    Double_t content = p[i] * p[i] * problem.fNorm;
+
+    if (spread)
+      spread->SetBinContent(i+1, (content > 0) ? sigma / content : 0);
+
+    if (efficiency)
+    {
+      Double_t eff = efficiency->GetBinContent(i+1);
+      sigma = (eff > 0) ? sigma / eff : 0;
+    }
+    result->SetBinError(i+1, sigma);
+  }
+
+  return status.fStatus;
+}
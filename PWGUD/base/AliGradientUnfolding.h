@@ -0,0 +1,63 @@
+/* $Id$ */
+
+#ifndef ALIGRADIENTUNFOLDING_H
+#define ALIGRADIENTUNFOLDING_H
+
+//
+// chi2 unfolding with regularization, minimized with a L-BFGS quasi-Newton method
+// using the analytic gradient of the chi2 and of the regularization term
+// alternative to the chi2 minimization with MINUIT of AliUnfolding
+//
+
+#include <TObject.h>
+
+class TH1;
+class TH2;
+
+class AliGradientUnfolding : public TObject {
+  public:
+    enum RegularizationType { kNone = 0, kPol0, kPol1, kEntropy };
+
+    AliGradientUnfolding();
+    virtual ~AliGradientUnfolding() {}
+
+    void SetRegularization(RegularizationType type, Double_t weight) { fRegularizationType = type; fRegularizationWeight = weight; }
+    void SetSkipBinsBegin(Int_t bins) { fSkipBinsBegin = bins; }
+    void SetMinimumInitialValue(Double_t value) { fMinimumInitialValue = value; }
+    void SetMaxIterations(Int_t iterations) { fMaxIterations = iterations; }
+    void SetTolerance(Double_t tolerance) { fTolerance = tolerance; }
+    void SetMemory(Int_t memory) { fMemory = memory; }
+    void SetNThreads(Int_t threads) { fNThreads = threads; }
+    void SetSeed(UInt_t seed) { fSeed = seed; }
+    void SetDebug(Bool_t debug = kTRUE) { fDebug = debug; }
+
+    RegularizationType GetRegularizationType() const { return fRegularizationType; }
+    Double_t GetRegularizationWeight() const { return fRegularizationWeight; }
+    Double_t GetLastChi2() const { return fLastChi2; }
+    Double_t GetLastRegularization() const { return fLastRegularization; }
+    Int_t GetLastIterations() const { return fLastIterations; }
+
+    Int_t Unfold(const TH2* correlation, const TH1* efficiency, const TH1* measured, const TH1* initialConditions, TH1* result) const;
+    Int_t UnfoldGetBias(const TH2* correlation, const TH1* efficiency, const TH1* measured, const TH1* initialConditions, TH1* result) const;
+    Int_t UnfoldToys(const TH2* correlation, const TH1* efficiency, const TH1* measured, const TH1* initialConditions, TH1* result, Int_t nToys, Bool_t randomizeMeasured, Bool_t randomizeResponse, TH1* spread = 0) const;
+
+  protected:
+    RegularizationType fRegularizationType; // type of the regularization term
+    Double_t fRegularizationWeight;         // weight of the regularization term
+    Int_t fSkipBinsBegin;                   // number of measured bins at the beginning excluded from the chi2
+    Double_t fMinimumInitialValue;          // minimum initial value of each unfolded bin, relative to the largest
+    Int_t fMaxIterations;                   // maximum number of L-BFGS iterations
+    Double_t fTolerance;                    // convergence tolerance on the relative change of the function
+    Int_t fMemory;                          // number of correction pairs kept by L-BFGS
+    Int_t fNThreads;                        // number of threads for the toy unfoldings (0: hardware concurrency)
+    UInt_t fSeed;                           // seed of the toy randomization
+    Bool_t fDebug;                          // print the progress of the minimization
+
+    mutable Double_t fLastChi2;             //! chi2 of the last unfolding
+    mutable Double_t fLastRegularization;   //! regularization term of the last unfolding
+    mutable Int_t fLastIterations;          //! iterations of the last unfolding
+
+  ClassDef(AliGradientUnfolding, 1);
+};
+
+#endif
@@ -23,6 +23,7 @@
 //  Author: Jan.Fiete.Grosse-Oetringhaus@cern.ch
 
 #include "AliMultiplicityCorrection.h"
+#include "AliGradientUnfolding.h"
 
 #include <TFile.h>
 #include <TH1F.h>
@@ -901,6 +902,60 @@ Int_t AliMultiplicityCorrection::ApplyMinuitFit(Int_t inputRange, Bool_t fullPha
   return resultCode;
 }
 
+//____________________________________________________________________
+Int_t AliMultiplicityCorrection::ApplyGradientFit(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, const AliGradientUnfolding* unfolding, TH1* initialConditions, Bool_t errorAsBias, Int_t nToys)
+{
+  //
+  // correct spectrum using the chi2 method minimized with analytic gradients (see AliGradientUnfolding)
+  // the regularization and the minimizer are configured in <unfolding>
+  //
+  // errorAsBias: the errors of the result are the bias of the method (see AliGradientUnfolding::UnfoldGetBias)
+  // nToys > 0:   the errors of the result are the spread of nToys unfoldings of the randomized measured
+  //              spectrum and response, unfolded in parallel (see AliGradientUnfolding::UnfoldToys)
+  //
+  // the 0 bin estimate of Calculate0Bin is not supported, the events without vertex are not used
+  //
+
+  if (!unfolding)
+  {
+    AliError("No unfolding object given");
+    return -1;
+  }
+
+  Int_t correlationID = inputRange + ((fullPhaseSpace == kFALSE) ? 0 : 4);
+
+  // use here only vtx efficiency (to MB sample)
+  SetupCurrentHists(inputRange, fullPhaseSpace, (eventType == kTrVtx) ? kTrVtx : kMB);
+
+  Int_t resultCode = -1;
+  if (nToys > 0)
+  {
+    resultCode = unfolding->UnfoldToys(fCurrentCorrelation, fCurrentEfficiency, fCurrentESD, initialConditions, fMultiplicityESDCorrected[correlationID], nToys, kTRUE, kTRUE);
+  }
+  else if (errorAsBias == kFALSE)
+  {
+    resultCode = unfolding->Unfold(fCurrentCorrelation, fCurrentEfficiency, fCurrentESD, initialConditions, fMultiplicityESDCorrected[correlationID]);
+  }
+  else
+  {
+    resultCode = unfolding->UnfoldGetBias(fCurrentCorrelation, fCurrentEfficiency, fCurrentESD, initialConditions, fMultiplicityESDCorrected[correlationID]);
+  }
+
+  // correct for the trigger bias if requested
+  if (eventType > kMB)
+  {
+    Printf("Applying trigger efficiency");
+    TH1* eff = GetTriggerEfficiency(inputRange, eventType);
+    for (Int_t i=1; i<=fMultiplicityESDCorrected[correlationID]->GetNbinsX(); i++)
+    {
+      fMultiplicityESDCorrected[correlationID]->SetBinContent(i, fMultiplicityESDCorrected[correlationID]->GetBinContent(i) / eff->GetBinContent(i));
+      fMultiplicityESDCorrected[correlationID]->SetBinError(i, fMultiplicityESDCorrected[correlationID]->GetBinError(i) / eff->GetBinContent(i));
+    }
+  }
+
+  return resultCode;
+}
+
 //____________________________________________________________________
 void AliMultiplicityCorrection::Calculate0Bin(Int_t inputRange, EventType eventType, Int_t zeroBinEvents)
 {
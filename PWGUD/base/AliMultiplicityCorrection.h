@@ -18,6 +18,7 @@ class TH2F;
 class TH3F;
 class TF1;
 class TCollection;
+class AliGradientUnfolding;
 
 // defined here, because it does not seem possible to predeclare these (or i do not know how)
 // -->
@@ -58,6 +59,7 @@ class AliMultiplicityCorrection : public TNamed {
     void DrawComparison(const char* name, Int_t inputRange, Bool_t fullPhaseSpace, Bool_t normalizeESD, TH1* mcHist, Bool_t simple = kFALSE, EventType eventType = kTrVtx);
 
     Int_t ApplyMinuitFit(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Int_t zeroBinEvents, Bool_t check = kFALSE, TH1* initialConditions = 0, Bool_t errorAsBias = kFALSE);
+    Int_t ApplyGradientFit(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, const AliGradientUnfolding* unfolding, TH1* initialConditions = 0, Bool_t errorAsBias = kFALSE, Int_t nToys = 0);
 
     void ApplyBayesianMethod(Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Float_t regPar = 1, Int_t nIterations = 100, TH1* initialConditions = 0, Int_t determineError = 1);
 